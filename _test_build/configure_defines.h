@@ -0,0 +1,6 @@
+#ifndef _CONFIGDEFS_
+#define _CONFIGDEFS_ 1
+
+#define DYNAMORIO_DEFINES "-DDRSTATS_DEMO -DX86 -DX64 -DLINUX -DUNIX -DDR_HOST_X86 -DDR_HOST_X64 -DAPP_EXPORTS -DKSTATS -DBUILD_TESTS -DHAVE_FVISIBILITY -DHAVE_FNOSANITIZE_NULL -DHAVE_TYPELIMITS_CONTROL -DANNOTATIONS -DHAVE_RSEQ -DDR_DO_NOT_DEFINE_uint -DDR_DO_NOT_DEFINE_ushort -DDR__Bool_EXISTS -DASSEMBLE_WITH_GAS -DHAVE_MEMINFO -DHAVE_MEMINFO_MAPS -DHAVE_TLS -DHAVE_SIGALTSTACK -DUSE_VISIBILITY_ATTRIBUTES -DDR_APP_EXPORTS"
+
+#endif /* _CONFIGDEFS_ */
@@ -51,6 +51,7 @@
 #include "../fcache.h"
 #include "proc.h"
 #include "instrument.h"
+#include "rewrite_helper.h"
 
 #if defined(DEBUG) || defined(INTERNAL)
 #    include "disassemble.h"
@@ -1776,7 +1777,7 @@ in_generated_routine(dcontext_t *dcontext, cache_pc pc)
 
     return (
         (pc >= (cache_pc)(code->gen_start_pc) && pc < (cache_pc)(code->commit_end_pc)) ||
-        in_generated_shared_routine(dcontext, pc));
+        in_generated_shared_routine(dcontext, pc) || rewrite_helper_in_pool(pc));
     /* FIXME: what about inlined IBL stubs */
 }
 
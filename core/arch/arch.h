@@ -577,6 +577,25 @@ mangle_possible_single_step(dcontext_t *dcontext, instrlist_t *ilist, instr_t *i
 void
 mangle_single_step(dcontext_t *dcontext, instrlist_t *ilist, uint flags, instr_t *instr);
 
+/* -hide_avx512 bits */
+#    define HIDE_AVX512_F 0x0001 /* every subset, plus the XCR0 state */
+#    define HIDE_AVX512_CD 0x0002
+#    define HIDE_AVX512_BW 0x0004
+#    define HIDE_AVX512_DQ 0x0008
+#    define HIDE_AVX512_VL 0x0010
+#    define HIDE_AVX512_IFMA 0x0020
+#    define HIDE_AVX512_VBMI 0x0040 /* VBMI and VBMI2 */
+#    define HIDE_AVX512_VNNI 0x0080
+#    define HIDE_AVX512_BITALG 0x0100 /* BITALG and VPOPCNTDQ */
+#    define HIDE_AVX512_BF16 0x0200
+#    define HIDE_AVX512_FP16 0x0400
+#    define HIDE_AVX512_VP2INTERSECT 0x0800
+#    define HIDE_AVX512_PHI 0x1000 /* ER, PF, 4FMAPS and 4VNNIW */
+#    define HIDE_AVX512_ALL 0x1fff
+void
+mangle_hide_avx512(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr,
+                   instr_t *next_instr);
+
 #endif
 instr_t *
 mangle_direct_call(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr,
@@ -150,6 +150,14 @@ typedef struct _spill_state_t {
     reg_t xax, xbx, xcx, xdx; /* general-purpose registers */
     dr_opmask_t k_regs[MCXT_NUM_OPMASK_SLOTS] ALIGN_VAR(8);
     dr_zmm_t zmm_regs[MCXT_NUM_SIMD_SLOTS] ALIGN_VAR(64);
+    /* app MXCSR while an {er}/{sae} override is live, and the override itself */
+    uint mxcsr_app, mxcsr_override;
+    /* set by every block holding a rewritten instr, cleared by rewrite_phase.c */
+    uint avx512_active;
+    /* return pc of the running rewrite_helper.c routine, pushed by its call */
+    reg_t avx512_helper_ret;
+    /* app xsp across a helper call, and the stack pointer the call runs on */
+    reg_t avx512_helper_xsp, avx512_helper_stack;
 #elif defined(AARCHXX)
     reg_t r0, r1, r2, r3;
     /* These are needed for ldex/stex mangling and A64 icache_op_ic_ivau_asm. */
@@ -222,6 +230,13 @@ typedef struct _local_state_extended_t {
 #    define SCRATCH_REG3 DR_REG_XDX
 #    define TLS_ZMM_idx_SLOT(zmm_idx) ((ushort)offsetof(spill_state_t, zmm_regs[zmm_idx]))
 #    define TLS_K_idx_SLOT(k_idx) ((ushort)offsetof(spill_state_t, k_regs[k_idx]))
+#    define TLS_MXCSR_APP_SLOT ((ushort)offsetof(spill_state_t, mxcsr_app))
+#    define TLS_MXCSR_OVERRIDE_SLOT ((ushort)offsetof(spill_state_t, mxcsr_override))
+#    define TLS_AVX512_ACTIVE_SLOT ((ushort)offsetof(spill_state_t, avx512_active))
+#    define TLS_AVX512_HELPER_RET_SLOT ((ushort)offsetof(spill_state_t, avx512_helper_ret))
+#    define TLS_AVX512_HELPER_XSP_SLOT ((ushort)offsetof(spill_state_t, avx512_helper_xsp))
+#    define TLS_AVX512_HELPER_STACK_SLOT \
+        ((ushort)offsetof(spill_state_t, avx512_helper_stack))
 #elif defined(AARCHXX)
 #    define TLS_REG0_SLOT ((ushort)offsetof(spill_state_t, r0))
 #    define TLS_REG1_SLOT ((ushort)offsetof(spill_state_t, r1))
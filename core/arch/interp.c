@@ -64,6 +64,10 @@
 #include "opnd_api.h"
 #include "rewrite.h"
 #include "rewrite_utils.h"
+#include "rewrite_cache.h"
+#include "rewrite_phase.h"
+#include "rewrite_helper.h"
+#include "rewrite_interp.h"
 // #include "rewrite_analysis.h"
 #ifdef RETURN_AFTER_CALL
 #    include "../rct.h"
@@ -147,6 +151,11 @@ interp_init()
         bbdump_file = open_log_file("bbs", NULL, 0);
         ASSERT(bbdump_file != INVALID_FILE);
     }
+    rewrite_init();
+    rewrite_cache_init();
+    rewrite_phase_init();
+    rewrite_helper_init();
+    rewrite_interp_init();
 }
 
 #ifdef CUSTOM_TRACES_RET_REMOVAL
@@ -163,6 +172,9 @@ interp_exit()
     if (INTERNAL_OPTION(bbdump_tags)) {
         close_log_file(bbdump_file);
     }
+    rewrite_cache_exit();
+    rewrite_helper_exit();
+    rewrite_interp_exit();
     DELETE_LOCK(bb_building_lock);
 
     LOG(GLOBAL, LOG_INTERP | LOG_STATS, 1, "Total application code seen: %d KB\n", GLOBAL_STAT(app_code_seen) / 1024);
@@ -3378,10 +3390,12 @@ build_bb_ilist(dcontext_t *dcontext, build_bb_t *bb)
                 break;
             }
 
-            // detect avx512 instr by evex prefix
-            if (instr_get_prefix_flag(bb->instr, PREFIX_EVEX)) {
+            // detect avx512 instr by evex prefix, leaving those the host runs natively
+            if (instr_get_prefix_flag(bb->instr, PREFIX_EVEX) && !proc_avx512_runs_natively(bb->instr)) {
                 bb->ilist->has_avx512 = true;
                 bb->instr->is_avx512_instr = true;
+                // the interpreter decodes the instr again from its app pc
+                instr_set_translation(bb->instr, bb->instr_start);
 #    ifdef DEBUG
                 LOG(THREAD, LOG_INTERP, 3, "|=> avx512 instr at:%p, current pc at:%p\n", bb->instr_start, bb->cur_pc);
                 print_file(STD_OUTF, "\n|=> avx512 instr at:%p, current pc at:%p\n", bb->instr_start, bb->cur_pc);
@@ -3390,9 +3404,12 @@ build_bb_ilist(dcontext_t *dcontext, build_bb_t *bb)
             }
 
             // detect non evex prefix avx512 mask register manipulation related instr
-            if (instr_get_opcode(bb->instr) >= OP_kmovw && instr_get_opcode(bb->instr) <= OP_ktestd) {
+            if (instr_get_opcode(bb->instr) >= OP_kmovw && instr_get_opcode(bb->instr) <= OP_ktestd &&
+                !proc_avx512_runs_natively(bb->instr)) {
                 bb->ilist->has_avx512 = true;
                 bb->instr->is_avx512_instr = true;
+                // the interpreter decodes the instr again from its app pc
+                instr_set_translation(bb->instr, bb->instr_start);
 #    ifdef DEBUG
                 LOG(THREAD, LOG_INTERP, 3, "|=> avx512 instr at:%p, current pc at:%p\n", bb->instr_start, bb->cur_pc);
                 print_file(STD_OUTF, "\n|=> avx512 mask related instr at:%p, current pc at:%p\n", bb->instr_start,
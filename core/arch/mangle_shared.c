@@ -2068,6 +2068,11 @@ d_r_mangle(dcontext_t *dcontext, instrlist_t *ilist, uint *flags DR_PARAM_INOUT,
                 /* Resets to generate single step exception only once. */
                 dcontext->single_step_addr = NULL;
             }
+        } else if (DYNAMO_OPTION(hide_avx512) != 0 &&
+                   (instr_get_opcode(instr) == OP_cpuid ||
+                    instr_get_opcode(instr) == OP_xgetbv)) {
+            mangle_hide_avx512(dcontext, ilist, instr, next_instr);
+            continue;
         }
 #endif
 #ifdef FOOL_CPUID
@@ -174,4 +174,15 @@ proc_xstate_area_zmm_hi256_offs(void);
 int
 proc_xstate_area_hi16_zmm_offs(void);
 
+#ifdef X86
+/*
+ * This function is internal only.
+ *
+ * Returns whether the AVX-512 `instr` runs natively under -avx512_native_subsets,
+ * the host having the subset its opcode needs, rather than being rewritten.
+ */
+bool
+proc_avx512_runs_natively(instr_t *instr);
+#endif
+
 #endif /* _PROC_H_ */
@@ -160,6 +160,9 @@ typedef struct {
     uint ext_flags_edx;  /**< X86 extended feature flags stored in edx */
     uint ext_flags_ecx;  /**< X86 extended feature flags stored in ecx */
     uint sext_flags_ebx; /**< structured X86 extended feature flags stored in ebx */
+    uint sext_flags_ecx; /**< structured X86 extended feature flags stored in ecx */
+    uint sext_flags_edx; /**< structured X86 extended feature flags stored in edx */
+    uint sext1_flags_eax; /**< structured X86 extended feature flags, subleaf 1 eax */
 } features_t;
 #endif
 /* We avoid using #elif here because otherwise doxygen will be unable to
@@ -297,7 +300,27 @@ typedef enum {
     FEATURE_INVPCID = 10 + 128,  /**< #OP_invpcid supported (X86) */
     FEATURE_RTM = 11 + 128,      /**< Restricted Transactional Memory supported (X86) */
     FEATURE_AVX512F = 16 + 128,  /**< AVX-512F instructions supported (X86) */
+    FEATURE_AVX512DQ = 17 + 128, /**< AVX-512DQ instructions supported (X86) */
+    FEATURE_AVX512IFMA = 21 + 128, /**< AVX-512 IFMA instructions supported (X86) */
+    FEATURE_AVX512PF = 26 + 128, /**< AVX-512PF instructions supported (X86) */
+    FEATURE_AVX512ER = 27 + 128, /**< AVX-512ER instructions supported (X86) */
+    FEATURE_AVX512CD = 28 + 128, /**< AVX-512CD instructions supported (X86) */
     FEATURE_AVX512BW = 30 + 128, /**< AVX-512BW instructions supported (X86) */
+    FEATURE_AVX512VL = 31 + 128, /**< AVX-512VL instructions supported (X86) */
+    /* structured extended features returned in ecx */
+    FEATURE_AVX512VBMI = 1 + 160,      /**< AVX-512 VBMI instructions supported (X86) */
+    FEATURE_AVX512VBMI2 = 6 + 160,     /**< AVX-512 VBMI2 instructions supported (X86) */
+    FEATURE_GFNI = 8 + 160,            /**< Galois field instructions supported (X86) */
+    FEATURE_VAES = 9 + 160,            /**< VEX/EVEX 256/512-bit AES supported (X86) */
+    FEATURE_VPCLMULQDQ = 10 + 160,     /**< VEX/EVEX 256/512-bit #OP_vpclmulqdq supported (X86) */
+    FEATURE_AVX512VNNI = 11 + 160,     /**< AVX-512 VNNI instructions supported (X86) */
+    FEATURE_AVX512BITALG = 12 + 160,   /**< AVX-512 BITALG instructions supported (X86) */
+    FEATURE_AVX512VPOPCNTDQ = 14 + 160, /**< AVX-512 VPOPCNTDQ instructions supported (X86) */
+    /* structured extended features returned in edx */
+    FEATURE_AVX512VP2INTERSECT = 8 + 192, /**< AVX-512 VP2INTERSECT supported (X86) */
+    FEATURE_AVX512FP16 = 23 + 192,        /**< AVX-512 FP16 instructions supported (X86) */
+    /* structured extended features returned in eax of subleaf 1 */
+    FEATURE_AVX512BF16 = 5 + 224, /**< AVX-512 BF16 instructions supported (X86) */
 } feature_bit_t;
 #endif
 /* We avoid using #elif here because otherwise doxygen will be unable to
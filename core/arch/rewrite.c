@@ -32,6 +32,12 @@
 #include "opnd.h"
 #include "opnd_api.h"
 #include "rewrite_utils.h"
+#include "rewrite_cache.h"
+#include "rewrite_phase.h"
+#include "rewrite_helper.h"
+#include "rewrite_interp.h"
+#include "rewrite_template.h"
+#include "rewrite_arena.h"
 // #include "rewrite_analysis.h"
 #include <sys/types.h>
 
@@ -193,7 +199,7 @@ instr_rewrite_func_t *rewrite_funcs[] = {
     /* 143 OP_AVX512_vpsllq */ rw_func_vpsllq,
     /* 144 OP_AVX512_vpmuludq */ rw_func_empty,
     /* 145 OP_AVX512_vpmaddwd */ rw_func_empty,
-    /* 146 OP_AVX512_vpsadbw */ rw_func_empty,
+    /* 146 OP_AVX512_vpsadbw */ rw_func_vpsadbw,
     /* 147 OP_AVX512_vmaskmovdqu */ rw_func_empty,
     /* 148 OP_AVX512_vpsubb */ rw_func_vpsubb,
     /* 149 OP_AVX512_vpsubw */ rw_func_vpsubw,
@@ -261,10 +267,10 @@ instr_rewrite_func_t *rewrite_funcs[] = {
     /* 211 OP_AVX512_vpmulld */ rw_func_vpmulld,
     /* 212 OP_AVX512_vphminposuw */ rw_func_empty,
     /* 213 OP_AVX512_vaesimc */ rw_func_empty,
-    /* 214 OP_AVX512_vaesenc */ rw_func_empty,
-    /* 215 OP_AVX512_vaesenclast */ rw_func_empty,
-    /* 216 OP_AVX512_vaesdec */ rw_func_empty,
-    /* 217 OP_AVX512_vaesdeclast */ rw_func_empty,
+    /* 214 OP_AVX512_vaesenc */ rw_func_vaesenc,
+    /* 215 OP_AVX512_vaesenclast */ rw_func_vaesenclast,
+    /* 216 OP_AVX512_vaesdec */ rw_func_vaesdec,
+    /* 217 OP_AVX512_vaesdeclast */ rw_func_vaesdeclast,
     /* 218 OP_AVX512_vpextrb */ rw_func_vpextr_,
     /* 219 OP_AVX512_vpextrd */ rw_func_vpextr_,
     /* 220 OP_AVX512_vextractps */ rw_func_empty,
@@ -285,14 +291,14 @@ instr_rewrite_func_t *rewrite_funcs[] = {
     /* 235 OP_AVX512_vpcmpestri */ rw_func_empty,
     /* 236 OP_AVX512_vpcmpistrm */ rw_func_empty,
     /* 237 OP_AVX512_vpcmpistri */ rw_func_empty,
-    /* 238 OP_AVX512_vpclmulqdq */ rw_func_empty,
+    /* 238 OP_AVX512_vpclmulqdq */ rw_func_vpclmulqdq,
     /* 239 OP_AVX512_vaeskeygenassist */ rw_func_empty,
     /* 240 OP_AVX512_vtestps */ rw_func_empty,
     /* 241 OP_AVX512_vtestpd */ rw_func_empty,
     /* 242 OP_AVX512_vzeroupper */ rw_func_empty,
     /* 243 OP_AVX512_vzeroall */ rw_func_empty,
-    /* 244 OP_AVX512_vldmxcsr */ rw_func_empty,
-    /* 245 OP_AVX512_vstmxcsr */ rw_func_empty,
+    /* 244 OP_AVX512_vldmxcsr */ rw_func_vldmxcsr,
+    /* 245 OP_AVX512_vstmxcsr */ rw_func_vstmxcsr,
     /* 246 OP_AVX512_vbroadcastss */ rw_func_empty,
     /* 247 OP_AVX512_vbroadcastsd */ rw_func_empty,
     /* 248 OP_AVX512_vbroadcastf128 */ rw_func_empty,
@@ -570,10 +576,10 @@ instr_rewrite_func_t *rewrite_funcs[] = {
     /* 520 OP_AVX512_ktestb */ rw_func_ktestb,
     /* 521 OP_AVX512_ktestq */ rw_func_ktestq,
     /* 522 OP_AVX512_ktestd */ rw_func_ktestd,
-    /* 523 OP_AVX512_valignd */ rw_func_empty,
-    /* 524 OP_AVX512_valignq */ rw_func_empty,
-    /* 525 OP_AVX512_vblendmpd */ rw_func_empty,
-    /* 526 OP_AVX512_vblendmps */ rw_func_empty,
+    /* 523 OP_AVX512_valignd */ rw_func_valignd,
+    /* 524 OP_AVX512_valignq */ rw_func_valignq,
+    /* 525 OP_AVX512_vblendmpd */ rw_func_vblendmpd,
+    /* 526 OP_AVX512_vblendmps */ rw_func_vblendmps,
     /* 527 OP_AVX512_vbroadcastf32x2 */ rw_func_empty,
     /* 528 OP_AVX512_vbroadcastf32x4 */ rw_func_empty,
     /* 529 OP_AVX512_vbroadcastf32x8 */ rw_func_empty,
@@ -584,8 +590,8 @@ instr_rewrite_func_t *rewrite_funcs[] = {
     /* 534 OP_AVX512_vbroadcasti32x8 */ rw_func_empty,
     /* 535 OP_AVX512_vbroadcasti64x2 */ rw_func_empty,
     /* 536 OP_AVX512_vbroadcasti64x4 */ rw_func_empty,
-    /* 537 OP_AVX512_vcompresspd */ rw_func_empty,
-    /* 538 OP_AVX512_vcompressps */ rw_func_empty,
+    /* 537 OP_AVX512_vcompresspd */ rw_func_vcompresspd,
+    /* 538 OP_AVX512_vcompressps */ rw_func_vcompressps,
     /* 539 OP_AVX512_vcvtpd2qq */ rw_func_empty,
     /* 540 OP_AVX512_vcvtpd2udq */ rw_func_empty,
     /* 541 OP_AVX512_vcvtpd2uqq */ rw_func_empty,
@@ -610,19 +616,19 @@ instr_rewrite_func_t *rewrite_funcs[] = {
     /* 560 OP_AVX512_vcvtuqq2ps */ rw_func_empty,
     /* 561 OP_AVX512_vcvtusi2sd */ rw_func_vcvtusi2sd,
     /* 562 OP_AVX512_vcvtusi2ss */ rw_func_vcvtusi2ss,
-    /* 563 OP_AVX512_vdbpsadbw */ rw_func_empty,
+    /* 563 OP_AVX512_vdbpsadbw */ rw_func_vdbpsadbw,
     /* 564 OP_AVX512_vexp2pd */ rw_func_empty,
     /* 565 OP_AVX512_vexp2ps */ rw_func_empty,
-    /* 566 OP_AVX512_vexpandpd */ rw_func_empty,
-    /* 567 OP_AVX512_vexpandps */ rw_func_empty,
-    /* 568 OP_AVX512_vextractf32x4 */ rw_func_empty,
-    /* 569 OP_AVX512_vextractf32x8 */ rw_func_empty,
+    /* 566 OP_AVX512_vexpandpd */ rw_func_vexpandpd,
+    /* 567 OP_AVX512_vexpandps */ rw_func_vexpandps,
+    /* 568 OP_AVX512_vextractf32x4 */ rw_func_vextractf32x4,
+    /* 569 OP_AVX512_vextractf32x8 */ rw_func_vextractf32x8,
     /* 570 OP_AVX512_vextractf64x2 */ rw_func_vextractf64x2,
-    /* 571 OP_AVX512_vextractf64x4 */ rw_func_empty,
+    /* 571 OP_AVX512_vextractf64x4 */ rw_func_vextractf64x4,
     /* 572 OP_AVX512_vextracti32x4 */ rw_func_vextracti32x4,
-    /* 573 OP_AVX512_vextracti32x8 */ rw_func_empty,
+    /* 573 OP_AVX512_vextracti32x8 */ rw_func_vextracti32x8,
     /* 574 OP_AVX512_vextracti64x2 */ rw_func_vextracti64x2,
-    /* 575 OP_AVX512_vextracti64x4 */ rw_func_empty,
+    /* 575 OP_AVX512_vextracti64x4 */ rw_func_vextracti64x4,
     /* 576 OP_AVX512_vfixupimmpd */ rw_func_empty,
     /* 577 OP_AVX512_vfixupimmps */ rw_func_empty,
     /* 578 OP_AVX512_vfixupimmsd */ rw_func_empty,
@@ -647,13 +653,13 @@ instr_rewrite_func_t *rewrite_funcs[] = {
     /* 597 OP_AVX512_vgetmantps */ rw_func_empty,
     /* 598 OP_AVX512_vgetmantsd */ rw_func_empty,
     /* 599 OP_AVX512_vgetmantss */ rw_func_empty,
-    /* 600 OP_AVX512_vinsertf32x4 */ rw_func_empty,
-    /* 601 OP_AVX512_vinsertf32x8 */ rw_func_empty,
-    /* 602 OP_AVX512_vinsertf64x2 */ rw_func_empty,
-    /* 603 OP_AVX512_vinsertf64x4 */ rw_func_empty,
-    /* 604 OP_AVX512_vinserti32x4 */ rw_func_empty,
-    /* 605 OP_AVX512_vinserti32x8 */ rw_func_empty,
-    /* 606 OP_AVX512_vinserti64x2 */ rw_func_empty,
+    /* 600 OP_AVX512_vinsertf32x4 */ rw_func_vinsertf32x4,
+    /* 601 OP_AVX512_vinsertf32x8 */ rw_func_vinsertf32x8,
+    /* 602 OP_AVX512_vinsertf64x2 */ rw_func_vinsertf64x2,
+    /* 603 OP_AVX512_vinsertf64x4 */ rw_func_vinsertf64x4,
+    /* 604 OP_AVX512_vinserti32x4 */ rw_func_vinserti32x4,
+    /* 605 OP_AVX512_vinserti32x8 */ rw_func_vinserti32x8,
+    /* 606 OP_AVX512_vinserti64x2 */ rw_func_vinserti64x2,
     /* 607 OP_AVX512_vinserti64x4 */ rw_func_vinserti64x4,
     /* 608 OP_AVX512_vmovdqa32 */ rw_func_vmovdqa32,
     /* 609 OP_AVX512_vmovdqa64 */ rw_func_vmovdqa64,
@@ -661,15 +667,15 @@ instr_rewrite_func_t *rewrite_funcs[] = {
     /* 611 OP_AVX512_vmovdqu32 */ rw_func_vmovdqu32,
     /* 612 OP_AVX512_vmovdqu64 */ rw_func_vmovdqu64,
     /* 613 OP_AVX512_vmovdqu8 */ rw_func_vmovdqu8,
-    /* 614 OP_AVX512_vpabsq */ rw_func_empty,
+    /* 614 OP_AVX512_vpabsq */ rw_func_vpabsq,
     /* 615 OP_AVX512_vpandd */ rw_func_vpandd,
     /* 616 OP_AVX512_vpandnd */ rw_func_empty,
     /* 617 OP_AVX512_vpandnq */ rw_func_empty,
     /* 618 OP_AVX512_vpandq */ rw_func_vpandq,
-    /* 619 OP_AVX512_vpblendmb */ rw_func_empty,
-    /* 620 OP_AVX512_vpblendmd */ rw_func_empty,
-    /* 621 OP_AVX512_vpblendmq */ rw_func_empty,
-    /* 622 OP_AVX512_vpblendmw */ rw_func_empty,
+    /* 619 OP_AVX512_vpblendmb */ rw_func_vpblendmb,
+    /* 620 OP_AVX512_vpblendmd */ rw_func_vpblendmd,
+    /* 621 OP_AVX512_vpblendmq */ rw_func_vpblendmq,
+    /* 622 OP_AVX512_vpblendmw */ rw_func_vpblendmw,
     /* 623 OP_AVX512_vpbroadcastmb2q */ rw_func_empty,
     /* 624 OP_AVX512_vpbroadcastmw2d */ rw_func_empty,
     /* 625 OP_AVX512_vpcmpb */ rw_func_empty,
@@ -680,8 +686,8 @@ instr_rewrite_func_t *rewrite_funcs[] = {
     /* 630 OP_AVX512_vpcmpuq */ rw_func_empty,
     /* 631 OP_AVX512_vpcmpuw */ rw_func_empty,
     /* 632 OP_AVX512_vpcmpw */ rw_func_vpcmpw,
-    /* 633 OP_AVX512_vpcompressd */ rw_func_empty,
-    /* 634 OP_AVX512_vpcompressq */ rw_func_empty,
+    /* 633 OP_AVX512_vpcompressd */ rw_func_vpcompressd,
+    /* 634 OP_AVX512_vpcompressq */ rw_func_vpcompressq,
     /* 635 OP_AVX512_vpconflictd */ rw_func_empty,
     /* 636 OP_AVX512_vpconflictq */ rw_func_empty,
     /* 637 OP_AVX512_vpermb */ rw_func_empty,
@@ -698,18 +704,18 @@ instr_rewrite_func_t *rewrite_funcs[] = {
     /* 648 OP_AVX512_vpermt2q */ rw_func_vpermt2q,
     /* 649 OP_AVX512_vpermt2w */ rw_func_vpermt2w,
     /* 650 OP_AVX512_vpermw */ rw_func_empty,
-    /* 651 OP_AVX512_vpexpandd */ rw_func_empty,
-    /* 652 OP_AVX512_vpexpandq */ rw_func_empty,
+    /* 651 OP_AVX512_vpexpandd */ rw_func_vpexpandd,
+    /* 652 OP_AVX512_vpexpandq */ rw_func_vpexpandq,
     /* 653 OP_AVX512_vpextrq */ rw_func_vpextr_,
     /* 654 OP_AVX512_vpinsrq */ rw_func_empty,
     /* 655 OP_AVX512_vplzcntd */ rw_func_empty,
     /* 656 OP_AVX512_vplzcntq */ rw_func_empty,
-    /* 657 OP_AVX512_vpmadd52huq */ rw_func_empty,
-    /* 658 OP_AVX512_vpmadd52luq */ rw_func_empty,
-    /* 659 OP_AVX512_vpmaxsq */ rw_func_empty,
-    /* 660 OP_AVX512_vpmaxuq */ rw_func_empty,
-    /* 661 OP_AVX512_vpminsq */ rw_func_empty,
-    /* 662 OP_AVX512_vpminuq */ rw_func_empty,
+    /* 657 OP_AVX512_vpmadd52huq */ rw_func_vpmadd52huq,
+    /* 658 OP_AVX512_vpmadd52luq */ rw_func_vpmadd52luq,
+    /* 659 OP_AVX512_vpmaxsq */ rw_func_vpmaxsq,
+    /* 660 OP_AVX512_vpmaxuq */ rw_func_vpmaxuq,
+    /* 661 OP_AVX512_vpminsq */ rw_func_vpminsq,
+    /* 662 OP_AVX512_vpminuq */ rw_func_vpminuq,
     /* 663 OP_AVX512_vpmovb2m */ rw_func_empty,
     /* 664 OP_AVX512_vpmovd2m */ rw_func_empty,
     /* 665 OP_AVX512_vpmovdb */ rw_func_empty,
@@ -741,21 +747,21 @@ instr_rewrite_func_t *rewrite_funcs[] = {
     /* 691 OP_AVX512_vporq */ rw_func_vporq,
     /* 692 OP_AVX512_vprold */ rw_func_empty,
     /* 693 OP_AVX512_vprolq */ rw_func_vprolq,
-    /* 694 OP_AVX512_vprolvd */ rw_func_empty,
-    /* 695 OP_AVX512_vprolvq */ rw_func_empty,
+    /* 694 OP_AVX512_vprolvd */ rw_func_vprolvd,
+    /* 695 OP_AVX512_vprolvq */ rw_func_vprolvq,
     /* 696 OP_AVX512_vprord */ rw_func_empty,
     /* 697 OP_AVX512_vprorq */ rw_func_vprorq,
-    /* 698 OP_AVX512_vprorvd */ rw_func_empty,
-    /* 699 OP_AVX512_vprorvq */ rw_func_empty,
+    /* 698 OP_AVX512_vprorvd */ rw_func_vprorvd,
+    /* 699 OP_AVX512_vprorvq */ rw_func_vprorvq,
     /* 700 OP_AVX512_vpscatterdd */ rw_func_vpscatterdd,
     /* 701 OP_AVX512_vpscatterdq */ rw_func_vpscatterdq,
     /* 702 OP_AVX512_vpscatterqd */ rw_func_vpscatterqd,
     /* 703 OP_AVX512_vpscatterqq */ rw_func_vpscatterqq,
-    /* 704 OP_AVX512_vpsllvw */ rw_func_empty,
-    /* 705 OP_AVX512_vpsraq */ rw_func_empty,
-    /* 706 OP_AVX512_vpsravq */ rw_func_empty,
-    /* 707 OP_AVX512_vpsravw */ rw_func_empty,
-    /* 708 OP_AVX512_vpsrlvw */ rw_func_empty,
+    /* 704 OP_AVX512_vpsllvw */ rw_func_vpsllvw,
+    /* 705 OP_AVX512_vpsraq */ rw_func_vpsraq,
+    /* 706 OP_AVX512_vpsravq */ rw_func_vpsravq,
+    /* 707 OP_AVX512_vpsravw */ rw_func_vpsravw,
+    /* 708 OP_AVX512_vpsrlvw */ rw_func_vpsrlvw,
     /* 709 OP_AVX512_vpternlogd */ rw_func_empty,
     /* 710 OP_AVX512_vpternlogq */ rw_func_empty,
     /* 711 OP_AVX512_vptestmb */ rw_func_empty,
@@ -812,12 +818,68 @@ instr_rewrite_func_t *rewrite_funcs[] = {
     /* 762 OP_AVX512_vscatterpf1dps */ rw_func_empty,
     /* 763 OP_AVX512_vscatterpf1qpd */ rw_func_empty,
     /* 764 OP_AVX512_vscatterpf1qps */ rw_func_empty,
-    /* 765 OP_AVX512_vshuff32x4 */ rw_func_empty,
-    /* 766 OP_AVX512_vshuff64x2 */ rw_func_empty,
+    /* 765 OP_AVX512_vshuff32x4 */ rw_func_vshuff32x4,
+    /* 766 OP_AVX512_vshuff64x2 */ rw_func_vshuff64x2,
     /* 767 OP_AVX512_vshufi32x4 */ rw_func_vshufi32x4,
-    /* 768 OP_AVX512_vshufi64x2 */ rw_func_empty,
+    /* 768 OP_AVX512_vshufi64x2 */ rw_func_vshufi64x2,
+    /* 769 OP_sha1msg1 */ rw_func_invalid,
+    /* 770 OP_sha1msg2 */ rw_func_invalid,
+    /* 771 OP_sha1nexte */ rw_func_invalid,
+    /* 772 OP_sha1rnds4 */ rw_func_invalid,
+    /* 773 OP_sha256msg1 */ rw_func_invalid,
+    /* 774 OP_sha256msg2 */ rw_func_invalid,
+    /* 775 OP_sha256rnds2 */ rw_func_invalid,
+    /* 776 OP_bndcl */ rw_func_invalid,
+    /* 777 OP_bndcn */ rw_func_invalid,
+    /* 778 OP_bndcu */ rw_func_invalid,
+    /* 779 OP_bndldx */ rw_func_invalid,
+    /* 780 OP_bndmk */ rw_func_invalid,
+    /* 781 OP_bndmov */ rw_func_invalid,
+    /* 782 OP_bndstx */ rw_func_invalid,
+    /* 783 OP_ptwrite */ rw_func_invalid,
+    /* 784 OP_monitorx */ rw_func_invalid,
+    /* 785 OP_mwaitx */ rw_func_invalid,
+    /* 786 OP_rdpkru */ rw_func_invalid,
+    /* 787 OP_wrpkru */ rw_func_invalid,
+    /* 788 OP_encls */ rw_func_invalid,
+    /* 789 OP_enclu */ rw_func_invalid,
+    /* 790 OP_enclv */ rw_func_invalid,
+    /* 791 OP_AVX512_vpdpbusd */ rw_func_vpdpbusd,
+    /* 792 OP_AVX512_vpdpbusds */ rw_func_vpdpbusds,
+    /* 793 OP_AVX512_vpdpwssd */ rw_func_vpdpwssd,
+    /* 794 OP_AVX512_vpdpwssds */ rw_func_vpdpwssds,
+    /* 795 OP_AVX512_vcvtne2ps2bf16 */ rw_func_vcvtne2ps2bf16,
+    /* 796 OP_AVX512_vcvtneps2bf16 */ rw_func_vcvtneps2bf16,
+    /* 797 OP_AVX512_vdpbf16ps */ rw_func_vdpbf16ps,
+    /* 798 OP_AVX512_vpopcntd */ rw_func_vpopcntd,
+    /* 799 OP_AVX512_vpopcntq */ rw_func_vpopcntq,
+    /* 800 OP_clac */ rw_func_invalid,
+    /* 801 OP_stac */ rw_func_invalid,
+    /* 802 OP_xsaves32 */ rw_func_invalid,
+    /* 803 OP_xsaves64 */ rw_func_invalid,
+    /* 804 OP_xrstors32 */ rw_func_invalid,
+    /* 805 OP_xrstors64 */ rw_func_invalid,
+    /* 806 OP_gf2p8mulb */ rw_func_invalid,
+    /* 807 OP_vgf2p8mulb */ rw_func_vgf2p8mulb,
+    /* 808 OP_gf2p8affineqb */ rw_func_invalid,
+    /* 809 OP_vgf2p8affineqb */ rw_func_vgf2p8affineqb,
+    /* 810 OP_gf2p8affineinvqb */ rw_func_invalid,
+    /* 811 OP_vgf2p8affineinvqb */ rw_func_vgf2p8affineinvqb,
+    /* 812 OP_vsqrtph */ rw_func_vsqrtph,
+    /* 813 OP_vaddph */ rw_func_vaddph,
+    /* 814 OP_vmulph */ rw_func_vmulph,
+    /* 815 OP_vsubph */ rw_func_vsubph,
+    /* 816 OP_vminph */ rw_func_vminph,
+    /* 817 OP_vdivph */ rw_func_vdivph,
+    /* 818 OP_vmaxph */ rw_func_vmaxph,
+    /* 819 OP_vfmadd132ph */ rw_func_vfmadd132ph,
+    /* 820 OP_vfmadd213ph */ rw_func_vfmadd213ph,
+    /* 821 OP_vfmadd231ph */ rw_func_vfmadd231ph,
 };
 
+_Static_assert(sizeof(rewrite_funcs) / sizeof(rewrite_funcs[0]) == NUM_AVX512_INSTR_OP,
+               "rewrite_funcs must have one entry per opcode in [AVX512_FIRST_OP, AVX512_LAST_OP]");
+
 /* ======================================== *
  * rewrite functions signature
  * ======================================== */
@@ -830,6 +892,78 @@ exec_rewrite_avx512_instr(dcontext_t *dcontext, instrlist_t *ilist, instr_t *ins
     return rewrite_funcs[TO_AVX512_RWFUNC_INDEX(avx512_opcode)](dcontext, ilist, instr, instr_start);
 }
 
+static bool
+instr_uses_simd_or_opmask(instr_t *instr)
+{
+    int i, j;
+    int num_srcs = instr_num_srcs(instr);
+    for (i = 0; i < num_srcs + instr_num_dsts(instr); i++) {
+        opnd_t opnd = i < num_srcs ? instr_get_src(instr, i) : instr_get_dst(instr, i - num_srcs);
+        for (j = 0; j < opnd_num_regs_used(opnd); j++) {
+            reg_id_t reg = opnd_get_reg_used(opnd, j);
+            if (reg_is_simd(reg) || reg_is_opmask(reg))
+                return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Drop a lowering that cannot be encoded, e.g. an older one that carries an
+ *        EVEX-only xmm16-31 or ymm16-31 operand over into a VEX instr, so that the
+ *        caller hands the app instr to the interpreter instead.
+ */
+static instr_t *
+lowering_check_encodable(dcontext_t *dcontext, instr_t *first, app_pc pc)
+{
+    instr_t *instr, *next;
+    for (instr = first; instr != NULL; instr = instr_get_next(instr)) {
+        if (!instr_is_label(instr) && !instr_is_encoding_possible(instr))
+            break;
+    }
+    if (instr == NULL)
+        return first;
+#ifdef DEBUG
+    REWRITE_INFO(STD_OUTF, "lowering at %p is not encodable, interpreting it", pc);
+#endif
+    for (instr = first; instr != NULL; instr = next) {
+        next = instr_get_next(instr);
+        instr_destroy(dcontext, instr);
+    }
+    return NULL_INSTR;
+}
+
+/**
+ * @brief -avx512_native_subsets: bracket each run of instrs to be lowered with the copy
+ *        of the real AVX-512 state into TLS and back.
+ *
+ * A run goes on across instrs that touch no simd or opmask reg, and ends at the first
+ * one that does, as that may be an AVX-512 instr the host runs natively.
+ */
+static void
+sync_native_avx512_state(dcontext_t *dcontext, instrlist_t *ilist)
+{
+    instr_t *instr, *run_first = NULL, *run_last = NULL;
+    uint regs = 0;
+    for (instr = instrlist_first(ilist);; instr = instr_get_next(instr)) {
+        if (instr != NULL && instr->is_avx512_instr) {
+            if (run_first == NULL)
+                run_first = instr;
+            run_last = instr;
+            regs |= lower_instr_tls_state_regs(instr);
+            continue;
+        }
+        if (run_first != NULL && (instr == NULL || instr_uses_simd_or_opmask(instr))) {
+            lower_native_state_to_tls(dcontext, ilist, run_first, regs);
+            lower_native_state_from_tls(dcontext, ilist, instr_get_next(run_last), regs);
+            run_first = NULL;
+            regs = 0;
+        }
+        if (instr == NULL)
+            break;
+    }
+}
+
 /** @brief binary rewriting driver, single bb (which contain avx512 instrs) as granularity */
 void
 exec_rewrite_avx512_bb(dcontext_t *dcontext, instrlist_t *ilist)
@@ -838,6 +972,10 @@ exec_rewrite_avx512_bb(dcontext_t *dcontext, instrlist_t *ilist)
     // app_pc UNKNOWN = 0x0;
     instr_t *first_avx512_instr_prev = NULL;
     instr_t *last_avx512_instr_next = NULL;
+    // {er}/{sae} run state: the live MXCSR override and the last instr lowered under it
+    int mxcsr_mode = LOWER_MXCSR_NONE;
+    instr_t *mxcsr_run_last = NULL;
+    bool rewritten = false;
 
 #ifdef DEBUG
     REWRITE_DEBUG(STD_OUTF, "==== INSTRs before rewrite ====");
@@ -848,6 +986,11 @@ exec_rewrite_avx512_bb(dcontext_t *dcontext, instrlist_t *ilist)
     REWRITE_DEBUG(STD_OUTF, "==== INSTRs before rewrite END ====\n\n");
 #endif
 
+    // the chains live as long as the ilist, see rewrite_arena.c
+    rewrite_arena_enter(dcontext);
+    if (proc_avx512_enabled())
+        sync_native_avx512_state(dcontext, ilist);
+
     for (instr = ilist->first; instr != NULL; instr = next_instr) {
         next_instr = instr->next;
         if (instr->is_avx512_instr) {
@@ -859,11 +1002,77 @@ exec_rewrite_avx512_bb(dcontext_t *dcontext, instrlist_t *ilist)
                 first_avx512_instr_prev = prev_avx512_instr;
             // every iter will change this, but this will make sure that the last of last is what we need
             last_avx512_instr_next = instr->next;
-            instr_t *avx512instrs_rewritten =
-                rewrite_funcs[TO_AVX512_RWFUNC_INDEX(avx512_opcode)](dcontext, ilist, instr, instr->translation);
+            int mode = lower_instr_mxcsr_override(instr);
+            bool keeps_run = mode == LOWER_MXCSR_NONE && lower_instr_keeps_mxcsr_run(instr);
+            app_pc pc = instr->translation;
+            instr_rewrite_func_t *rw_func = rewrite_funcs[TO_AVX512_RWFUNC_INDEX(avx512_opcode)];
+            rewrite_cache_key_t cache_key;
+            instr_t *avx512instrs_rewritten = rewrite_interp_tier0(dcontext, instr, pc, rw_func != rw_func_empty);
+            bool interpreted = avx512instrs_rewritten != NULL;
+            if (interpreted) {
+                instrlist_remove(ilist, instr);
+                instr_destroy(dcontext, instr);
+            } else {
+                avx512instrs_rewritten = rewrite_cache_lookup(dcontext, instr, &cache_key);
+                if (avx512instrs_rewritten != NULL) {
+                    instrlist_remove(ilist, instr);
+                    instr_destroy(dcontext, instr);
+                } else {
+                    rewrite_template_key_t template_key;
+                    avx512instrs_rewritten = rewrite_template_lookup(dcontext, instr, &template_key);
+                    if (avx512instrs_rewritten != NULL) {
+                        instrlist_remove(ilist, instr);
+                        instr_destroy(dcontext, instr);
+                    } else {
+                        avx512instrs_rewritten =
+                            lowering_check_encodable(dcontext, rw_func(dcontext, ilist, instr, pc), pc);
+                        rewrite_template_add(dcontext, &template_key, avx512instrs_rewritten);
+                    }
+                    rewrite_cache_add(dcontext, &cache_key, avx512instrs_rewritten);
+                }
+                avx512instrs_rewritten = rewrite_helper_outline(dcontext, avx512instrs_rewritten);
+            }
+            if (avx512instrs_rewritten == NULL) {
+                // the lowering gave up, possibly leaving the app instr in place
+                if ((prev_avx512_instr == NULL ? instrlist_first(ilist) : instr_get_next(prev_avx512_instr)) !=
+                    next_instr) {
+                    instrlist_remove(ilist, instr);
+                    instr_destroy(dcontext, instr);
+                }
+                avx512instrs_rewritten = rewrite_interp_fallback(dcontext, pc);
+                interpreted = true;
+            }
+            if (interpreted) {
+                // the interpreter runs under the app MXCSR
+                mode = LOWER_MXCSR_NONE;
+                keeps_run = false;
+            }
             instrlist_postinsert(ilist, prev_avx512_instr, avx512instrs_rewritten);
+            rewritten = true;
+            // group consecutive instrs sharing an override under one MXCSR switch,
+            // going straight from one override to the next without the app value in between
+            if (mode != mxcsr_mode && !keeps_run) {
+                if (mode == LOWER_MXCSR_NONE) {
+                    lower_mxcsr_restore(dcontext, ilist, instr_get_next(mxcsr_run_last));
+                } else {
+                    lower_mxcsr_switch(dcontext, ilist,
+                                       prev_avx512_instr == NULL ? instrlist_first(ilist)
+                                                                 : instr_get_next(prev_avx512_instr),
+                                       mode, mxcsr_mode == LOWER_MXCSR_NONE);
+                }
+                mxcsr_mode = mode;
+            }
+            if (mxcsr_mode != LOWER_MXCSR_NONE && !keeps_run)
+                mxcsr_run_last = next_instr == NULL ? instrlist_last(ilist) : instr_get_prev(next_instr);
+        } else if (mxcsr_mode != LOWER_MXCSR_NONE && !lower_instr_keeps_mxcsr_run(instr)) {
+            lower_mxcsr_restore(dcontext, ilist, instr_get_next(mxcsr_run_last));
+            mxcsr_mode = LOWER_MXCSR_NONE;
         }
     }
+    if (mxcsr_mode != LOWER_MXCSR_NONE)
+        lower_mxcsr_restore(dcontext, ilist, instr_get_next(mxcsr_run_last));
+    if (rewritten && DYNAMO_OPTION(avx512_detach_quiet_ms) > 0)
+        rewrite_phase_mark_bb(dcontext, ilist);
 
     if (ilist->need_spill_simd) {
 
@@ -888,6 +1097,7 @@ exec_rewrite_avx512_bb(dcontext_t *dcontext, instrlist_t *ilist)
 #elif FINE_SPILL
 #endif /* COARSE_SPILL || FINE_SPILL */
     }
+    rewrite_arena_leave(dcontext);
 }
 
 instr_t *
@@ -900,7 +1110,7 @@ rewrite_avx512_instr(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, a
  * rewrite functions implementations
  * ======================================== */
 
-/** @brief rewrite nothing, a placeholder for unimplemented instr traslation only. */
+/** @brief rewrite nothing, a placeholder for unimplemented instr traslation only; the instr is interpreted. */
 instr_t *
 rw_func_empty(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
 {
@@ -909,10 +1119,8 @@ rw_func_empty(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc i
     instr_disassemble(dcontext, instr, STD_OUTF);
     NEWLINE(STD_OUTF);
 #endif
-    instr_t *new_instr = instr_create_0dst_0src(dcontext, OP_nop);
-    instr_disassemble(dcontext, new_instr, 1);
-    instr_destroy(dcontext, new_instr);
-    return new_instr;
+    // the caller hands the instr to the interpreter
+    return NULL_INSTR;
 }
 
 /**
@@ -8724,6 +8932,9 @@ rw_func_vpaddq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vpaddq", true, true, true, true);
 #endif
+    // memory and {1toN} sources go through the shared half-wise lowering
+    if (opnd_is_memory_reference(instr_get_src(instr, 2)))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpaddq, 8);
     reg_id_t mask_reg = opnd_get_reg(op_mask);
     reg_id_t src1_reg = opnd_get_reg(op_src1);
     reg_id_t dst_reg = opnd_get_reg(op_dst);
@@ -8738,16 +8949,6 @@ rw_func_vpaddq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
         if (IS_ZMM_REG(dst_reg)) {
             return vpaddq_zmm_reg_reg_gen(dcontext, ilist, instr, src1_reg, src2_reg, dst_reg, mask_reg);
         }
-    } else if (op_src2.kind == BASE_DISP_kind) {
-        if (IS_YMM_REG(dst_reg)) {
-            return vpaddq_ymm_mem_gen(dcontext, ilist, instr, src1_reg, op_src2, dst_reg, mask_reg);
-        }
-        if (IS_XMM_REG(dst_reg)) {
-            return vpaddq_xmm_mem_gen(dcontext, ilist, instr, src1_reg, op_src2, dst_reg, mask_reg);
-        }
-        if (IS_ZMM_REG(dst_reg)) {
-            return vpaddq_zmm_mem_gen(dcontext, ilist, instr, src1_reg, op_src2, dst_reg, mask_reg);
-        }
     }
     return NULL_INSTR;
 }
@@ -10652,6 +10853,9 @@ rw_func_vpsubb(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vpsubb", true, true, true, true);
 #endif
+    // memory and {1toN} sources go through the shared half-wise lowering
+    if (opnd_is_memory_reference(instr_get_src(instr, 2)))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpsubb, 1);
     reg_id_t mask_reg = opnd_get_reg(mask_opnd);
     reg_id_t src1_reg = opnd_get_reg(src1_opnd);
     reg_id_t src2_reg = opnd_get_reg(src2_opnd);
@@ -10661,10 +10865,8 @@ rw_func_vpsubb(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
         return vpsubb_ymm_and_ymm_gen(dcontext, ilist, instr, src1_reg, src2_reg, dst_reg, mask_reg);
     if (IS_XMM_REG(dst_reg))
         return vpsubb_xmm_and_xmm_gen(dcontext, ilist, instr, src1_reg, src2_reg, dst_reg, mask_reg);
-    if (IS_ZMM_REG(dst_reg)) {
-        REWRITE_INFO(STD_OUTF, "vpsubb zmm not implemented\n");
-        return NULL_INSTR; /* or split zmm→two ymm, like vpaddd_zmm_and_zmm_gen */
-    }
+    if (IS_ZMM_REG(dst_reg))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpsubb, 1);
     REWRITE_INFO(STD_OUTF, "vpsubb pattern not support\n");
     return NULL_INSTR;
 }
@@ -11384,6 +11586,9 @@ rw_func_vpsubw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vpsubw", true, true, true, true);
 #endif
+    // memory and {1toN} sources go through the shared half-wise lowering
+    if (opnd_is_memory_reference(instr_get_src(instr, 2)))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpsubw, 2);
     reg_id_t mask_reg = opnd_get_reg(mask_opnd);
     reg_id_t src1_reg = opnd_get_reg(src_opnd1);
     reg_id_t src2_reg = opnd_get_reg(src_opnd2);
@@ -12201,6 +12406,9 @@ rw_func_vpsubd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vpsubd", true, true, true, true);
 #endif
+    // memory and {1toN} sources go through the shared half-wise lowering
+    if (opnd_is_memory_reference(instr_get_src(instr, 2)))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpsubd, 4);
     reg_id_t mask_reg = opnd_get_reg(mask_opnd);
     reg_id_t src1_reg = opnd_get_reg(src_opnd1);
     reg_id_t src2_reg = opnd_get_reg(src_opnd2);
@@ -13520,6 +13728,9 @@ rw_func_vpsubq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vpsubq", true, true, true, true);
 #endif
+    // memory and {1toN} sources go through the shared half-wise lowering
+    if (opnd_is_memory_reference(instr_get_src(instr, 2)))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpsubq, 8);
     reg_id_t mask_reg = opnd_get_reg(mask_opnd);
     reg_id_t src1_reg = opnd_get_reg(src_opnd1);
     reg_id_t src2_reg = opnd_get_reg(src_opnd2);
@@ -14172,6 +14383,9 @@ rw_func_vpaddw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vpaddw", true, true, true, true);
 #endif
+    // memory and {1toN} sources go through the shared half-wise lowering
+    if (opnd_is_memory_reference(instr_get_src(instr, 2)))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpaddw, 2);
     reg_id_t mask_reg = opnd_get_reg(mask_opnd);
     reg_id_t src1_reg = opnd_get_reg(src_opnd1);
     reg_id_t src2_reg = opnd_get_reg(src_opnd2);
@@ -15498,6 +15712,9 @@ rw_func_vpaddd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vpaddd", true, true, true, true);
 #endif
+    // memory and {1toN} sources go through the shared half-wise lowering
+    if (opnd_is_memory_reference(instr_get_src(instr, 2)))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpaddd, 4);
     reg_id_t mask_reg = opnd_get_reg(mask_opnd);
     reg_id_t src1_reg = opnd_get_reg(src_opnd1);
     reg_id_t src2_reg = opnd_get_reg(src_opnd2);
@@ -16935,6 +17152,9 @@ rw_func_vpmulld(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vpmulld", true, true, true, true);
 #endif
+    // memory and {1toN} sources go through the shared half-wise lowering
+    if (opnd_is_memory_reference(instr_get_src(instr, 2)))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpmulld, 4);
     reg_id_t mask_reg = opnd_get_reg(mask_opnd);
     reg_id_t src1_reg = opnd_get_reg(src_opnd1);
     reg_id_t src2_reg = opnd_get_reg(src_opnd2);
@@ -17541,55 +17761,67 @@ vpbroadcastb_zmm_reg2reg_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *
     instrlist_remove(ilist, instr);
     instr_destroy(dcontext, instr);
 
-    int k_idx = TO_K_REG_INDEX(mask_reg);
-    int ymm_dst_idx = TO_YMM_REG_INDEX(dst_reg);
-    const uint dst_need_spill = NEED_SPILL_YMM(dst_reg) ? 1 : 0;
-    if (k_idx == 0) {          // no mask
-        if (!dst_need_spill) { // no spill
-            reg_id_t dst_reg_lower = ZMM_TO_YMM(dst_reg);
-            opnd_t op_dst_lower = opnd_create_reg(dst_reg_lower);
+    const uint dst_need_spill = NEED_SPILL_ZMM(dst_reg) ? 1 : 0;
 
-            // vpbroadcastb dst_lower_xmm -> dst_reg_lower
-            instr_t *i1 = instr_create_1dst_1src(dcontext, OP_vpbroadcastb, op_dst_lower, src_opnd);
-            // vmovdqu dst_reg_lower -> tls(dst_lower)
-            instr_t *i2 =
-                SAVE_SIMD_TO_SIZED_TLS(dcontext, dst_reg_lower, TLS_ZMM_idx_SLOT(TO_ZMM_REG_INDEX(dst_reg)), OPSZ_32);
-            // vmovdqu dst_reg_lower -> tls(dst_upper)
-            instr_t *i3 = SAVE_SIMD_TO_SIZED_TLS(dcontext, dst_reg_lower,
-                                                 TLS_ZMM_idx_SLOT(TO_ZMM_REG_INDEX(dst_reg)) + SIZE_OF_YMM, OPSZ_32);
+    switch (dst_need_spill) {
+    case 0: { // don't need spill
+        // the upper half lives in TLS only, so the lower ymm is stored there directly
+        reg_id_t dst_reg_lower = ZMM_TO_YMM(dst_reg);
+        opnd_t op_dst_lower = opnd_create_reg(dst_reg_lower);
+        opnd_t dst_lower_xmm = opnd_create_reg(YMM_INDEX_TO_XMM_INDEX(dst_reg_lower));
+
+        // vmovd src_opnd -> dst_lower_xmm
+        instr_t *i1 = instr_create_1dst_1src(dcontext, OP_vmovd, dst_lower_xmm, src_opnd);
+        // vpbroadcastb dst_lower_xmm -> dst_reg_lower
+        instr_t *i2 = INSTR_CREATE_vpbroadcastb(dcontext, op_dst_lower, dst_lower_xmm);
+        // vmovdqu dst_reg_lower -> tls(dst_upper)
+        instr_t *i3 = SAVE_SIMD_TO_SIZED_TLS(dcontext, dst_reg_lower,
+                                             TLS_ZMM_idx_SLOT(TO_ZMM_REG_INDEX(dst_reg)) + SIZE_OF_YMM, OPSZ_32);
 #ifdef DEBUG
-            print_rewrite_variadic_instr(dcontext, 3, i1, i2, i3);
+        print_rewrite_variadic_instr(dcontext, 3, i1, i2, i3);
 #endif
-            instrlist_concat_next_instr(ilist, 3, i1, i2, i3);
-            return i1;
-        } else { // need spill
-            reg_id_t spill_dst_reg = YMM_SPILL_SLOT0;
-            opnd_t op_ymm_spill = opnd_create_reg(spill_dst_reg);
+        instrlist_concat_next_instr(ilist, 3, i1, i2, i3);
+        return i1;
+    } break;
+    case 1: { // dst need spill
+        // %zmm17 -> <YMM_SPILL_SLOT0, YMM_SPILL_SLOT1> pair
+        reg_id_t spill_dst_lower = YMM_SPILL_SLOT0;
+        reg_id_t spill_dst_upper = YMM_SPILL_SLOT1;
+        opnd_t op_spill_dst_lower = opnd_create_reg(spill_dst_lower);
+        opnd_t op_spill_dst_upper = opnd_create_reg(spill_dst_upper);
+        opnd_t spill_dst_lower_xmm = opnd_create_reg(YMM_INDEX_TO_XMM_INDEX(spill_dst_lower));
 
-            // spill_dst_reg -> tls(spill_dst_reg)
-            instr_t *i1 = SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_dst_reg,
-                                                 TLS_ZMM_idx_SLOT(TO_YMM_REG_INDEX(spill_dst_reg)), OPSZ_32);
-            // vpbroadcastb src_opnd -> spill_dst_reg
-            instr_t *i2 = INSTR_CREATE_vpbroadcastb(dcontext, op_ymm_spill, src_opnd);
-            // ymm_opnd_spill -> tls(ymm_dst)
-            instr_t *i3 = SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_dst_reg, TLS_ZMM_idx_SLOT(ymm_dst_idx), OPSZ_32);
-            // ymm_opnd_spill -> tls(ymm_dst_upper)
-            instr_t *i4 =
-                SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_dst_reg, TLS_ZMM_idx_SLOT(ymm_dst_idx) + SIZE_OF_YMM, OPSZ_32);
-            // tls(spill_dst_reg) -> spill_dst_reg
-            instr_t *i5 = RESTORE_SIMD_FROM_SIZED_TLS(dcontext, spill_dst_reg,
-                                                      TLS_ZMM_idx_SLOT(TO_YMM_REG_INDEX(spill_dst_reg)), OPSZ_32);
+        // spill_dst_lower -> tls(spill_dst_lower)
+        instr_t *i1 = SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_dst_lower,
+                                             TLS_ZMM_idx_SLOT(TO_YMM_REG_INDEX(spill_dst_lower)), OPSZ_32);
+        // spill_dst_upper -> tls(spill_dst_upper)
+        instr_t *i2 = SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_dst_upper,
+                                             TLS_ZMM_idx_SLOT(TO_YMM_REG_INDEX(spill_dst_upper)), OPSZ_32);
+        // vmovd src_opnd -> spill_dst_lower_xmm
+        instr_t *i3 = instr_create_1dst_1src(dcontext, OP_vmovd, spill_dst_lower_xmm, src_opnd);
+        // vpbroadcastb spill_dst_lower_xmm -> spill_dst_lower
+        instr_t *i4 = INSTR_CREATE_vpbroadcastb(dcontext, op_spill_dst_lower, spill_dst_lower_xmm);
+        // vmovdqu64 spill_dst_lower -> tls(dst_lower)
+        instr_t *i5 =
+            SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_dst_lower, TLS_ZMM_idx_SLOT(TO_ZMM_REG_INDEX(dst_reg)), OPSZ_32);
+        // vmovdqu64 spill_dst_lower -> spill_dst_upper (copy lower to upper)
+        instr_t *i6 = instr_create_1dst_1src(dcontext, OP_vmovdqu, op_spill_dst_upper, op_spill_dst_lower);
+        // vmovdqu64 spill_dst_upper -> tls(dst_upper)
+        instr_t *i7 = SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_dst_upper,
+                                             TLS_ZMM_idx_SLOT(TO_ZMM_REG_INDEX(dst_reg)) + SIZE_OF_YMM, OPSZ_32);
+        // tls(spill_dst_lower) -> spill_dst_lower
+        instr_t *i8 = RESTORE_SIMD_FROM_SIZED_TLS(dcontext, spill_dst_lower,
+                                                  TLS_ZMM_idx_SLOT(TO_YMM_REG_INDEX(spill_dst_lower)), OPSZ_32);
+        // tls(spill_dst_upper) -> spill_dst_upper
+        instr_t *i9 = RESTORE_SIMD_FROM_SIZED_TLS(dcontext, spill_dst_upper,
+                                                  TLS_ZMM_idx_SLOT(TO_YMM_REG_INDEX(spill_dst_upper)), OPSZ_32);
 #ifdef DEBUG
-            print_rewrite_variadic_instr(dcontext, 5, i1, i2, i3, i4, i5);
+        print_rewrite_variadic_instr(dcontext, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
 #endif
-            instrlist_concat_next_instr(ilist, 5, i1, i2, i3, i4, i5);
-            return i1;
-        }
-    } else {                   // need mask
-        if (!dst_need_spill) { // no spill
-            // TODO: use vpcmpeqb and vpblendvb
-        } else { // need spill
-        }
+        instrlist_concat_next_instr(ilist, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
+        return i1;
+    } break;
+    default: REWRITE_ERROR(STD_ERRF, "vpbroadcastb_zmm_reg2reg_gen except 0 or 1"); return NULL_INSTR;
     }
     return NULL_INSTR;
 }
@@ -17813,29 +18045,22 @@ vpbroadcastw_zmm_reg2reg_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *
 
     switch (dst_need_spill) {
     case 0: { // don't need spill
-        // %zmm_i -> <YMM_i, find_available_ymm_spill_slot>, avoiding conflict with ymm_i
+        // the upper half lives in TLS only, so the lower ymm is stored there directly
         reg_id_t dst_reg_lower = ZMM_TO_YMM(dst_reg);
-        reg_id_t dst_reg_upper = find_available_spill_ymm_avoiding(dst_reg_lower, DR_REG_NULL, DR_REG_NULL);
         opnd_t op_dst_lower = opnd_create_reg(dst_reg_lower);
-        opnd_t op_dst_upper = opnd_create_reg(dst_reg_upper);
         opnd_t dst_lower_xmm = opnd_create_reg(YMM_INDEX_TO_XMM_INDEX(dst_reg_lower));
 
         // vmovd src_opnd -> dst_lower_xmm
         instr_t *i1 = instr_create_1dst_1src(dcontext, OP_vmovd, dst_lower_xmm, src_opnd);
         // vpbroadcastw dst_lower_xmm -> dst_reg_lower
         instr_t *i2 = INSTR_CREATE_vpbroadcastw(dcontext, op_dst_lower, dst_lower_xmm);
-        // vmovdqu dst_reg_lower -> tls(dst_lower)
-        instr_t *i3 =
-            SAVE_SIMD_TO_SIZED_TLS(dcontext, dst_reg_lower, TLS_ZMM_idx_SLOT(TO_ZMM_REG_INDEX(dst_reg)), OPSZ_32);
-        // vmovdqu dst_reg_lower -> dst_reg_upper (copy lower to upper)
-        instr_t *i4 = instr_create_1dst_1src(dcontext, OP_vmovdqu, op_dst_upper, op_dst_lower);
-        // vmovdqu dst_reg_upper -> tls(dst_upper)
-        instr_t *i5 = SAVE_SIMD_TO_SIZED_TLS(dcontext, dst_reg_upper,
+        // vmovdqu dst_reg_lower -> tls(dst_upper)
+        instr_t *i3 = SAVE_SIMD_TO_SIZED_TLS(dcontext, dst_reg_lower,
                                              TLS_ZMM_idx_SLOT(TO_ZMM_REG_INDEX(dst_reg)) + SIZE_OF_YMM, OPSZ_32);
 #ifdef DEBUG
-        print_rewrite_variadic_instr(dcontext, 5, i1, i2, i3, i4, i5);
+        print_rewrite_variadic_instr(dcontext, 3, i1, i2, i3);
 #endif
-        instrlist_concat_next_instr(ilist, 5, i1, i2, i3, i4, i5);
+        instrlist_concat_next_instr(ilist, 3, i1, i2, i3);
         return i1;
     } break;
     case 1: { // dst need spill
@@ -18180,57 +18405,67 @@ vpbroadcastd_zmm_reg2reg_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *
     instrlist_remove(ilist, instr);
     instr_destroy(dcontext, instr);
 
-    int k_idx = TO_K_REG_INDEX(mask_reg);
-    int ymm_dst_idx = TO_YMM_REG_INDEX(dst_reg);
-    const uint dst_need_spill = NEED_SPILL_YMM(dst_reg) ? 1 : 0;
-    if (k_idx == 0) {          // no mask
-        if (!dst_need_spill) { // no spill
-            reg_id_t dst_reg_lower = ZMM_TO_YMM(dst_reg);
-            opnd_t op_dst_lower = opnd_create_reg(dst_reg_lower);
-            opnd_t dst_lower_xmm = opnd_create_reg(YMM_INDEX_TO_XMM_INDEX(dst_reg_lower));
+    const uint dst_need_spill = NEED_SPILL_ZMM(dst_reg) ? 1 : 0;
 
-            // vmovd src_opnd -> dst_lower_xmm
-            instr_t *i1 = instr_create_1dst_1src(dcontext, OP_vmovd, dst_lower_xmm, src_opnd);
-            // vpbroadcastd dst_lower_xmm -> dst_reg_lower
-            instr_t *i2 = instr_create_1dst_1src(dcontext, OP_vpbroadcastd, op_dst_lower, dst_lower_xmm);
-            // vmovdqu dst_reg_lower -> tls(dst_lower)
-            instr_t *i3 =
-                SAVE_SIMD_TO_SIZED_TLS(dcontext, dst_reg_lower, TLS_ZMM_idx_SLOT(TO_ZMM_REG_INDEX(dst_reg)), OPSZ_32);
-            // vmovdqu dst_reg_upper -> tls(dst_upper)
-            instr_t *i4 = SAVE_SIMD_TO_SIZED_TLS(dcontext, dst_reg_lower,
-                                                 TLS_ZMM_idx_SLOT(TO_ZMM_REG_INDEX(dst_reg)) + SIZE_OF_YMM, OPSZ_32);
+    switch (dst_need_spill) {
+    case 0: { // don't need spill
+        // the upper half lives in TLS only, so the lower ymm is stored there directly
+        reg_id_t dst_reg_lower = ZMM_TO_YMM(dst_reg);
+        opnd_t op_dst_lower = opnd_create_reg(dst_reg_lower);
+        opnd_t dst_lower_xmm = opnd_create_reg(YMM_INDEX_TO_XMM_INDEX(dst_reg_lower));
+
+        // vmovd src_opnd -> dst_lower_xmm
+        instr_t *i1 = instr_create_1dst_1src(dcontext, OP_vmovd, dst_lower_xmm, src_opnd);
+        // vpbroadcastd dst_lower_xmm -> dst_reg_lower
+        instr_t *i2 = INSTR_CREATE_vpbroadcastd(dcontext, op_dst_lower, dst_lower_xmm);
+        // vmovdqu dst_reg_lower -> tls(dst_upper)
+        instr_t *i3 = SAVE_SIMD_TO_SIZED_TLS(dcontext, dst_reg_lower,
+                                             TLS_ZMM_idx_SLOT(TO_ZMM_REG_INDEX(dst_reg)) + SIZE_OF_YMM, OPSZ_32);
 #ifdef DEBUG
-            print_rewrite_variadic_instr(dcontext, 4, i1, i2, i3, i4);
+        print_rewrite_variadic_instr(dcontext, 3, i1, i2, i3);
 #endif
-            instrlist_concat_next_instr(ilist, 4, i1, i2, i3, i4);
-            return i1;
-        } else { // need spill
-            reg_id_t spill_dst_reg = YMM_SPILL_SLOT0;
-            opnd_t op_ymm_spill = opnd_create_reg(spill_dst_reg);
-            opnd_t op_ymm_down_mapping_spill = opnd_create_reg(XMM_SPILL_SLOT0);
-            // spill_dst_reg -> tls(spill_dst_reg)
-            instr_t *i1 = SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_dst_reg,
-                                                 TLS_ZMM_idx_SLOT(TO_YMM_REG_INDEX(spill_dst_reg)), OPSZ_32);
-            // %gpr -> %xmm_opnd
-            instr_t *i2 = INSTR_CREATE_vmovd(dcontext, op_ymm_down_mapping_spill, src_opnd);
-            // %xmm_opnd -> %ymm_opnd
-            instr_t *i3 = INSTR_CREATE_vpbroadcastd(dcontext, op_ymm_spill, op_ymm_down_mapping_spill);
-            // ymm_opnd_spill -> tls(ymm_dst)
-            instr_t *i4 = SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_dst_reg, TLS_ZMM_idx_SLOT(ymm_dst_idx), OPSZ_32);
-            // tls(spill_dst_reg) -> spill_dst_reg
-            instr_t *i5 = RESTORE_SIMD_FROM_SIZED_TLS(dcontext, spill_dst_reg,
-                                                      TLS_ZMM_idx_SLOT(TO_YMM_REG_INDEX(spill_dst_reg)), OPSZ_32);
+        instrlist_concat_next_instr(ilist, 3, i1, i2, i3);
+        return i1;
+    } break;
+    case 1: { // dst need spill
+        // %zmm17 -> <YMM_SPILL_SLOT0, YMM_SPILL_SLOT1> pair
+        reg_id_t spill_dst_lower = YMM_SPILL_SLOT0;
+        reg_id_t spill_dst_upper = YMM_SPILL_SLOT1;
+        opnd_t op_spill_dst_lower = opnd_create_reg(spill_dst_lower);
+        opnd_t op_spill_dst_upper = opnd_create_reg(spill_dst_upper);
+        opnd_t spill_dst_lower_xmm = opnd_create_reg(YMM_INDEX_TO_XMM_INDEX(spill_dst_lower));
+
+        // spill_dst_lower -> tls(spill_dst_lower)
+        instr_t *i1 = SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_dst_lower,
+                                             TLS_ZMM_idx_SLOT(TO_YMM_REG_INDEX(spill_dst_lower)), OPSZ_32);
+        // spill_dst_upper -> tls(spill_dst_upper)
+        instr_t *i2 = SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_dst_upper,
+                                             TLS_ZMM_idx_SLOT(TO_YMM_REG_INDEX(spill_dst_upper)), OPSZ_32);
+        // vmovd src_opnd -> spill_dst_lower_xmm
+        instr_t *i3 = instr_create_1dst_1src(dcontext, OP_vmovd, spill_dst_lower_xmm, src_opnd);
+        // vpbroadcastd spill_dst_lower_xmm -> spill_dst_lower
+        instr_t *i4 = INSTR_CREATE_vpbroadcastd(dcontext, op_spill_dst_lower, spill_dst_lower_xmm);
+        // vmovdqu64 spill_dst_lower -> tls(dst_lower)
+        instr_t *i5 =
+            SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_dst_lower, TLS_ZMM_idx_SLOT(TO_ZMM_REG_INDEX(dst_reg)), OPSZ_32);
+        // vmovdqu64 spill_dst_lower -> spill_dst_upper (copy lower to upper)
+        instr_t *i6 = instr_create_1dst_1src(dcontext, OP_vmovdqu, op_spill_dst_upper, op_spill_dst_lower);
+        // vmovdqu64 spill_dst_upper -> tls(dst_upper)
+        instr_t *i7 = SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_dst_upper,
+                                             TLS_ZMM_idx_SLOT(TO_ZMM_REG_INDEX(dst_reg)) + SIZE_OF_YMM, OPSZ_32);
+        // tls(spill_dst_lower) -> spill_dst_lower
+        instr_t *i8 = RESTORE_SIMD_FROM_SIZED_TLS(dcontext, spill_dst_lower,
+                                                  TLS_ZMM_idx_SLOT(TO_YMM_REG_INDEX(spill_dst_lower)), OPSZ_32);
+        // tls(spill_dst_upper) -> spill_dst_upper
+        instr_t *i9 = RESTORE_SIMD_FROM_SIZED_TLS(dcontext, spill_dst_upper,
+                                                  TLS_ZMM_idx_SLOT(TO_YMM_REG_INDEX(spill_dst_upper)), OPSZ_32);
 #ifdef DEBUG
-            print_rewrite_variadic_instr(dcontext, 5, i1, i2, i3, i4, i5);
+        print_rewrite_variadic_instr(dcontext, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
 #endif
-            instrlist_concat_next_instr(ilist, 5, i1, i2, i3, i4, i5);
-            return i1;
-        }
-    } else {                   // need mask
-        if (!dst_need_spill) { // no spill
-            // TODO: use vpcmpeqd and vpblendvb
-        } else { // need spill
-        }
+        instrlist_concat_next_instr(ilist, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
+        return i1;
+    } break;
+    default: REWRITE_ERROR(STD_ERRF, "vpbroadcastd_zmm_reg2reg_gen except 0 or 1"); return NULL_INSTR;
     }
     return NULL_INSTR;
 }
@@ -19762,6 +19997,10 @@ rw_func_vcvtusi2ss(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app
     }
 }
 
+/* zmm sources and memory destinations take the generic 128-bit lane extract */
+static instr_t *
+lane_extract128_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, uint elem_size);
+
 instr_t * /* 563 */
 rw_func_vextractf64x2(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
 {
@@ -19772,6 +20011,9 @@ rw_func_vextractf64x2(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr,
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vextractf64x2", true, true, true, true);
 #endif
+    if (IS_ZMM_REG(opnd_get_reg(src_opnd)) || !opnd_is_reg(dst_opnd)) {
+        return lane_extract128_gen(dcontext, ilist, instr, 8);
+    }
     instrlist_remove(ilist, instr);
     instr_destroy(dcontext, instr);
     reg_id_t src_reg = opnd_get_reg(src_opnd);
@@ -19834,6 +20076,9 @@ rw_func_vextracti32x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr,
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vextracti32x4", true, true, true, true);
 #endif
+    if (IS_ZMM_REG(opnd_get_reg(src_opnd)) || !opnd_is_reg(dst_opnd)) {
+        return lane_extract128_gen(dcontext, ilist, instr, 4);
+    }
     instrlist_remove(ilist, instr);
     instr_destroy(dcontext, instr);
     reg_id_t k_reg = opnd_get_reg(mask_opnd);
@@ -19983,6 +20228,9 @@ rw_func_vextracti64x2(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr,
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vextracti64x2", true, true, true, true);
 #endif
+    if (IS_ZMM_REG(opnd_get_reg(src_opnd)) || !opnd_is_reg(dst_opnd)) {
+        return lane_extract128_gen(dcontext, ilist, instr, 8);
+    }
     instrlist_remove(ilist, instr);
     instr_destroy(dcontext, instr);
     reg_id_t src_reg = opnd_get_reg(src_opnd);
@@ -20034,23 +20282,6 @@ rw_func_vextracti64x2(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr,
     return NULL_INSTR;
 }
 
-/**
- * @brief 607 vinsrti64x4
- * vinserti64x4 {%k0} $0x01 %zmm0[16byte] %xmm1 -> %zmm0
- */
-instr_t * /* 607 */
-rw_func_vinserti64x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
-{
-    instr_t *new_instr1 = instr_create_0dst_0src(dcontext, OP_nop);
-    instr_disassemble(dcontext, new_instr1, 1);
-    instrlist_remove(ilist, instr);
-    instr_destroy(dcontext, instr);
-#ifdef DEBUG
-    print_rewrite_variadic_instr(dcontext, 1, new_instr1);
-#endif
-    return new_instr1;
-}
-
 // ==============================================
 //         Helper func for vmovdqu16
 // ==============================================
@@ -20940,6 +21171,10 @@ rw_func_vmovdqu16(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vmovdqu16", true, true, false, true);
 #endif
+    // a masked load or store must not touch the memory of clear elements, which may
+    // lie on an unmapped page; the interpreter carries it out element by element
+    if (mask_reg != DR_REG_K0 && (instr_reads_memory(instr) || instr_writes_memory(instr)))
+        return NULL_INSTR;
     switch (src_opnd.kind) {
     case REG_kind: {
         reg_id_t src_reg = opnd_get_reg(src_opnd);
@@ -27734,6 +27969,10 @@ rw_func_vmovdqu8(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_p
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vmovdqu8", true, true, false, true);
 #endif
+    // a masked load or store must not touch the memory of clear elements, which may
+    // lie on an unmapped page; the interpreter carries it out element by element
+    if (mask_reg != DR_REG_K0 && (instr_reads_memory(instr) || instr_writes_memory(instr)))
+        return NULL_INSTR;
     switch (src_opnd.kind) {
     case REG_kind: {
         reg_id_t src_reg = opnd_get_reg(src_opnd);
@@ -28112,6 +28351,9 @@ rw_func_vpandd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vpandd", true, true, true, true);
 #endif
+    // memory and {1toN} sources go through the shared half-wise lowering
+    if (opnd_is_memory_reference(instr_get_src(instr, 2)))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpand, 4);
     reg_id_t mask_reg = opnd_get_reg(mask_opnd);
     reg_id_t src1_reg = opnd_get_reg(src_opnd1);
     reg_id_t src2_reg = opnd_get_reg(src_opnd2);
@@ -29398,6 +29640,9 @@ rw_func_vpandq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vpandq", true, true, true, true);
 #endif
+    // memory and {1toN} sources go through the shared half-wise lowering
+    if (opnd_is_memory_reference(instr_get_src(instr, 2)))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpand, 8);
     reg_id_t mask_reg = opnd_get_reg(mask_opnd);
     reg_id_t src1_reg = opnd_get_reg(src_opnd1);
     reg_id_t src2_reg = opnd_get_reg(src_opnd2);
@@ -38769,6 +39014,275 @@ rw_func_vpextr_(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
     return NULL_INSTR;
 }
 
+/* ==============================================
+ *      Helper func for vpmadd52luq/vpmadd52huq
+ * ============================================= */
+
+/**
+ * 52x52 -> 104-bit multiply-accumulate from vpmuludq partial products. With
+ * a = a1 * 2^26 + a0 and b = b1 * 2^26 + b0 (26-bit limbs, bits 63:52 dropped),
+ *   mid     = a1*b0 + a0*b1                                   (< 2^53)
+ *   lo_full = a0*b0 + ((mid & (2^26-1)) << 26)                (< 2^53)
+ *   lo52    = lo_full & (2^52-1)
+ *   hi52    = a1*b1 + (mid >> 26) + (lo_full >> 52)
+ * and the selected half is added to the qword accumulator in dst. Everything
+ * stays in ymm registers; the six scratch ymms are exactly enough.
+ */
+static instr_t *
+vpmadd52q_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, bool high)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t src1_opnd = instr_get_src(instr, 1);
+    opnd_t src2_opnd = instr_get_src(instr, 2);
+    opnd_t acc_opnd = instr_get_dst(instr, 0);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t m26_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t a0_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t a1_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t b0_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t b1_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t mid_reg = lower_ctx_get_scratch(&ctx);
+    opnd_t op_m26 = opnd_create_reg(m26_reg);
+    opnd_t op_a0 = opnd_create_reg(a0_reg);
+    opnd_t op_a1 = opnd_create_reg(a1_reg);
+    opnd_t op_b0 = opnd_create_reg(b0_reg);
+    opnd_t op_b1 = opnd_create_reg(b1_reg);
+    opnd_t op_mid = opnd_create_reg(mid_reg);
+
+    // vpcmpeqd m26, m26, m26 ; vpsrlq $38, m26 -> m26   ; 2^26-1 in every qword
+    lower_ctx_emit(&ctx, INSTR_CREATE_vpcmpeqd(dcontext, op_m26, op_m26, op_m26));
+    lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlq(dcontext, op_m26, OPND_CREATE_INT8(38), op_m26));
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        // split both multiplicands into 26-bit limbs
+        lower_ctx_load_half(&ctx, a0_reg, src1_opnd, half);
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlq(dcontext, op_a1, OPND_CREATE_INT8(26), op_a0));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_a0, op_a0, op_m26));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_a1, op_a1, op_m26));
+        lower_ctx_load_half(&ctx, b0_reg, src2_opnd, half);
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlq(dcontext, op_b1, OPND_CREATE_INT8(26), op_b0));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_b0, op_b0, op_m26));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_b1, op_b1, op_m26));
+        // vpmuludq mid, a1, b0 ; vpmuludq a1, a1, b1 ; vpmuludq b1, a0, b1 ; vpmuludq b0, a0, b0
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpmuludq(dcontext, op_mid, op_a1, op_b0));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpmuludq(dcontext, op_a1, op_a1, op_b1));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpmuludq(dcontext, op_b1, op_a0, op_b1));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpmuludq(dcontext, op_b0, op_a0, op_b0));
+        // vpaddq mid, mid, b1                        ; mid = a1*b0 + a0*b1
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpaddq(dcontext, op_mid, op_mid, op_b1));
+        // vpand b1, mid, m26 ; vpsllq $26, b1 -> b1 ; vpaddq b0, b0, b1   ; lo_full
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_b1, op_mid, op_m26));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpsllq(dcontext, op_b1, OPND_CREATE_INT8(26), op_b1));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpaddq(dcontext, op_b0, op_b0, op_b1));
+        reg_id_t result_reg;
+        if (high) {
+            // vpsrlq $26, mid ; vpaddq a1, a1, mid ; vpsrlq $52, b0 ; vpaddq a1, a1, b0
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlq(dcontext, op_mid, OPND_CREATE_INT8(26), op_mid));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpaddq(dcontext, op_a1, op_a1, op_mid));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlq(dcontext, op_b0, OPND_CREATE_INT8(52), op_b0));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpaddq(dcontext, op_a1, op_a1, op_b0));
+            result_reg = a1_reg;
+        } else {
+            // vpsllq $12, b0 ; vpsrlq $12, b0            ; lo_full & (2^52-1)
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsllq(dcontext, op_b0, OPND_CREATE_INT8(12), op_b0));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlq(dcontext, op_b0, OPND_CREATE_INT8(12), op_b0));
+            result_reg = b0_reg;
+        }
+        // vpaddq a0, acc, result
+        lower_ctx_load_half(&ctx, a0_reg, acc_opnd, half);
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpaddq(dcontext, op_a0, op_a0, opnd_create_reg(result_reg)));
+        lower_ctx_store_half_masked(&ctx, half, a0_reg, 8, b1_reg, mid_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+instr_t * /* 657 */
+rw_func_vpmadd52huq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpmadd52huq {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpmadd52huq", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpmadd52huq opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpmadd52q_gen(dcontext, ilist, instr, true);
+}
+
+instr_t * /* 658 */
+rw_func_vpmadd52luq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpmadd52luq {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpmadd52luq", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpmadd52luq opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpmadd52q_gen(dcontext, ilist, instr, false);
+}
+
+/* ==============================================
+ *   Helper func for vpmax/vpmin{s,u}q, vpabsq
+ * ============================================= */
+
+/**
+ * AVX2 has no qword min/max/abs, but vpcmpgtq gives a signed qword compare.
+ * Unsigned compares flip the sign bit of both operands first, min/max then
+ * pick per qword with vblendvpd (which only reads the sign bit of the compare),
+ * and abs is (x ^ s) - s with s = 0 > x.
+ */
+static instr_t *
+vpminmaxq_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, bool is_max, bool is_unsigned)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t a_opnd = instr_get_src(instr, 1);
+    opnd_t b_opnd = instr_get_src(instr, 2);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t r_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t b_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t t_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t u_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t bias_reg = is_unsigned ? lower_ctx_get_scratch(&ctx) : DR_REG_NULL;
+    opnd_t op_r = opnd_create_reg(r_reg);
+    opnd_t op_t = opnd_create_reg(t_reg);
+    if (is_unsigned) {
+        // vpcmpeqd bias, bias, bias ; vpsllq $63, bias -> bias   ; 2^63 in every qword
+        opnd_t op_bias = opnd_create_reg(bias_reg);
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpcmpeqd(dcontext, op_bias, op_bias, op_bias));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpsllq(dcontext, op_bias, OPND_CREATE_INT8(63), op_bias));
+    }
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        opnd_t op_a = opnd_create_reg(lower_ctx_src_half(&ctx, r_reg, a_opnd, half));
+        opnd_t op_b = opnd_create_reg(lower_ctx_src_half(&ctx, b_reg, b_opnd, half));
+        if (is_unsigned) {
+            // vpxor u, a, bias ; vpxor t, b, bias ; vpcmpgtq t, u, t   ; a >u b
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, opnd_create_reg(u_reg), op_a, opnd_create_reg(bias_reg)));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_t, op_b, opnd_create_reg(bias_reg)));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpcmpgtq(dcontext, op_t, opnd_create_reg(u_reg), op_t));
+        } else {
+            // vpcmpgtq t, a, b
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpcmpgtq(dcontext, op_t, op_a, op_b));
+        }
+        // max: vblendvpd r, b, a, t ; min: vblendvpd r, a, b, t
+        lower_ctx_emit(&ctx, INSTR_CREATE_vblendvpd(dcontext, op_r, is_max ? op_b : op_a, is_max ? op_a : op_b, op_t));
+        lower_ctx_store_half_masked(&ctx, half, r_reg, 8, t_reg, u_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+instr_t * /* 659 */
+rw_func_vpmaxsq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpmaxsq {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpmaxsq", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpmaxsq opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpminmaxq_gen(dcontext, ilist, instr, true, false);
+}
+
+instr_t * /* 660 */
+rw_func_vpmaxuq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpmaxuq {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpmaxuq", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpmaxuq opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpminmaxq_gen(dcontext, ilist, instr, true, true);
+}
+
+instr_t * /* 661 */
+rw_func_vpminsq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpminsq {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpminsq", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpminsq opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpminmaxq_gen(dcontext, ilist, instr, false, false);
+}
+
+instr_t * /* 662 */
+rw_func_vpminuq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpminuq {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpminuq", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpminuq opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpminmaxq_gen(dcontext, ilist, instr, false, true);
+}
+
+instr_t * /* 614 */
+rw_func_vpabsq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpabsq {%k1} %zmm1 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpabsq", true, true, true, true);
+#endif
+    if (!opnd_is_reg(instr_get_dst(instr, 0))) {
+        REWRITE_ERROR(STD_ERRF, "vpabsq opnd kind not support");
+        return NULL_INSTR;
+    }
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t src_opnd = instr_get_src(instr, 1);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t r_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t s_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t t_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t z_reg = lower_ctx_get_scratch(&ctx);
+    opnd_t op_r = opnd_create_reg(r_reg);
+    opnd_t op_t = opnd_create_reg(t_reg);
+    opnd_t op_z = opnd_create_reg(z_reg);
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        opnd_t op_s = opnd_create_reg(lower_ctx_src_half(&ctx, s_reg, src_opnd, half));
+        // vpxor z, z, z ; vpcmpgtq t, z, s   ; all-ones in negative qwords
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_z, op_z, op_z));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpcmpgtq(dcontext, op_t, op_z, op_s));
+        // vpxor r, s, t ; vpsubq r, r, t
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_r, op_s, op_t));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpsubq(dcontext, op_r, op_r, op_t));
+        lower_ctx_store_half_masked(&ctx, half, r_reg, 8, t_reg, z_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
 /* ==============================================
  *         Helper func for vpmullq
  * ============================================= */
@@ -41380,6 +41894,9 @@ rw_func_vporq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc i
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vporq", true, true, true, true);
 #endif
+    // memory and {1toN} sources go through the shared half-wise lowering
+    if (opnd_is_memory_reference(instr_get_src(instr, 2)))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpor, 8);
     reg_id_t mask_reg = opnd_get_reg(mask_opnd);
     reg_id_t src1_reg = opnd_get_reg(src_opnd1);
     reg_id_t src2_reg = opnd_get_reg(src_opnd2);
@@ -41846,6 +42363,113 @@ rw_func_vprolq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
     return NULL_INSTR;
 }
 
+/* ==============================================
+ *         Helper func for vprolvd/vprolvq
+ * ============================================= */
+
+/**
+ * AVX2 has no rotate, so the variable rotates are lowered per 256-bit half as
+ *   rol(a, n) = sllv(a, n & (w-1)) | srlv(a, -n & (w-1))
+ * (and symmetrically for ror). A zero count makes both shifts return `a`, so the
+ * result stays correct without a separate w - n constant.
+ */
+static instr_t *
+vprotv_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, bool rotate_left, uint elem_size)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t src1_opnd = instr_get_src(instr, 1);
+    opnd_t src2_opnd = instr_get_src(instr, 2);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    bool is_qword = elem_size == 8;
+    reg_id_t src_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t cnt_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t rcnt_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t wmask_reg = lower_ctx_get_scratch(&ctx);
+    opnd_t op_src = opnd_create_reg(src_reg);
+    opnd_t op_cnt = opnd_create_reg(cnt_reg);
+    opnd_t op_rcnt = opnd_create_reg(rcnt_reg);
+    opnd_t op_wmask = opnd_create_reg(wmask_reg);
+
+    // vpcmpeqd wmask, wmask, wmask ; vpsrld/q $27/$58, wmask -> wmask (w - 1 in every lane)
+    lower_ctx_emit(&ctx, INSTR_CREATE_vpcmpeqd(dcontext, op_wmask, op_wmask, op_wmask));
+    if (is_qword)
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlq(dcontext, op_wmask, OPND_CREATE_INT8(58), op_wmask));
+    else
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpsrld(dcontext, op_wmask, OPND_CREATE_INT8(27), op_wmask));
+
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        lower_ctx_load_half(&ctx, src_reg, src1_opnd, half);
+        lower_ctx_load_half(&ctx, cnt_reg, src2_opnd, half);
+        // vpand cnt, cnt, wmask                      ; n & (w-1)
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_cnt, op_cnt, op_wmask));
+        // vpxor rcnt, rcnt, rcnt ; vpsub rcnt, rcnt, cnt ; vpand rcnt, rcnt, wmask   ; -n & (w-1)
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_rcnt, op_rcnt, op_rcnt));
+        if (is_qword)
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsubq(dcontext, op_rcnt, op_rcnt, op_cnt));
+        else
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsubd(dcontext, op_rcnt, op_rcnt, op_cnt));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_rcnt, op_rcnt, op_wmask));
+        if (rotate_left) {
+            // vpsrlv rcnt, src, rcnt ; vpsllv src, src, cnt
+            if (is_qword) {
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlvq(dcontext, op_rcnt, op_src, op_rcnt));
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpsllvq(dcontext, op_src, op_src, op_cnt));
+            } else {
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlvd(dcontext, op_rcnt, op_src, op_rcnt));
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpsllvd(dcontext, op_src, op_src, op_cnt));
+            }
+        } else {
+            // vpsllv rcnt, src, rcnt ; vpsrlv src, src, cnt
+            if (is_qword) {
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpsllvq(dcontext, op_rcnt, op_src, op_rcnt));
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlvq(dcontext, op_src, op_src, op_cnt));
+            } else {
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpsllvd(dcontext, op_rcnt, op_src, op_rcnt));
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlvd(dcontext, op_src, op_src, op_cnt));
+            }
+        }
+        // vpor src, src, rcnt
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpor(dcontext, op_src, op_src, op_rcnt));
+        lower_ctx_store_half_masked(&ctx, half, src_reg, elem_size, cnt_reg, rcnt_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+instr_t * /* 694 */
+rw_func_vprolvd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vprolvd {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vprolvd", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vprolvd opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vprotv_gen(dcontext, ilist, instr, true, 4);
+}
+
+instr_t * /* 695 */
+rw_func_vprolvq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vprolvq {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vprolvq", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vprolvq opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vprotv_gen(dcontext, ilist, instr, true, 8);
+}
+
 /* ==============================================
  *         Helper func for vprord
  * ============================================= */
@@ -42481,6 +43105,38 @@ rw_func_vprorq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
     return NULL_INSTR;
 }
 
+/* ==============================================
+ *         Helper func for vprorvd/vprorvq
+ * ============================================= */
+
+instr_t * /* 698 */
+rw_func_vprorvd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vprorvd {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vprorvd", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vprorvd opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vprotv_gen(dcontext, ilist, instr, false, 4);
+}
+
+instr_t * /* 699 */
+rw_func_vprorvq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vprorvq {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vprorvq", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vprorvq opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vprotv_gen(dcontext, ilist, instr, false, 8);
+}
+
 /* ==============================================
  *         Helper func for vpscatterdd
  * ============================================= */
@@ -42748,6 +43404,231 @@ rw_func_vpscatterqq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, ap
     return NULL_INSTR;
 }
 
+/* ==============================================
+ *   Helper func for vpsllvw/vpsrlvw/vpsravw
+ * ============================================= */
+
+/**
+ * AVX2 only shifts dwords by variable counts, so each word lane is widened into its
+ * dword: even words are shifted in place (isolated from their odd neighbour where
+ * the shift direction would mix them in), odd words are shifted in the high half
+ * with the count moved down by 16, and vpblendw stitches the two back together.
+ * Dword counts >= 16 give the same zero/sign fill as the word forms.
+ */
+static instr_t *
+vpshiftvw_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, int opcode)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t src1_opnd = instr_get_src(instr, 1);
+    opnd_t src2_opnd = instr_get_src(instr, 2);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t src_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t cnt_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t zero_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t tmp1_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t tmp2_reg = lower_ctx_get_scratch(&ctx);
+    opnd_t op_src = opnd_create_reg(src_reg);
+    opnd_t op_cnt = opnd_create_reg(cnt_reg);
+    opnd_t op_zero = opnd_create_reg(zero_reg);
+    opnd_t op_tmp1 = opnd_create_reg(tmp1_reg);
+    opnd_t op_tmp2 = opnd_create_reg(tmp2_reg);
+
+    // vpxor zero, zero, zero
+    lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_zero, op_zero, op_zero));
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        lower_ctx_load_half(&ctx, src_reg, src1_opnd, half);
+        lower_ctx_load_half(&ctx, cnt_reg, src2_opnd, half);
+        // vpblendw $0xaa, zero, cnt -> tmp1          ; even counts
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpblendw(dcontext, op_tmp1, op_cnt, op_zero, OPND_CREATE_INT8((sbyte)0xaa)));
+        switch (opcode) {
+        case OP_vpsllvw:
+            // vpsllvd tmp2, src, tmp1                ; even results, low words
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsllvd(dcontext, op_tmp2, op_src, op_tmp1));
+            // vpblendw $0x55, zero, src -> tmp1      ; odd words only
+            lower_ctx_emit(&ctx,
+                           INSTR_CREATE_vpblendw(dcontext, op_tmp1, op_src, op_zero, OPND_CREATE_INT8(0x55)));
+            // vpsrld $16, cnt -> cnt                 ; odd counts
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrld(dcontext, op_cnt, OPND_CREATE_INT8(16), op_cnt));
+            // vpsllvd tmp1, tmp1, cnt                ; odd results, high words
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsllvd(dcontext, op_tmp1, op_tmp1, op_cnt));
+            break;
+        case OP_vpsrlvw:
+            // vpblendw $0xaa, zero, src -> tmp2      ; even words only
+            lower_ctx_emit(&ctx,
+                           INSTR_CREATE_vpblendw(dcontext, op_tmp2, op_src, op_zero, OPND_CREATE_INT8((sbyte)0xaa)));
+            // vpsrlvd tmp2, tmp2, tmp1               ; even results, low words
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlvd(dcontext, op_tmp2, op_tmp2, op_tmp1));
+            // vpsrld $16, cnt -> cnt ; vpsrlvd tmp1, src, cnt   ; odd results, high words
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrld(dcontext, op_cnt, OPND_CREATE_INT8(16), op_cnt));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlvd(dcontext, op_tmp1, op_src, op_cnt));
+            break;
+        case OP_vpsravw:
+            // vpslld $16, src -> tmp2 ; vpsravd tmp2, tmp2, tmp1 ; vpsrld $16, tmp2 -> tmp2
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpslld(dcontext, op_tmp2, OPND_CREATE_INT8(16), op_src));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsravd(dcontext, op_tmp2, op_tmp2, op_tmp1));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrld(dcontext, op_tmp2, OPND_CREATE_INT8(16), op_tmp2));
+            // vpsrld $16, cnt -> cnt ; vpsravd tmp1, src, cnt   ; odd results, high words
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrld(dcontext, op_cnt, OPND_CREATE_INT8(16), op_cnt));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsravd(dcontext, op_tmp1, op_src, op_cnt));
+            break;
+        default: ASSERT_NOT_REACHED();
+        }
+        // vpblendw $0xaa, tmp1, tmp2 -> tmp2         ; even from tmp2, odd from tmp1
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpblendw(dcontext, op_tmp2, op_tmp2, op_tmp1, OPND_CREATE_INT8((sbyte)0xaa)));
+        lower_ctx_store_half_masked(&ctx, half, tmp2_reg, 2, cnt_reg, tmp1_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+/* ==============================================
+ *       Helper func for vpsraq/vpsravq
+ * ============================================= */
+
+/**
+ * AVX2 lacks a 64-bit arithmetic shift. With s = (a < 0) ? ~0 : 0 from vpcmpgtq,
+ *   sra(a, n) = srl(a ^ s, n) ^ s
+ * which also yields the sign fill for counts >= 64, where vpsrlq returns zero.
+ * `cnt_opnd` is an imm8, an xmm/m128 count, or (for vpsravq) per-lane counts.
+ */
+static instr_t *
+vpsraq_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, opnd_t src_opnd, opnd_t cnt_opnd,
+           bool is_variable)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t src_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t sign_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t zero_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t cnt_reg = opnd_is_immed_int(cnt_opnd) ? DR_REG_NULL : lower_ctx_get_scratch(&ctx);
+    opnd_t op_src = opnd_create_reg(src_reg);
+    opnd_t op_sign = opnd_create_reg(sign_reg);
+    opnd_t op_zero = opnd_create_reg(zero_reg);
+    opnd_t op_cnt = opnd_create_reg(cnt_reg);
+
+    // vpxor zero, zero, zero
+    lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_zero, op_zero, op_zero));
+    if (!is_variable && !opnd_is_immed_int(cnt_opnd)) {
+        // the xmm/m128 count is shared by both halves; scratch regs are xmm already in xmm mode.
+        // The VEX shift takes the count as Wx, so op_cnt keeps the full-width name of the reg.
+        lower_ctx_load_xmm(&ctx, ctx.is_xmm ? cnt_reg : YMM_TO_XMM(cnt_reg), cnt_opnd);
+    }
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        lower_ctx_load_half(&ctx, src_reg, src_opnd, half);
+        // vpcmpgtq sign, zero, src                   ; sign = 0 > src
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpcmpgtq(dcontext, op_sign, op_zero, op_src));
+        // vpxor src, src, sign
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_src, op_src, op_sign));
+        if (is_variable) {
+            // vpsrlvq src, src, cnt
+            lower_ctx_load_half(&ctx, cnt_reg, cnt_opnd, half);
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlvq(dcontext, op_src, op_src, op_cnt));
+        } else if (opnd_is_immed_int(cnt_opnd)) {
+            // vpsrlq $imm8, src -> src
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlq(dcontext, op_src, cnt_opnd, op_src));
+        } else {
+            // vpsrlq src, %xmm_cnt -> src
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlq(dcontext, op_src, op_src, op_cnt));
+        }
+        // vpxor src, src, sign
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_src, op_src, op_sign));
+        lower_ctx_store_half_masked(&ctx, half, src_reg, 8, sign_reg, zero_reg);
+        if (ctx.mask_reg != DR_REG_NULL && half + 1 < ctx.num_halves) {
+            // zero_reg was reused as merge temp above
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_zero, op_zero, op_zero));
+        }
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+instr_t * /* 704 */
+rw_func_vpsllvw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpsllvw {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpsllvw", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpsllvw opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpshiftvw_gen(dcontext, ilist, instr, OP_vpsllvw);
+}
+
+instr_t * /* 705 */
+rw_func_vpsraq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpsraq {%k1} $0x03 %zmm1 -> %zmm0
+    // vpsraq {%k1} %zmm1 %xmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpsraq", true, true, true, true);
+#endif
+    opnd_t src1_opnd = instr_get_src(instr, 1);
+    opnd_t src2_opnd = instr_get_src(instr, 2);
+    if (!opnd_is_reg(instr_get_dst(instr, 0))) {
+        REWRITE_ERROR(STD_ERRF, "vpsraq dst opnd kind not support");
+        return NULL_INSTR;
+    }
+    if (opnd_is_immed_int(src1_opnd))
+        return vpsraq_gen(dcontext, ilist, instr, src2_opnd, src1_opnd, false);
+    return vpsraq_gen(dcontext, ilist, instr, src1_opnd, src2_opnd, false);
+}
+
+instr_t * /* 706 */
+rw_func_vpsravq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpsravq {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpsravq", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpsravq opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpsraq_gen(dcontext, ilist, instr, instr_get_src(instr, 1), instr_get_src(instr, 2), true);
+}
+
+instr_t * /* 707 */
+rw_func_vpsravw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpsravw {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpsravw", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpsravw opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpshiftvw_gen(dcontext, ilist, instr, OP_vpsravw);
+}
+
+instr_t * /* 708 */
+rw_func_vpsrlvw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpsrlvw {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpsrlvw", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpsrlvw opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpshiftvw_gen(dcontext, ilist, instr, OP_vpsrlvw);
+}
+
 /* ==============================================
  *         Helper func for vpxord
  * ============================================= */
@@ -42907,10 +43788,17 @@ rw_func_vpxord(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
 #ifdef DEBUG
     print_rewrite_info(dcontext, ilist, instr, instr_start, "vpxord", true, true, true, true);
 #endif
+    // memory and {1toN} sources go through the shared half-wise lowering
+    if (opnd_is_memory_reference(instr_get_src(instr, 2)))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpxor, 4);
     reg_id_t mask_reg = opnd_get_reg(mask_opnd);
     reg_id_t src_reg1 = opnd_get_reg(src_opnd1);
     reg_id_t src_reg2 = opnd_get_reg(src_opnd2);
     reg_id_t dst_reg = opnd_get_reg(dst_opnd);
+    // and so do the EVEX-only xmm16-31 / ymm16-31, which have no TLS-free mapping
+    if (IS_HIGH_YMM_REG(src_reg1) || IS_HIGH_YMM_REG(src_reg2) || IS_HIGH_YMM_REG(dst_reg) ||
+        IS_HIGH_XMM_REG(src_reg1) || IS_HIGH_XMM_REG(src_reg2) || IS_HIGH_XMM_REG(dst_reg))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpxor, 4);
     if (IS_ZMM_REG(src_reg1))
         return vpxord_zmm_and_zmm_gen(dcontext, ilist, instr, src_reg1, src_reg2, dst_reg, mask_reg);
     if (IS_YMM_REG(src_reg1))
@@ -43521,388 +44409,2938 @@ vpxorq_zmm_and_zmm_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr,
                                                    TLS_ZMM_idx_SLOT(TO_YMM_REG_INDEX(dst_reg_upper)), OPSZ_32);
 
 #ifdef DEBUG
-        print_rewrite_variadic_instr(dcontext, 20, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15,
-                                     i16, i17, i18, i19, i20);
+        print_rewrite_variadic_instr(dcontext, 20, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15,
+                                     i16, i17, i18, i19, i20);
+#endif
+        instrlist_concat_next_instr(ilist, 20, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15, i16,
+                                    i17, i18, i19, i20);
+        return i1;
+    } break;
+    }
+    return NULL_INSTR;
+}
+
+instr_t *
+vpxorq_ymm_and_ymm_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, reg_id_t src_reg1, reg_id_t src_reg2,
+                       reg_id_t dst_reg, reg_id_t mask_reg)
+{
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+    opnd_t src_opnd1 = create_mapping_ymm_opnd(dcontext, src_reg1);
+    opnd_t src_opnd2 = create_mapping_ymm_opnd(dcontext, src_reg2);
+    opnd_t dst_opnd = create_mapping_ymm_opnd(dcontext, dst_reg);
+
+    spill_state_t *state = &dcontext->local_state->spill_space;
+
+    int k_idx = TO_K_REG_INDEX(mask_reg);
+    if (k_idx == 0) {
+        // if k0 = 0 means no mask operation no blend, if 0x02 = 128(xmm)/64(quardword) means all elements include
+        if (state->k_regs[k_idx] == 0 || state->k_regs[k_idx] == 0x02) {
+            // vex.256 encoded version
+            instr_t *new_instr1 = instr_create_1dst_2src(dcontext, OP_vpxor, dst_opnd, src_opnd1, src_opnd2);
+#ifdef DEBUG
+            print_rewrite_variadic_instr(dcontext, 1, new_instr1);
+#endif
+            return new_instr1;
+        }
+    } else {
+        // unsigned char imm8 = rewrite_reserved_opmask[k_idx];
+    }
+    return NULL_INSTR;
+}
+
+instr_t *
+vpxorq_xmm_and_xmm_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, reg_id_t src_reg1, reg_id_t src_reg2,
+                       reg_id_t dst_reg, reg_id_t mask_reg)
+{
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+    opnd_t src_opnd1 = create_mapping_xmm_opnd(dcontext, src_reg1);
+    opnd_t src_opnd2 = create_mapping_xmm_opnd(dcontext, src_reg2);
+    opnd_t dst_opnd = create_mapping_xmm_opnd(dcontext, dst_reg);
+
+    spill_state_t *state = &dcontext->local_state->spill_space;
+
+    int k_idx = TO_K_REG_INDEX(mask_reg);
+    if (k_idx == 0) {
+        // if k0 = 0 means no mask operation no blend, if 0x02 = 128(xmm)/64(quardword) means all elements include
+        if (state->k_regs[k_idx] == 0 || state->k_regs[k_idx] == 0x02) {
+            // vex.128 encoded version
+            instr_t *new_instr1 = instr_create_1dst_2src(dcontext, OP_vpxor, dst_opnd, src_opnd1, src_opnd2);
+#ifdef DEBUG
+            print_rewrite_variadic_instr(dcontext, 1, new_instr1);
+#endif
+            return new_instr1;
+        }
+    } else {
+        // unsigned char imm8 = rewrite_reserved_opmask[k_idx];
+    }
+    // // TODO: add vpxor and vpblend, there is a problem, vpblendd don't support quadwords, only double words,
+    // // then how to make it corrdinates with vpxorq's quadword,
+    return NULL_INSTR;
+}
+
+/**
+ * @brief 720 vpxorq rewrite function
+ */
+instr_t *
+rw_func_vpxorq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    opnd_t mask_opnd = instr_get_src(instr, 0);
+    opnd_t src_opnd1 = instr_get_src(instr, 1);
+    opnd_t src_opnd2 = instr_get_src(instr, 2);
+    opnd_t dst_opnd = instr_get_dst(instr, 0);
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpxorq", true, true, true, true);
+#endif
+    // memory and {1toN} sources go through the shared half-wise lowering
+    if (opnd_is_memory_reference(instr_get_src(instr, 2)))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpxor, 8);
+    reg_id_t mask_reg = opnd_get_reg(mask_opnd);
+    reg_id_t src_reg1 = opnd_get_reg(src_opnd1);
+    reg_id_t src_reg2 = opnd_get_reg(src_opnd2);
+    reg_id_t dst_reg = opnd_get_reg(dst_opnd);
+    // and so do the EVEX-only xmm16-31 / ymm16-31, which have no TLS-free mapping
+    if (IS_HIGH_YMM_REG(src_reg1) || IS_HIGH_YMM_REG(src_reg2) || IS_HIGH_YMM_REG(dst_reg) ||
+        IS_HIGH_XMM_REG(src_reg1) || IS_HIGH_XMM_REG(src_reg2) || IS_HIGH_XMM_REG(dst_reg))
+        return lower_binop_gen(dcontext, ilist, instr, OP_vpxor, 8);
+    if (IS_ZMM_REG(src_reg1))
+        return vpxorq_zmm_and_zmm_gen(dcontext, ilist, instr, src_reg1, src_reg2, dst_reg, mask_reg);
+    if (IS_YMM_REG(src_reg1))
+        return vpxorq_ymm_and_ymm_gen(dcontext, ilist, instr, src_reg1, src_reg2, dst_reg, mask_reg);
+    if (IS_XMM_REG(src_reg1))
+        return vpxorq_xmm_and_xmm_gen(dcontext, ilist, instr, src_reg1, src_reg2, dst_reg, mask_reg);
+    REWRITE_INFO(STD_OUTF, "vpxorq pattern not support");
+    return NULL_INSTR;
+}
+
+instr_t * /* 738 */
+rw_func_vrndscaleps(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vrndscaleps {%k0} $0x00 %ymm4 -> %ymm4
+    // opnd_t mask_opnd = instr_get_src(instr, 0);
+    opnd_t imm8_opnd = instr_get_src(instr, 1);
+    opnd_t src_opnd = instr_get_src(instr, 2); // src2 can be reg/mem
+    opnd_t dst_opnd = instr_get_dst(instr, 0);
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vrndscaleps", true, true, true, true);
+#endif
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    int imm8 = opnd_get_immed_int(imm8_opnd);
+    if (imm8 == 0x0) {
+        instr_t *i1 = INSTR_CREATE_vroundps(dcontext, dst_opnd, src_opnd, opnd_create_immed_int(0x00, OPSZ_1));
+#ifdef DEBUG
+        print_rewrite_variadic_instr(dcontext, 1, i1);
+#endif
+        return i1;
+    }
+    return NULL_INSTR;
+}
+
+instr_t * /* 740 */
+rw_func_vrndscaless(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vrndscaless {%k0} $0x09 %xmm0[12byte] %xmm0[4byte] -> %xmm0
+    // opnd_t mask_opnd = instr_get_src(instr, 0);
+    opnd_t src2_opnd = instr_get_src(instr, 2);
+    opnd_t src3_opnd = instr_get_src(instr, 3); // src3 can be reg/mem
+    opnd_t dst_opnd = instr_get_dst(instr, 0);
+#ifdef DEBUG
+    opnd_t src1_opnd = instr_get_src(instr, 1);
+    REWRITE_INFO(STD_OUTF, "rewrite %s at %p :", "vrndscaless", instr_start);
+    instr_disassemble(dcontext, instr, STD_OUTF);
+    NEWLINE(STD_OUTF);
+    // dr_print_opnd(dcontext, STD_OUTF, mask_opnd, "mask:");
+    dr_print_opnd(dcontext, STD_OUTF, src1_opnd, "src1:");
+    dr_print_opnd(dcontext, STD_OUTF, src2_opnd, "src2:");
+    dr_print_opnd(dcontext, STD_OUTF, src3_opnd, "src3:");
+    dr_print_opnd(dcontext, STD_OUTF, dst_opnd, "dst:");
+#endif
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t src2_xmm = opnd_get_reg(src2_opnd);
+    reg_id_t src3_xmm = opnd_get_reg(src3_opnd);
+    reg_id_t dst_xmm = opnd_get_reg(dst_opnd);
+    src2_opnd = opnd_create_reg(src2_xmm);
+    src3_opnd = opnd_create_reg(src3_xmm);
+    dst_opnd = opnd_create_reg(dst_xmm);
+    if (src2_xmm == src3_xmm && src3_xmm == dst_xmm) {
+        reg_id_t spill_xmm_reg = find_one_available_spill_xmm(src2_xmm);
+        opnd_t spill_xmm_opnd = opnd_create_reg(spill_xmm_reg);
+        reg_id_t rax_reg = DR_REG_RAX;
+        reg_id_t eax_reg = DR_REG_EAX;
+        opnd_t rax_opnd = opnd_create_reg(rax_reg);
+        opnd_t eax_opnd = opnd_create_reg(eax_reg);
+        // spill_xmm_reg -> tls_slot(spill_xmm_reg)
+        instr_t *i1 =
+            SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_xmm_reg, TLS_ZMM_idx_SLOT(TO_XMM_REG_INDEX(spill_xmm_reg)), OPSZ_16);
+        // push %rax
+        instr_t *i2 = INSTR_CREATE_push(dcontext, rax_opnd);
+        // extractps $3, %xmm0 %eax
+        instr_t *i3 = INSTR_CREATE_extractps(dcontext, eax_opnd, src3_opnd, opnd_create_immed_int(3, OPSZ_1));
+        // movd %rax, %spill_xmm_reg
+        instr_t *i4 = INSTR_CREATE_movd(dcontext, spill_xmm_opnd, eax_opnd);
+        // vbroadcastss %spill_xmm_reg, %spill_xmm_reg
+        instr_t *i5 = INSTR_CREATE_vbroadcastss(dcontext, spill_xmm_opnd, spill_xmm_opnd);
+        // pop %rax
+        instr_t *i6 = INSTR_CREATE_pop(dcontext, rax_opnd);
+        // vroundss $0x09, spill_xmm_reg, spill_xmm_reg -> spill_xmm_reg
+        instr_t *i7 = INSTR_CREATE_vroundss(dcontext, spill_xmm_opnd, spill_xmm_opnd, spill_xmm_opnd,
+                                            opnd_create_immed_int(0x09, OPSZ_1));
+        // vinsertps $0x10, src2[12byte], spill_xmm_reg -> dst[16byte]
+        instr_t *i8 =
+            INSTR_CREATE_vinsertps(dcontext, dst_opnd, opnd_create_immed_int(0x00, OPSZ_1), src2_opnd, spill_xmm_opnd);
+        // tls_slot(spill_xmm_reg) -> spill_xmm_reg
+        instr_t *i9 = RESTORE_SIMD_FROM_SIZED_TLS(dcontext, spill_xmm_reg,
+                                                  TLS_ZMM_idx_SLOT(TO_XMM_REG_INDEX(spill_xmm_reg)), OPSZ_16);
+#ifdef DEBUG
+        print_rewrite_variadic_instr(dcontext, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
+#endif
+        instrlist_concat_next_instr(ilist, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
+        return i1;
+    } else { // not all the three operands are same registers
+        if (src2_xmm == dst_xmm) {
+            // vrndscaless {%k0} $0x09 %xmm2[12byte] %xmm1[4byte] -> %xmm2[16byte] | onlye 4 byte are changed
+            //                    src1  src2          src3            dst
+            reg_id_t spill_xmm_reg = find_available_spill_xmm_avoiding(src2_xmm, dst_xmm, DR_REG_NULL);
+            opnd_t spill_xmm_opnd = opnd_create_reg(spill_xmm_reg);
+            reg_id_t rax_reg = DR_REG_RAX;
+            reg_id_t eax_reg = DR_REG_EAX;
+            opnd_t rax_opnd = opnd_create_reg(rax_reg);
+            opnd_t eax_opnd = opnd_create_reg(eax_reg);
+            // spill_xmm_reg -> tls_slot(spill_xmm_reg)
+            instr_t *i1 = SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_xmm_reg,
+                                                 TLS_ZMM_idx_SLOT(TO_XMM_REG_INDEX(spill_xmm_reg)), OPSZ_16);
+            // push %rax
+            instr_t *i2 = INSTR_CREATE_push(dcontext, rax_opnd);
+            // extractps $3, %xmm0 %eax
+            instr_t *i3 = INSTR_CREATE_extractps(dcontext, eax_opnd, src3_opnd, opnd_create_immed_int(3, OPSZ_1));
+            // movd %rax, %spill_xmm_reg
+            instr_t *i4 = INSTR_CREATE_movd(dcontext, spill_xmm_opnd, eax_opnd);
+            // vbroadcastss %spill_xmm_reg, %spill_xmm_reg
+            instr_t *i5 = INSTR_CREATE_vbroadcastss(dcontext, spill_xmm_opnd, spill_xmm_opnd);
+            // pop %rax
+            instr_t *i6 = INSTR_CREATE_pop(dcontext, rax_opnd);
+            // vroundss $0x09, spill_xmm_reg, spill_xmm_reg -> spill_xmm_reg
+            instr_t *i7 = INSTR_CREATE_vroundss(dcontext, spill_xmm_opnd, spill_xmm_opnd, spill_xmm_opnd,
+                                                opnd_create_immed_int(0x09, OPSZ_1));
+            // vinsertps $0x10, src2[12byte], spill_xmm_reg -> dst[16byte]
+            instr_t *i8 = INSTR_CREATE_vinsertps(dcontext, dst_opnd, opnd_create_immed_int(0x00, OPSZ_1), src2_opnd,
+                                                 spill_xmm_opnd);
+            // tls_slot(spill_xmm_reg) -> spill_xmm_reg
+            instr_t *i9 = RESTORE_SIMD_FROM_SIZED_TLS(dcontext, spill_xmm_reg,
+                                                      TLS_ZMM_idx_SLOT(TO_XMM_REG_INDEX(spill_xmm_reg)), OPSZ_16);
+#ifdef DEBUG
+            print_rewrite_variadic_instr(dcontext, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
+#endif
+            instrlist_concat_next_instr(ilist, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
+            return i1;
+        }
+        reg_id_t spill_xmm_reg = find_available_spill_xmm_avoiding_variadic(3, src2_xmm, src3_xmm, dst_xmm);
+        opnd_t spill_xmm_opnd = opnd_create_reg(spill_xmm_reg);
+        reg_id_t rax_reg = DR_REG_RAX;
+        reg_id_t eax_reg = DR_REG_EAX;
+        opnd_t rax_opnd = opnd_create_reg(rax_reg);
+        opnd_t eax_opnd = opnd_create_reg(eax_reg);
+        // spill_xmm_reg -> tls_slot(spill_xmm_reg)
+        instr_t *i1 =
+            SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_xmm_reg, TLS_ZMM_idx_SLOT(TO_XMM_REG_INDEX(spill_xmm_reg)), OPSZ_16);
+        // push %rax
+        instr_t *i2 = INSTR_CREATE_push(dcontext, rax_opnd);
+        // extractps $3, %xmm0 %eax
+        instr_t *i3 = INSTR_CREATE_extractps(dcontext, eax_opnd, src3_opnd, opnd_create_immed_int(3, OPSZ_1));
+        // movd %rax, %spill_xmm_reg
+        instr_t *i4 = INSTR_CREATE_movd(dcontext, spill_xmm_opnd, eax_opnd);
+        // vbroadcastss %spill_xmm_reg, %spill_xmm_reg
+        instr_t *i5 = INSTR_CREATE_vbroadcastss(dcontext, spill_xmm_opnd, spill_xmm_opnd);
+        // pop %rax
+        instr_t *i6 = INSTR_CREATE_pop(dcontext, rax_opnd);
+        // vroundss $0x09, spill_xmm_reg, spill_xmm_reg -> spill_xmm_reg
+        instr_t *i7 = INSTR_CREATE_vroundss(dcontext, spill_xmm_opnd, spill_xmm_opnd, spill_xmm_opnd,
+                                            opnd_create_immed_int(0x09, OPSZ_1));
+        // vinsertps $0x10, src2[12byte], spill_xmm_reg -> dst[16byte]
+        instr_t *i8 =
+            INSTR_CREATE_vinsertps(dcontext, dst_opnd, opnd_create_immed_int(0x00, OPSZ_1), src2_opnd, spill_xmm_opnd);
+        // tls_slot(spill_xmm_reg) -> spill_xmm_reg
+        instr_t *i9 = RESTORE_SIMD_FROM_SIZED_TLS(dcontext, spill_xmm_reg,
+                                                  TLS_ZMM_idx_SLOT(TO_XMM_REG_INDEX(spill_xmm_reg)), OPSZ_16);
+#ifdef DEBUG
+        print_rewrite_variadic_instr(dcontext, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
+#endif
+        instrlist_concat_next_instr(ilist, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
+        return i1;
+    }
+    return NULL_INSTR;
+}
+
+instr_t * /* 779 */
+rw_func_vrndscalesd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vrndscalesd {%k0} $0x09 %xmm0[8byte] 0xffffffa0(%rbp)[8byte] -> %xmm0
+    // opnd_t mask_opnd = instr_get_src(instr, 0);
+    opnd_t src_opnd1 = instr_get_src(instr, 1);
+    opnd_t src_opnd2 = instr_get_src(instr, 2);
+    opnd_t src_opnd3 = instr_get_src(instr, 3); // src3 can be reg/mem
+    opnd_t dst_opnd = instr_get_dst(instr, 0);
+#ifdef DEBUG
+    REWRITE_INFO(STD_OUTF, "rewrite %s at %p :", "vrndscalesd", instr_start);
+    instr_disassemble(dcontext, instr, STD_OUTF);
+    NEWLINE(STD_OUTF);
+    // dr_print_opnd(dcontext, STD_OUTF, mask_opnd, "mask:");
+    dr_print_opnd(dcontext, STD_OUTF, src_opnd1, "src1:");
+    dr_print_opnd(dcontext, STD_OUTF, src_opnd2, "src2:");
+    dr_print_opnd(dcontext, STD_OUTF, src_opnd3, "src3:");
+    dr_print_opnd(dcontext, STD_OUTF, dst_opnd, "dst:");
+#endif
+    // TODO: change into VEX.LIG.66.0F3A.WIG 0B /r ib VROUNDSD xmm1, xmm2, xmm3/m64, imm8
+    ptr_int_t imm8 = opnd_get_immed_int(src_opnd1);
+    reg_id_t src_reg1 = opnd_get_reg(src_opnd2);
+    reg_id_t dst_reg = opnd_get_reg(dst_opnd);
+    if (src_opnd3.kind == REG_kind) {
+        reg_id_t src_reg2 = opnd_get_reg(src_opnd3);
+        instr_t *new_instr1 =
+            instr_create_1dst_3src(dcontext, OP_vroundsd, create_mapping_xmm_opnd(dcontext, dst_reg),
+                                   create_mapping_xmm_opnd(dcontext, src_reg1),
+                                   create_mapping_xmm_opnd(dcontext, src_reg2), opnd_create_immed_int(imm8, OPSZ_1));
+#ifdef DEBUG
+        print_rewrite_variadic_instr(dcontext, 1, new_instr1);
+#endif
+        instrlist_remove(ilist, instr);
+        instr_destroy(dcontext, instr);
+        return new_instr1;
+    }
+    if (src_opnd3.kind == BASE_DISP_kind) {
+        // mem
+        instr_t *new_instr1 = instr_create_1dst_3src(dcontext, OP_vroundsd, create_mapping_xmm_opnd(dcontext, dst_reg),
+                                                     create_mapping_xmm_opnd(dcontext, src_reg1), src_opnd3,
+                                                     opnd_create_immed_int(imm8, OPSZ_1));
+#ifdef DEBUG
+        print_rewrite_variadic_instr(dcontext, 1, new_instr1);
+#endif
+        instrlist_remove(ilist, instr);
+        instr_destroy(dcontext, instr);
+        return new_instr1;
+    }
+    return NULL_INSTR;
+}
+
+/* =======================================================
+ *          AVX512 VNNI instr rewrite functions
+ * ======================================================= */
+
+/**
+ * VNNI dot products are lowered per 256-bit half. For the byte forms the u8/s8
+ * operands are widened inside each word (zero- resp. sign-extended even and odd
+ * bytes) so that two vpmaddwd give the exact four-product sum; vpmaddubsw would
+ * saturate its word pairs. The word forms are a single vpmaddwd. The `s` forms
+ * add to the accumulator with signed dword saturation: overflow is
+ * (r ^ acc) & (r ^ p) and the saturated value is (acc >> 31) ^ 0x7fffffff.
+ * vpmaddwd wraps only for two -32768*-32768 products (sum 2^31), which shows up
+ * as a lane whose vpabsd stays negative; there overflow means acc >= 0.
+ */
+static instr_t *
+vpdp_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, bool is_byte, bool saturate)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t src1_opnd = instr_get_src(instr, 1);
+    opnd_t src2_opnd = instr_get_src(instr, 2);
+    opnd_t acc_opnd = instr_get_dst(instr, 0);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t a_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t b_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t t_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t u_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t v_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t c_reg = saturate ? lower_ctx_get_scratch(&ctx) : DR_REG_NULL;
+    opnd_t op_a = opnd_create_reg(a_reg);
+    opnd_t op_b = opnd_create_reg(b_reg);
+    opnd_t op_t = opnd_create_reg(t_reg);
+    opnd_t op_u = opnd_create_reg(u_reg);
+    opnd_t op_v = opnd_create_reg(v_reg);
+    opnd_t op_c = opnd_create_reg(c_reg);
+
+    if (saturate) {
+        // vpcmpeqd c, c, c ; vpsrld $1, c -> c          ; 0x7fffffff
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpcmpeqd(dcontext, op_c, op_c, op_c));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpsrld(dcontext, op_c, OPND_CREATE_INT8(1), op_c));
+    }
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        lower_ctx_load_half(&ctx, a_reg, src1_opnd, half);
+        lower_ctx_load_half(&ctx, b_reg, src2_opnd, half);
+        if (is_byte) {
+            // vpsrlw $8, a -> t ; vpsllw $8, a -> a ; vpsrlw $8, a -> a   ; odd/even u8 as words
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlw(dcontext, op_t, OPND_CREATE_INT8(8), op_a));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsllw(dcontext, op_a, OPND_CREATE_INT8(8), op_a));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrlw(dcontext, op_a, OPND_CREATE_INT8(8), op_a));
+            // vpsraw $8, b -> u ; vpsllw $8, b -> b ; vpsraw $8, b -> b   ; odd/even s8 as words
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsraw(dcontext, op_u, OPND_CREATE_INT8(8), op_b));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsllw(dcontext, op_b, OPND_CREATE_INT8(8), op_b));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsraw(dcontext, op_b, OPND_CREATE_INT8(8), op_b));
+            // vpmaddwd a, a, b ; vpmaddwd t, t, u ; vpaddd a, a, t     ; p = sum of 4 products
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpmaddwd(dcontext, op_a, op_a, op_b));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpmaddwd(dcontext, op_t, op_t, op_u));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpaddd(dcontext, op_a, op_a, op_t));
+        } else {
+            // vpmaddwd a, a, b                           ; p = sum of 2 products
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpmaddwd(dcontext, op_a, op_a, op_b));
+        }
+        // acc -> b ; vpaddd t, b, a                     ; r = acc + p
+        lower_ctx_load_half(&ctx, b_reg, acc_opnd, half);
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpaddd(dcontext, op_t, op_b, op_a));
+        if (saturate) {
+            // vpxor u, t, b ; vpxor v, t, a ; vpand u, u, v    ; overflow in sign bits
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_u, op_t, op_b));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_v, op_t, op_a));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_u, op_u, op_v));
+            if (!is_byte) {
+                // vpabsd v, a ; vpsrad $31, v -> v           ; lanes where p wrapped to 2^31
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpabsd(dcontext, op_v, op_a));
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpsrad(dcontext, op_v, OPND_CREATE_INT8(31), op_v));
+                // vpandn a, b, v ; vpblendvb u, u, a, v      ; overflow there iff acc >= 0
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpandn(dcontext, op_a, op_b, op_v));
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpblendvb(dcontext, op_u, op_u, op_a, op_v));
+            }
+            // vpsrad $31, b -> a ; vpxor a, a, c            ; saturated value
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrad(dcontext, op_a, OPND_CREATE_INT8(31), op_b));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_a, op_a, op_c));
+            // vblendvps t, t, a, u
+            lower_ctx_emit(&ctx, INSTR_CREATE_vblendvps(dcontext, op_t, op_t, op_a, op_u));
+        }
+        lower_ctx_store_half_masked(&ctx, half, t_reg, 4, u_reg, v_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+instr_t * /* 791 */
+rw_func_vpdpbusd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpdpbusd {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpdpbusd", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpdpbusd opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpdp_gen(dcontext, ilist, instr, true, false);
+}
+
+instr_t * /* 792 */
+rw_func_vpdpbusds(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpdpbusds {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpdpbusds", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpdpbusds opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpdp_gen(dcontext, ilist, instr, true, true);
+}
+
+instr_t * /* 793 */
+rw_func_vpdpwssd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpdpwssd {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpdpwssd", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpdpwssd opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpdp_gen(dcontext, ilist, instr, false, false);
+}
+
+instr_t * /* 794 */
+rw_func_vpdpwssds(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpdpwssds {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpdpwssds", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpdpwssds opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpdp_gen(dcontext, ilist, instr, false, true);
+}
+
+/* =======================================================
+ *        AVX512 VPOPCNTDQ instr rewrite functions
+ * ======================================================= */
+
+/* vpshufb is in-lane, so the 16-entry tables are repeated for both lanes */
+static const byte popcnt_nibble_lut[32] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+static const byte popcnt_nibble_mask[32] = { 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+                                             0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+                                             0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f };
+static const byte popcnt_ones_bytes[32] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                                            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const ushort popcnt_ones_words[16] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+
+/**
+ * @brief Replace every byte of `x_reg` by its popcount (nibble-table vpshufb).
+ *
+ * `lut_reg` must already hold popcnt_nibble_lut; `tmp_reg` is clobbered.
+ */
+static void
+emit_popcnt_bytes(lower_ctx_t *ctx, reg_id_t x_reg, reg_id_t lut_reg, reg_id_t tmp_reg)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    opnd_t op_x = opnd_create_reg(x_reg);
+    opnd_t op_lut = opnd_create_reg(lut_reg);
+    opnd_t op_tmp = opnd_create_reg(tmp_reg);
+    // vpsrlw $4, x -> tmp ; vpand tmp, tmp, 0x0f.. ; vpand x, x, 0x0f..   ; high/low nibbles
+    lower_ctx_emit(ctx, INSTR_CREATE_vpsrlw(dcontext, op_tmp, OPND_CREATE_INT8(4), op_x));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_tmp, op_tmp, lower_ctx_const_opnd(ctx, popcnt_nibble_mask)));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_x, op_x, lower_ctx_const_opnd(ctx, popcnt_nibble_mask)));
+    // vpshufb x, lut, x ; vpshufb tmp, lut, tmp ; vpaddb x, x, tmp
+    lower_ctx_emit(ctx, INSTR_CREATE_vpshufb(dcontext, op_x, op_lut, op_x));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpshufb(dcontext, op_tmp, op_lut, op_tmp));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpaddb(dcontext, op_x, op_x, op_tmp));
+}
+
+/**
+ * Byte counts are folded horizontally: vpsadbw against zero sums the eight bytes
+ * of each qword, vpmaddubsw + vpmaddwd with all-ones multipliers sum the four
+ * bytes of each dword.
+ */
+static instr_t *
+vpopcnt_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, uint elem_size)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t src_opnd = instr_get_src(instr, 1);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t x_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t lut_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t tmp_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t tmp2_reg = lower_ctx_get_scratch(&ctx);
+    opnd_t op_x = opnd_create_reg(x_reg);
+    opnd_t op_tmp = opnd_create_reg(tmp_reg);
+
+    lower_ctx_emit(&ctx,
+                   INSTR_CREATE_vmovdqu(dcontext, opnd_create_reg(lut_reg), lower_ctx_const_opnd(&ctx, popcnt_nibble_lut)));
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        lower_ctx_load_half(&ctx, x_reg, src_opnd, half);
+        emit_popcnt_bytes(&ctx, x_reg, lut_reg, tmp_reg);
+        if (elem_size == 8) {
+            // vpxor tmp, tmp, tmp ; vpsadbw x, x, tmp
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_tmp, op_tmp, op_tmp));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsadbw(dcontext, op_x, op_x, op_tmp));
+        } else {
+            // vpmaddubsw x, x, 0x01.. ; vpmaddwd x, x, 0x0001..
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpmaddubsw(dcontext, op_x, op_x,
+                                                         lower_ctx_const_opnd(&ctx, popcnt_ones_bytes)));
+            lower_ctx_emit(&ctx,
+                           INSTR_CREATE_vpmaddwd(dcontext, op_x, op_x, lower_ctx_const_opnd(&ctx, popcnt_ones_words)));
+        }
+        lower_ctx_store_half_masked(&ctx, half, x_reg, elem_size, tmp_reg, tmp2_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+instr_t * /* 798 */
+rw_func_vpopcntd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpopcntd {%k1} %zmm1 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpopcntd", true, true, false, true);
+#endif
+    if (!opnd_is_reg(instr_get_dst(instr, 0))) {
+        REWRITE_ERROR(STD_ERRF, "vpopcntd dst opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpopcnt_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 799 */
+rw_func_vpopcntq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpopcntq {%k1} %zmm1 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpopcntq", true, true, false, true);
+#endif
+    if (!opnd_is_reg(instr_get_dst(instr, 0))) {
+        REWRITE_ERROR(STD_ERRF, "vpopcntq dst opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vpopcnt_gen(dcontext, ilist, instr, 8);
+}
+
+/* =======================================================
+ *     AVX512 compress/expand instr rewrite functions
+ * ======================================================= */
+
+/**
+ * Compress/expand is lowered with vpermd, whose dword indices are looked up by
+ * opmask byte. Every row holds 8 dword lanes, qword lanes are dword pairs. For
+ * a zmm the two halves are stitched together by rotating the high half by
+ * p0 = popcnt(half 0 mask) lanes, which is a third row indexed by the same byte.
+ */
+typedef uint compress_row_t[8];
+typedef struct _compress_lut_t {
+    compress_row_t perm_d[256];   /* compress: set lanes gathered to the front */
+    compress_row_t exp_d[256];    /* expand: lane i takes element popcnt(m & ((1 << i) - 1)) */
+    compress_row_t len_d[256];    /* all-ones for the first popcnt(m) lanes */
+    compress_row_t rot_d[256];    /* (i - p0) & 7 */
+    compress_row_t rotinv_d[256]; /* (i + p0) & 7 */
+    compress_row_t wrap_d[256];   /* all-ones where i + p0 >= 8 */
+    /* qword rows take bits 0-3 (half 0) or 4-7 (half 1) of the same byte */
+    compress_row_t perm_q[2][256];
+    compress_row_t exp_q[2][256];
+    compress_row_t len_q[2][256];
+    compress_row_t rot_q[256];
+    compress_row_t rotinv_q[256];
+    compress_row_t wrap_q[256];
+} compress_lut_t;
+
+static compress_lut_t compress_lut;
+
+#define COMPRESS_LUT_OFFS(field, elem_size, half)                                                                   \
+    ((elem_size) == 4 ? offsetof(compress_lut_t, field##_d)                                                        \
+                      : offsetof(compress_lut_t, field##_q) + (half) * sizeof(compress_lut.field##_q[0]))
+
+static uint
+compress_popcnt8(uint m)
+{
+    uint n = 0;
+    for (; m != 0; m &= m - 1)
+        n++;
+    return n;
+}
+
+static void
+compress_fill_rows(compress_row_t *perm, compress_row_t *exp, compress_row_t *len, uint m, uint lanes,
+                   uint lane_dwords)
+{
+    uint pos = 0;
+    for (uint i = 0; i < lanes; i++) {
+        if (!TEST(1 << i, m))
+            continue;
+        for (uint j = 0; j < lane_dwords; j++) {
+            (*perm)[pos * lane_dwords + j] = i * lane_dwords + j;
+            (*exp)[i * lane_dwords + j] = pos * lane_dwords + j;
+            (*len)[pos * lane_dwords + j] = 0xffffffff;
+        }
+        pos++;
+    }
+}
+
+static void
+compress_fill_rot(compress_row_t *rot, compress_row_t *rotinv, compress_row_t *wrap, uint p0)
+{
+    for (uint i = 0; i < 8; i++) {
+        (*rot)[i] = (i - p0) & 7;
+        (*rotinv)[i] = (i + p0) & 7;
+        (*wrap)[i] = i + p0 >= 8 ? 0xffffffff : 0;
+    }
+}
+
+static void
+compress_lut_init(void)
+{
+    memset(&compress_lut, 0, sizeof(compress_lut));
+    for (uint m = 0; m < 256; m++) {
+        compress_fill_rows(&compress_lut.perm_d[m], &compress_lut.exp_d[m], &compress_lut.len_d[m], m, 8, 1);
+        compress_fill_rot(&compress_lut.rot_d[m], &compress_lut.rotinv_d[m], &compress_lut.wrap_d[m],
+                          compress_popcnt8(m));
+        for (uint half = 0; half < 2; half++) {
+            compress_fill_rows(&compress_lut.perm_q[half][m], &compress_lut.exp_q[half][m],
+                               &compress_lut.len_q[half][m], (m >> (half * 4)) & 0xf, 4, 2);
+        }
+        compress_fill_rot(&compress_lut.rot_q[m], &compress_lut.rotinv_q[m], &compress_lut.wrap_q[m],
+                          compress_popcnt8(m & 0xf) * 2);
+    }
+}
+
+/**
+ * @brief Scaled opmask byte -> `idx_gpr` (movzx/lea, eflags untouched).
+ *
+ * Dword forms use opmask byte `half`; qword forms have all 8 lanes in byte 0.
+ * An unmasked instr selects every lane.
+ */
+static void
+compress_load_mask_index(lower_ctx_t *ctx, reg_id_t idx_gpr, uint elem_size, uint half)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    opnd_t op_idx32 = opnd_create_reg(reg_64_to_32(idx_gpr));
+    if (ctx->mask_reg == DR_REG_NULL) {
+        lower_ctx_emit(ctx, INSTR_CREATE_mov_imm(dcontext, op_idx32, OPND_CREATE_INT32(0xff)));
+    } else {
+        ushort k_slot = TLS_K_idx_SLOT(TO_K_REG_INDEX(ctx->mask_reg)) + (elem_size == 4 ? half : 0);
+        lower_ctx_emit(ctx, INSTR_CREATE_movzx(dcontext, op_idx32,
+                                               opnd_create_sized_tls_slot(os_tls_offset(k_slot), OPSZ_1)));
+    }
+    // lea idx, [idx*8] ; rows are then addressed as [lut + idx*4]
+    lower_ctx_emit(ctx, INSTR_CREATE_lea(dcontext, opnd_create_reg(idx_gpr),
+                                         opnd_create_base_disp(DR_REG_NULL, idx_gpr, 8, 0, OPSZ_lea)));
+}
+
+static void
+compress_load_row(lower_ctx_t *ctx, reg_id_t dst, reg_id_t lut_gpr, reg_id_t idx_gpr, size_t offs)
+{
+    lower_ctx_emit(ctx, INSTR_CREATE_vmovdqu(ctx->dcontext, opnd_create_reg(dst),
+                                             opnd_create_base_disp(lut_gpr, idx_gpr, 4, (int)offs, OPSZ_32)));
+}
+
+/**
+ * Only as many elements as the opmask selects may be touched in memory. With
+ * `idx_gpr` indexing half 1, turn len0 (in `lo`) and the rot row (in `rot`) into
+ * the per-half vpmaskmovd lanes: lo = len0 | rot(len1), rot = len0 & rot(len1).
+ */
+static void
+compress_valid_lanes(lower_ctx_t *ctx, reg_id_t lut_gpr, reg_id_t idx_gpr, uint elem_size, reg_id_t lo,
+                     reg_id_t rot, reg_id_t tmp)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    opnd_t op_lo = opnd_create_reg(lo);
+    opnd_t op_rot = opnd_create_reg(rot);
+    opnd_t op_tmp = opnd_create_reg(tmp);
+    compress_load_row(ctx, tmp, lut_gpr, idx_gpr, COMPRESS_LUT_OFFS(len, elem_size, LOWER_HALF_HIGH));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpermd(dcontext, op_tmp, op_rot, op_tmp));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_rot, op_lo, op_tmp));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpor(dcontext, op_lo, op_lo, op_tmp));
+}
+
+static instr_t *
+vcompress_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, uint elem_size)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t dst_opnd = instr_get_dst(instr, 0);
+    opnd_t src_opnd = instr_get_src(instr, 1);
+    bool to_mem = opnd_is_memory_reference(dst_opnd);
+    ctx.num_halves = IS_ZMM_REG(opnd_get_reg(src_opnd)) ? 2 : 1;
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t idx_gpr = lower_ctx_get_gpr(&ctx, dst_opnd);
+    reg_id_t lut_gpr = lower_ctx_get_gpr(&ctx, dst_opnd);
+    reg_id_t out[2] = { lower_ctx_get_scratch(&ctx), DR_REG_NULL };
+    reg_id_t valid[2] = { lower_ctx_get_scratch(&ctx), DR_REG_NULL };
+    reg_id_t tmp_reg = lower_ctx_get_scratch(&ctx);
+    opnd_t op_tmp = opnd_create_reg(tmp_reg);
+    if (ctx.num_halves == 2) {
+        out[1] = lower_ctx_get_scratch(&ctx);
+        valid[1] = lower_ctx_get_scratch(&ctx);
+    }
+
+    // the source is read before the destination is written, they may alias
+    for (uint half = 0; half < ctx.num_halves; half++)
+        lower_ctx_load_half(&ctx, out[half], src_opnd, half);
+    lower_ctx_emit(&ctx, INSTR_CREATE_mov_imm(dcontext, opnd_create_reg(lut_gpr),
+                                              OPND_CREATE_INTPTR((ptr_int_t)&compress_lut)));
+    // out0 = vpermd(perm0, src0) ; valid0 = len0
+    compress_load_mask_index(&ctx, idx_gpr, elem_size, LOWER_HALF_LOW);
+    compress_load_row(&ctx, tmp_reg, lut_gpr, idx_gpr, COMPRESS_LUT_OFFS(perm, elem_size, LOWER_HALF_LOW));
+    lower_ctx_emit(&ctx, INSTR_CREATE_vpermd(dcontext, opnd_create_reg(out[0]), op_tmp, opnd_create_reg(out[0])));
+    compress_load_row(&ctx, valid[0], lut_gpr, idx_gpr, COMPRESS_LUT_OFFS(len, elem_size, LOWER_HALF_LOW));
+    if (ctx.num_halves == 2) {
+        opnd_t op_out0 = opnd_create_reg(out[0]);
+        opnd_t op_out1 = opnd_create_reg(out[1]);
+        opnd_t op_rot = opnd_create_reg(valid[1]);
+        compress_load_row(&ctx, valid[1], lut_gpr, idx_gpr, COMPRESS_LUT_OFFS(rot, elem_size, LOWER_HALF_LOW));
+        if (elem_size == 4)
+            compress_load_mask_index(&ctx, idx_gpr, elem_size, LOWER_HALF_HIGH);
+        // c1 = rot(vpermd(perm1, src1)) ; out0 = len0 ? c0 : c1 ; out1 = c1
+        compress_load_row(&ctx, tmp_reg, lut_gpr, idx_gpr, COMPRESS_LUT_OFFS(perm, elem_size, LOWER_HALF_HIGH));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpermd(dcontext, op_out1, op_tmp, op_out1));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpermd(dcontext, op_out1, op_rot, op_out1));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpblendvb(dcontext, op_out0, op_out1, op_out0, opnd_create_reg(valid[0])));
+        compress_valid_lanes(&ctx, lut_gpr, idx_gpr, elem_size, valid[0], valid[1], tmp_reg);
+    }
+
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        opnd_t op_out = opnd_create_reg(out[half]);
+        if (to_mem) {
+            // vpmaskmovd out -> [mem + 32*half], only the selected elements are written
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpmaskmovd(dcontext, lower_half_mem_opnd(dst_opnd, half, OPSZ_32),
+                                                         op_out, opnd_create_reg(valid[half])));
+            continue;
+        }
+        // lanes past the selected elements keep the old dst, or are zeroed for {z}
+        if (ctx.zero_mask)
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_tmp, op_tmp, op_tmp));
+        else
+            lower_ctx_load_half(&ctx, tmp_reg, dst_opnd, half);
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpblendvb(dcontext, op_out, op_tmp, op_out, opnd_create_reg(valid[half])));
+        lower_ctx_store_half(&ctx, half, out[half]);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+/**
+ * Half 1 of an expand reads the source from element p0 on: both source halves
+ * are rotated down by p0 lanes and the wrapped lanes are taken from the high one.
+ */
+static instr_t *
+vexpand_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, uint elem_size)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    // the decoder lists the modrm.rm source as dst 0 and the destination reg as src 1
+    opnd_t src_opnd = instr_get_dst(instr, 0);
+    ctx.dst_reg = opnd_get_reg(instr_get_src(instr, 1));
+    ctx.num_halves = IS_ZMM_REG(ctx.dst_reg) ? 2 : 1;
+    bool from_mem = opnd_is_memory_reference(src_opnd);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t idx_gpr = lower_ctx_get_gpr(&ctx, src_opnd);
+    reg_id_t lut_gpr = lower_ctx_get_gpr(&ctx, src_opnd);
+    reg_id_t win[2] = { lower_ctx_get_scratch(&ctx), DR_REG_NULL };
+    reg_id_t tmp_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t lanes_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t rot_reg = DR_REG_NULL;
+    opnd_t op_tmp = opnd_create_reg(tmp_reg);
+    opnd_t op_lanes = opnd_create_reg(lanes_reg);
+    if (ctx.num_halves == 2) {
+        win[1] = lower_ctx_get_scratch(&ctx);
+        rot_reg = lower_ctx_get_scratch(&ctx);
+    }
+    opnd_t op_win0 = opnd_create_reg(win[0]);
+    opnd_t op_win1 = opnd_create_reg(win[1]);
+    opnd_t op_rot = opnd_create_reg(rot_reg);
+
+    lower_ctx_emit(&ctx, INSTR_CREATE_mov_imm(dcontext, opnd_create_reg(lut_gpr),
+                                              OPND_CREATE_INTPTR((ptr_int_t)&compress_lut)));
+    compress_load_mask_index(&ctx, idx_gpr, elem_size, LOWER_HALF_LOW);
+    if (from_mem) {
+        // vpmaskmovd loads only the elements the opmask consumes, no fault past them
+        compress_load_row(&ctx, lanes_reg, lut_gpr, idx_gpr, COMPRESS_LUT_OFFS(len, elem_size, LOWER_HALF_LOW));
+        if (ctx.num_halves == 2) {
+            compress_load_row(&ctx, rot_reg, lut_gpr, idx_gpr, COMPRESS_LUT_OFFS(rot, elem_size, LOWER_HALF_LOW));
+            if (elem_size == 4)
+                compress_load_mask_index(&ctx, idx_gpr, elem_size, LOWER_HALF_HIGH);
+            compress_valid_lanes(&ctx, lut_gpr, idx_gpr, elem_size, lanes_reg, rot_reg, tmp_reg);
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpmaskmovd(dcontext, op_win1, op_rot,
+                                                         lower_half_mem_opnd(src_opnd, LOWER_HALF_HIGH, OPSZ_32)));
+            if (elem_size == 4)
+                compress_load_mask_index(&ctx, idx_gpr, elem_size, LOWER_HALF_LOW);
+        }
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpmaskmovd(dcontext, op_win0, op_lanes,
+                                                     lower_half_mem_opnd(src_opnd, LOWER_HALF_LOW, OPSZ_32)));
+    } else {
+        // the source is read before the destination is written, they may alias
+        for (uint half = 0; half < ctx.num_halves; half++)
+            lower_ctx_load_half(&ctx, win[half], src_opnd, half);
+    }
+    if (ctx.num_halves == 2) {
+        // win1 = wrap ? rotinv(src1) : rotinv(src0)
+        compress_load_row(&ctx, rot_reg, lut_gpr, idx_gpr, COMPRESS_LUT_OFFS(rotinv, elem_size, LOWER_HALF_LOW));
+        compress_load_row(&ctx, lanes_reg, lut_gpr, idx_gpr, COMPRESS_LUT_OFFS(wrap, elem_size, LOWER_HALF_LOW));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpermd(dcontext, op_tmp, op_rot, op_win0));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpermd(dcontext, op_rot, op_rot, op_win1));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpblendvb(dcontext, op_win1, op_tmp, op_rot, op_lanes));
+    }
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        opnd_t op_win = opnd_create_reg(win[half]);
+        if (half == LOWER_HALF_HIGH && elem_size == 4)
+            compress_load_mask_index(&ctx, idx_gpr, elem_size, LOWER_HALF_HIGH);
+        // e = vpermd(exp, win), the lanes the opmask clears are blended away on store
+        compress_load_row(&ctx, tmp_reg, lut_gpr, idx_gpr, COMPRESS_LUT_OFFS(exp, elem_size, half));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpermd(dcontext, op_win, op_tmp, op_win));
+    }
+    for (uint half = 0; half < ctx.num_halves; half++)
+        lower_ctx_store_half_masked(&ctx, half, win[half], elem_size, tmp_reg, lanes_reg);
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+static bool
+vcompress_opnds_supported(instr_t *instr)
+{
+    // vpcompressd {%k1} %zmm1 -> %zmm0/m512, the xmm forms are not lowered
+    opnd_t rm_opnd = instr_get_dst(instr, 0);
+    opnd_t reg_opnd = instr_get_src(instr, 1);
+    return opnd_is_reg(reg_opnd) && !IS_XMM_REG(opnd_get_reg(reg_opnd)) &&
+        (opnd_is_reg(rm_opnd) || opnd_is_memory_reference(rm_opnd));
+}
+
+instr_t * /* 537 */
+rw_func_vcompresspd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vcompresspd {%k1} %zmm1 -> %zmm0/m512
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vcompresspd", true, true, false, true);
+#endif
+    if (!vcompress_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vcompresspd opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vcompress_gen(dcontext, ilist, instr, 8);
+}
+
+instr_t * /* 538 */
+rw_func_vcompressps(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vcompressps {%k1} %zmm1 -> %zmm0/m512
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vcompressps", true, true, false, true);
+#endif
+    if (!vcompress_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vcompressps opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vcompress_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 566 */
+rw_func_vexpandpd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vexpandpd {%k1} %zmm1/m512 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vexpandpd", true, true, false, true);
+#endif
+    if (!vcompress_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vexpandpd opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vexpand_gen(dcontext, ilist, instr, 8);
+}
+
+instr_t * /* 567 */
+rw_func_vexpandps(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vexpandps {%k1} %zmm1/m512 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vexpandps", true, true, false, true);
+#endif
+    if (!vcompress_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vexpandps opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vexpand_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 633 */
+rw_func_vpcompressd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpcompressd {%k1} %zmm1 -> %zmm0/m512
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpcompressd", true, true, false, true);
+#endif
+    if (!vcompress_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpcompressd opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vcompress_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 634 */
+rw_func_vpcompressq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpcompressq {%k1} %zmm1 -> %zmm0/m512
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpcompressq", true, true, false, true);
+#endif
+    if (!vcompress_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpcompressq opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vcompress_gen(dcontext, ilist, instr, 8);
+}
+
+instr_t * /* 651 */
+rw_func_vpexpandd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpexpandd {%k1} %zmm1/m512 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpexpandd", true, true, false, true);
+#endif
+    if (!vcompress_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpexpandd opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vexpand_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 652 */
+rw_func_vpexpandq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpexpandq {%k1} %zmm1/m512 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpexpandq", true, true, false, true);
+#endif
+    if (!vcompress_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpexpandq opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vexpand_gen(dcontext, ilist, instr, 8);
+}
+
+/* =======================================================
+ *     AVX512 VAES/VPCLMULQDQ instr rewrite functions
+ * ======================================================= */
+
+/* picked once by rewrite_init() from the host cpuid */
+static bool host_has_vaes_ymm;
+static bool host_has_vpclmulqdq_ymm;
+
+static void
+vaes_emit_op(lower_ctx_t *ctx, int opcode, reg_id_t dst, reg_id_t src, opnd_t imm_opnd)
+{
+    opnd_t op_dst = opnd_create_reg(dst);
+    if (opnd_is_null(imm_opnd)) {
+        lower_ctx_emit(ctx, instr_create_1dst_2src(ctx->dcontext, opcode, op_dst, op_dst, opnd_create_reg(src)));
+    } else {
+        lower_ctx_emit(ctx, instr_create_1dst_3src(ctx->dcontext, opcode, op_dst, op_dst, opnd_create_reg(src),
+                                                   imm_opnd));
+    }
+}
+
+/**
+ * The EVEX forms repeat the 128-bit AES round / carry-less multiply in every lane
+ * and take no opmask. With VEX VAES/VPCLMULQDQ on the host each half is one ymm op,
+ * otherwise each half is split into two xmm ops around vextracti128/vinserti128.
+ */
+static instr_t *
+vaes_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, bool host_ymm)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    int opcode = instr_get_opcode(instr);
+    opnd_t src1_opnd = instr_get_src(instr, 0);
+    opnd_t src2_opnd = instr_get_src(instr, 1);
+    opnd_t imm_opnd = instr_num_srcs(instr) > 2 ? instr_get_src(instr, 2) : opnd_create_null();
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t a_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t b_reg = lower_ctx_get_scratch(&ctx);
+    bool split = !host_ymm && !ctx.is_xmm;
+    reg_id_t a_hi = split ? YMM_TO_XMM(lower_ctx_get_scratch(&ctx)) : DR_REG_NULL;
+    reg_id_t b_hi = split ? YMM_TO_XMM(lower_ctx_get_scratch(&ctx)) : DR_REG_NULL;
+
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        lower_ctx_load_half(&ctx, a_reg, src1_opnd, half);
+        lower_ctx_load_half(&ctx, b_reg, src2_opnd, half);
+        if (!split) {
+            vaes_emit_op(&ctx, opcode, a_reg, b_reg, imm_opnd);
+        } else {
+            // vextracti128 $1 a -> a_hi ; vextracti128 $1 b -> b_hi
+            lower_ctx_emit(&ctx, INSTR_CREATE_vextracti128(dcontext, opnd_create_reg(a_hi), opnd_create_reg(a_reg),
+                                                           OPND_CREATE_INT8(1)));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vextracti128(dcontext, opnd_create_reg(b_hi), opnd_create_reg(b_reg),
+                                                           OPND_CREATE_INT8(1)));
+            // op xmm_a, xmm_b (clears a[255:128]) ; op a_hi, b_hi ; vinserti128 $1 a_hi -> a
+            vaes_emit_op(&ctx, opcode, YMM_TO_XMM(a_reg), YMM_TO_XMM(b_reg), imm_opnd);
+            vaes_emit_op(&ctx, opcode, a_hi, b_hi, imm_opnd);
+            lower_ctx_emit(&ctx, INSTR_CREATE_vinserti128(dcontext, opnd_create_reg(a_reg), opnd_create_reg(a_reg),
+                                                          opnd_create_reg(a_hi), OPND_CREATE_INT8(1)));
+        }
+        lower_ctx_store_half(&ctx, half, a_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+static bool
+vaes_opnds_supported(instr_t *instr)
+{
+    // vaesenc %zmm2 %zmm1/m512 -> %zmm0
+    return opnd_is_reg(instr_get_dst(instr, 0)) && opnd_is_reg(instr_get_src(instr, 0)) &&
+        (opnd_is_reg(instr_get_src(instr, 1)) || opnd_is_memory_reference(instr_get_src(instr, 1)));
+}
+
+instr_t * /* 214 */
+rw_func_vaesenc(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vaesenc %zmm2 %zmm1 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vaesenc", true, true, false, true);
+#endif
+    if (!vaes_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vaesenc opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vaes_gen(dcontext, ilist, instr, host_has_vaes_ymm);
+}
+
+instr_t * /* 215 */
+rw_func_vaesenclast(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vaesenclast %zmm2 %zmm1 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vaesenclast", true, true, false, true);
+#endif
+    if (!vaes_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vaesenclast opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vaes_gen(dcontext, ilist, instr, host_has_vaes_ymm);
+}
+
+instr_t * /* 216 */
+rw_func_vaesdec(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vaesdec %zmm2 %zmm1 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vaesdec", true, true, false, true);
+#endif
+    if (!vaes_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vaesdec opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vaes_gen(dcontext, ilist, instr, host_has_vaes_ymm);
+}
+
+instr_t * /* 217 */
+rw_func_vaesdeclast(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vaesdeclast %zmm2 %zmm1 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vaesdeclast", true, true, false, true);
+#endif
+    if (!vaes_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vaesdeclast opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vaes_gen(dcontext, ilist, instr, host_has_vaes_ymm);
+}
+
+instr_t * /* 238 */
+rw_func_vpclmulqdq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpclmulqdq %zmm2 %zmm1 $0x11 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpclmulqdq", true, true, false, true);
+#endif
+    if (!vaes_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpclmulqdq opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vaes_gen(dcontext, ilist, instr, host_has_vpclmulqdq_ymm);
+}
+
+/* =======================================================
+ *           AVX512 GFNI instr rewrite functions
+ * ======================================================= */
+
+/* picked once by rewrite_init() from the host cpuid */
+static bool host_has_gfni_ymm;
+
+/* row i of the 8x8 bit matrix is byte 7 - i of each qword, repeated for both lanes */
+#define GFNI_LANE_SHUF(b) b, b, b, b, b, b, b, b, 8 + (b), 8 + (b), 8 + (b), 8 + (b), 8 + (b), 8 + (b), 8 + (b), 8 + (b)
+#define GFNI_ROW_SHUF(i) { GFNI_LANE_SHUF(7 - (i)), GFNI_LANE_SHUF(7 - (i)) }
+static const byte gfni_row_shuf[8][32] = { GFNI_ROW_SHUF(0), GFNI_ROW_SHUF(1), GFNI_ROW_SHUF(2), GFNI_ROW_SHUF(3),
+                                           GFNI_ROW_SHUF(4), GFNI_ROW_SHUF(5), GFNI_ROW_SHUF(6), GFNI_ROW_SHUF(7) };
+static const byte gfni_parity_lut[32] = { 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
+                                          0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0 };
+static const byte gfni_poly_bytes[32] = { 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
+                                          0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
+                                          0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b };
+/* InvShiftRows as a vpshufb control, so that aesenclast leaves plain SubBytes */
+static const byte gfni_invshift_shuf[32] = { 0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3,
+                                             0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3 };
+/* inverse of the AES affine map f(s) = rotl(s,1) ^ rotl(s,3) ^ rotl(s,6) ^ 0x05, per nibble */
+static const byte gfni_invaff_lo[32] = { 0x05, 0x4f, 0x91, 0xdb, 0x2c, 0x66, 0xb8, 0xf2, 0x57, 0x1d, 0xc3,
+                                         0x89, 0x7e, 0x34, 0xea, 0xa0, 0x05, 0x4f, 0x91, 0xdb, 0x2c, 0x66,
+                                         0xb8, 0xf2, 0x57, 0x1d, 0xc3, 0x89, 0x7e, 0x34, 0xea, 0xa0 };
+static const byte gfni_invaff_hi[32] = { 0x00, 0xa4, 0x49, 0xed, 0x92, 0x36, 0xdb, 0x7f, 0x25, 0x81, 0x6c,
+                                         0xc8, 0xb7, 0x13, 0xfe, 0x5a, 0x00, 0xa4, 0x49, 0xed, 0x92, 0x36,
+                                         0xdb, 0x7f, 0x25, 0x81, 0x6c, 0xc8, 0xb7, 0x13, 0xfe, 0x5a };
+
+/**
+ * Without GFNI on the host, vgf2p8mulb is an 8-step Horner shift-and-add over the
+ * bits of b, msb first; the sign bit (vpcmpgtb against zero) picks both the bit of
+ * b and the carry out of the xtime doubling, which is reduced by 0x1b.
+ */
+static instr_t *
+vgf2p8mulb_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t src1_opnd = instr_get_src(instr, 1);
+    opnd_t src2_opnd = instr_get_src(instr, 2);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t a_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t b_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t r_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t m_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t zero_reg = host_has_gfni_ymm ? DR_REG_NULL : lower_ctx_get_scratch(&ctx);
+    opnd_t op_a = opnd_create_reg(a_reg);
+    opnd_t op_b = opnd_create_reg(b_reg);
+    opnd_t op_r = opnd_create_reg(r_reg);
+    opnd_t op_m = opnd_create_reg(m_reg);
+    opnd_t op_zero = opnd_create_reg(zero_reg);
+
+    if (!host_has_gfni_ymm)
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_zero, op_zero, op_zero));
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        lower_ctx_load_half(&ctx, a_reg, src1_opnd, half);
+        lower_ctx_load_half(&ctx, b_reg, src2_opnd, half);
+        if (host_has_gfni_ymm) {
+            vaes_emit_op(&ctx, OP_vgf2p8mulb, a_reg, b_reg, opnd_create_null());
+            lower_ctx_store_half_masked(&ctx, half, a_reg, 1, r_reg, m_reg);
+            continue;
+        }
+        // vpcmpgtb m, zero, b ; vpand r, a, m   ; r = b.bit7 ? a : 0
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpcmpgtb(dcontext, op_m, op_zero, op_b));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_r, op_a, op_m));
+        for (int bit = 6; bit >= 0; bit--) {
+            // vpaddb b, b, b   ; next bit of b into the sign position
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpaddb(dcontext, op_b, op_b, op_b));
+            // vpcmpgtb m, zero, r ; vpaddb r, r, r ; vpand m, m, 0x1b.. ; vpxor r, r, m   ; r = xtime(r)
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpcmpgtb(dcontext, op_m, op_zero, op_r));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpaddb(dcontext, op_r, op_r, op_r));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_m, op_m, lower_ctx_const_opnd(&ctx, gfni_poly_bytes)));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_r, op_r, op_m));
+            // vpcmpgtb m, zero, b ; vpand m, m, a ; vpxor r, r, m   ; r ^= b.bit ? a : 0
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpcmpgtb(dcontext, op_m, op_zero, op_b));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_m, op_m, op_a));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_r, op_r, op_m));
+        }
+        lower_ctx_store_half_masked(&ctx, half, r_reg, 1, m_reg, b_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+/**
+ * @brief Replace every byte of `x_reg` by its inverse in GF(2^8) (0 maps to 0).
+ *
+ * aesenclast with a zero key on InvShiftRows(x) yields SubBytes(x), the AES affine
+ * map of inv(x), which is undone with two nibble lookups. `t_reg`, `t2_reg` and
+ * `lut_reg` are clobbered.
+ */
+static void
+emit_gf2p8_inverse(lower_ctx_t *ctx, reg_id_t x_reg, reg_id_t t_reg, reg_id_t t2_reg, reg_id_t lut_reg)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    opnd_t op_x = opnd_create_reg(x_reg);
+    opnd_t op_t = opnd_create_reg(t_reg);
+    opnd_t op_lut = opnd_create_reg(lut_reg);
+    // vpshufb x, x, invshift ; vpxor t, t, t ; vaesenclast x, x, t
+    lower_ctx_emit(ctx, INSTR_CREATE_vpshufb(dcontext, op_x, op_x, lower_ctx_const_opnd(ctx, gfni_invshift_shuf)));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpxor(dcontext, op_t, op_t, op_t));
+    if (host_has_vaes_ymm || ctx->is_xmm) {
+        vaes_emit_op(ctx, OP_vaesenclast, x_reg, t_reg, opnd_create_null());
+    } else {
+        reg_id_t x_hi = YMM_TO_XMM(t2_reg);
+        lower_ctx_emit(ctx, INSTR_CREATE_vextracti128(dcontext, opnd_create_reg(x_hi), op_x, OPND_CREATE_INT8(1)));
+        vaes_emit_op(ctx, OP_vaesenclast, YMM_TO_XMM(x_reg), YMM_TO_XMM(t_reg), opnd_create_null());
+        vaes_emit_op(ctx, OP_vaesenclast, x_hi, YMM_TO_XMM(t_reg), opnd_create_null());
+        lower_ctx_emit(ctx, INSTR_CREATE_vinserti128(dcontext, op_x, op_x, opnd_create_reg(x_hi), OPND_CREATE_INT8(1)));
+    }
+    // vpsrlw $4, x -> t ; vpand t, t, 0x0f.. ; vpand x, x, 0x0f..
+    lower_ctx_emit(ctx, INSTR_CREATE_vpsrlw(dcontext, op_t, OPND_CREATE_INT8(4), op_x));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_t, op_t, lower_ctx_const_opnd(ctx, popcnt_nibble_mask)));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_x, op_x, lower_ctx_const_opnd(ctx, popcnt_nibble_mask)));
+    // x = invaff_lo[x] ^ invaff_hi[t]
+    lower_ctx_emit(ctx, INSTR_CREATE_vmovdqu(dcontext, op_lut, lower_ctx_const_opnd(ctx, gfni_invaff_lo)));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpshufb(dcontext, op_x, op_lut, op_x));
+    lower_ctx_emit(ctx, INSTR_CREATE_vmovdqu(dcontext, op_lut, lower_ctx_const_opnd(ctx, gfni_invaff_hi)));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpshufb(dcontext, op_t, op_lut, op_t));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpxor(dcontext, op_x, op_x, op_t));
+}
+
+/**
+ * @brief r.byte.bit[i] = parity(A.qword.byte[7 - i] & x.byte) ^ imm.bit[i].
+ *
+ * `lut_reg` must already hold gfni_parity_lut; `t_reg` and `t2_reg` are clobbered.
+ */
+static void
+emit_gf2p8_affine(lower_ctx_t *ctx, reg_id_t r_reg, reg_id_t x_reg, reg_id_t a_reg, reg_id_t lut_reg, reg_id_t t_reg,
+                  reg_id_t t2_reg, uint imm)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    opnd_t op_r = opnd_create_reg(r_reg);
+    opnd_t op_t2 = opnd_create_reg(t2_reg);
+    for (uint bit = 0; bit < 8; bit++) {
+        opnd_t op_d = opnd_create_reg(bit == 0 ? r_reg : t_reg);
+        // vpshufb d, a, row[bit] ; vpand d, d, x
+        lower_ctx_emit(ctx, INSTR_CREATE_vpshufb(dcontext, op_d, opnd_create_reg(a_reg),
+                                                 lower_ctx_const_opnd(ctx, gfni_row_shuf[bit])));
+        lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_d, op_d, opnd_create_reg(x_reg)));
+        // vpsrlw $4, d -> t2 ; vpxor d, d, t2 ; vpand d, d, 0x0f..   ; fold the byte into one nibble
+        lower_ctx_emit(ctx, INSTR_CREATE_vpsrlw(dcontext, op_t2, OPND_CREATE_INT8(4), op_d));
+        lower_ctx_emit(ctx, INSTR_CREATE_vpxor(dcontext, op_d, op_d, op_t2));
+        lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_d, op_d, lower_ctx_const_opnd(ctx, popcnt_nibble_mask)));
+        // vpshufb d, lut, d   ; parity as 0/1
+        lower_ctx_emit(ctx, INSTR_CREATE_vpshufb(dcontext, op_d, opnd_create_reg(lut_reg), op_d));
+        if (TEST(1 << bit, imm))
+            lower_ctx_emit(ctx, INSTR_CREATE_vpxor(dcontext, op_d, op_d, lower_ctx_const_opnd(ctx, popcnt_ones_bytes)));
+        if (bit > 0) {
+            // vpsllw $bit, d -> d ; vpor r, r, d
+            lower_ctx_emit(ctx, INSTR_CREATE_vpsllw(dcontext, op_d, OPND_CREATE_INT8(bit), op_d));
+            lower_ctx_emit(ctx, INSTR_CREATE_vpor(dcontext, op_r, op_r, op_d));
+        }
+    }
+}
+
+static instr_t *
+vgf2p8affine_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, bool inverse)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    int opcode = instr_get_opcode(instr);
+    opnd_t imm_opnd = instr_get_src(instr, 1);
+    opnd_t x_opnd = instr_get_src(instr, 2);
+    opnd_t a_opnd = instr_get_src(instr, 3);
+    uint imm = (uint)opnd_get_immed_int(imm_opnd) & 0xff;
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t x_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t a_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t t_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t t2_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t r_reg = host_has_gfni_ymm ? DR_REG_NULL : lower_ctx_get_scratch(&ctx);
+    reg_id_t lut_reg = host_has_gfni_ymm ? DR_REG_NULL : lower_ctx_get_scratch(&ctx);
+
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        lower_ctx_load_half(&ctx, x_reg, x_opnd, half);
+        if (host_has_gfni_ymm) {
+            lower_ctx_load_half(&ctx, a_reg, a_opnd, half);
+            vaes_emit_op(&ctx, opcode, x_reg, a_reg, imm_opnd);
+            lower_ctx_store_half_masked(&ctx, half, x_reg, 1, t_reg, t2_reg);
+            continue;
+        }
+        if (inverse)
+            emit_gf2p8_inverse(&ctx, x_reg, t_reg, t2_reg, lut_reg);
+        lower_ctx_load_half(&ctx, a_reg, a_opnd, half);
+        lower_ctx_emit(&ctx,
+                       INSTR_CREATE_vmovdqu(dcontext, opnd_create_reg(lut_reg), lower_ctx_const_opnd(&ctx, gfni_parity_lut)));
+        emit_gf2p8_affine(&ctx, r_reg, x_reg, a_reg, lut_reg, t_reg, t2_reg, imm);
+        lower_ctx_store_half_masked(&ctx, half, r_reg, 1, t_reg, t2_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+static bool
+vgf2p8_opnds_supported(instr_t *instr, uint x_idx)
+{
+    // vgf2p8affineqb {%k1} $imm %zmm2 %zmm1/m512/m64bcst -> %zmm0
+    return opnd_is_reg(instr_get_dst(instr, 0)) && opnd_is_reg(instr_get_src(instr, x_idx)) &&
+        (opnd_is_reg(instr_get_src(instr, x_idx + 1)) || opnd_is_memory_reference(instr_get_src(instr, x_idx + 1)));
+}
+
+instr_t * /* 807 */
+rw_func_vgf2p8mulb(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vgf2p8mulb {%k1} %zmm2 %zmm1 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vgf2p8mulb", true, true, false, true);
+#endif
+    if (!vgf2p8_opnds_supported(instr, 1)) {
+        REWRITE_ERROR(STD_ERRF, "vgf2p8mulb opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vgf2p8mulb_gen(dcontext, ilist, instr);
+}
+
+instr_t * /* 809 */
+rw_func_vgf2p8affineqb(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vgf2p8affineqb {%k1} $imm %zmm2 %zmm1 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vgf2p8affineqb", true, true, false, true);
+#endif
+    if (!vgf2p8_opnds_supported(instr, 2)) {
+        REWRITE_ERROR(STD_ERRF, "vgf2p8affineqb opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vgf2p8affine_gen(dcontext, ilist, instr, false);
+}
+
+instr_t * /* 811 */
+rw_func_vgf2p8affineinvqb(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vgf2p8affineinvqb {%k1} $imm %zmm2 %zmm1 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vgf2p8affineinvqb", true, true, false, true);
+#endif
+    if (!vgf2p8_opnds_supported(instr, 2)) {
+        REWRITE_ERROR(STD_ERRF, "vgf2p8affineinvqb opnd kind not support");
+        return NULL_INSTR;
+    }
+    // the field inverse is taken from the AES S-box when GFNI itself is missing
+    if (!host_has_gfni_ymm && !proc_has_feature(FEATURE_AES)) {
+        REWRITE_ERROR(STD_ERRF, "vgf2p8affineinvqb needs GFNI or AES on the host");
+        return NULL_INSTR;
+    }
+    return vgf2p8affine_gen(dcontext, ilist, instr, true);
+}
+
+/* =======================================================
+ *       128/256-bit lane move instr rewrite functions
+ * ======================================================= */
+
+/*
+ * vextract/vinsert/vshuf/valign only move whole 128/256-bit lanes (valign: bytes
+ * across lanes). A zmm half already is a ymm, so an unmasked 256-bit extract or
+ * insert is one move between the physical ymm and the TLS home of the half and
+ * needs no scratch register; a half that is already in place is not touched.
+ * Other lane reads go through r/m operands (vperm2i128, vinserti128, vpalignr)
+ * straight from app memory or TLS. All results are computed before the first
+ * store, so a destination aliasing a source is safe.
+ */
+
+static uint
+lane_reg_index(reg_id_t reg)
+{
+    if (IS_ZMM_REG(reg))
+        return TO_ZMM_REG_INDEX(reg);
+    if (IS_YMM_REG(reg))
+        return TO_YMM_REG_INDEX(reg);
+    return TO_XMM_REG_INDEX(reg);
+}
+
+static reg_id_t
+lane_xmm(reg_id_t reg)
+{
+    return IS_YMM_REG(reg) ? YMM_TO_XMM(reg) : reg;
+}
+
+/* extracts to memory are only lowered unmasked */
+static bool
+lane_opnds_supported(instr_t *instr)
+{
+    if (opnd_is_reg(instr_get_dst(instr, 0)))
+        return true;
+    if (opnd_get_reg(instr_get_src(instr, 0)) == DR_REG_K0)
+        return true;
+    REWRITE_ERROR(STD_ERRF, "%s with masked memory dst not support", decode_opcode_name(instr_get_opcode(instr)));
+    return false;
+}
+
+/**
+ * @brief Register holding half `half` of `src`, taking `*scratch` only if it is not
+ * live in a physical register.
+ */
+static reg_id_t
+lane_src_half(lower_ctx_t *ctx, opnd_t src, uint half, reg_id_t *scratch)
+{
+    if (opnd_is_reg(src) && lower_ctx_reg_is_live(ctx, opnd_get_reg(src), half))
+        return TO_YMM_REG_ID_NUM(lane_reg_index(opnd_get_reg(src)));
+    if (*scratch == DR_REG_NULL)
+        *scratch = lower_ctx_get_scratch(ctx);
+    lower_ctx_load_half(ctx, *scratch, src, half);
+    return *scratch;
+}
+
+/**
+ * @brief Unmasked copy of half `src_half` of `src` into half `half` of the destination,
+ * one instr unless neither side is live in a physical register.
+ */
+static void
+lane_copy_half(lower_ctx_t *ctx, uint half, opnd_t src, uint src_half, reg_id_t *scratch)
+{
+    reg_id_t dst = ctx->dst_reg;
+    if (opnd_is_reg(src) && lane_reg_index(opnd_get_reg(src)) == lane_reg_index(dst) && src_half == half)
+        return;
+    if (lower_ctx_reg_is_live(ctx, dst, half)) {
+        // the half of a live dst is its ymm, load straight into it
+        lower_ctx_load_half(ctx, TO_YMM_REG_ID_NUM(lane_reg_index(dst)), src, src_half);
+        return;
+    }
+    lower_ctx_store_half(ctx, half, lane_src_half(ctx, src, src_half, scratch));
+}
+
+/* vperm2i128 selector for lanes `lo`, `hi` (0-1 first source, 2-3 second) */
+static opnd_t
+lane_perm_sel(uint lo, uint hi)
+{
+    return OPND_CREATE_INT8(lo | hi << 4);
+}
+
+static instr_t *
+lane_finish(lower_ctx_t *ctx)
+{
+    // e.g. vextracti64x4 $0, %zmm1, %ymm1 moves nothing
+    if (ctx->first == NULL)
+        lower_ctx_emit(ctx, INSTR_CREATE_nop(ctx->dcontext));
+    instr_t *first = lower_ctx_finish(ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(ctx->dcontext, first);
+#endif
+    return first;
+}
+
+/** @brief vextract{f,i}{32x8,64x4} {k} imm8, zmm -> ymm/m256 */
+static instr_t *
+lane_extract256_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, uint elem_size)
+{
+    if (!lane_opnds_supported(instr))
+        return NULL_INSTR;
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    uint half = opnd_get_immed_int(instr_get_src(instr, 1)) & 1;
+    opnd_t src = instr_get_src(instr, 2);
+    opnd_t dst = instr_get_dst(instr, 0);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t scratch = DR_REG_NULL;
+    if (opnd_is_memory_reference(dst)) {
+        reg_id_t r = lane_src_half(&ctx, src, half, &scratch);
+        lower_ctx_emit(&ctx, INSTR_CREATE_vmovdqu(dcontext, lower_half_mem_opnd(dst, 0, OPSZ_32), opnd_create_reg(r)));
+    } else if (ctx.mask_reg == DR_REG_NULL) {
+        lane_copy_half(&ctx, LOWER_HALF_LOW, src, half, &scratch);
+    } else {
+        reg_id_t r_reg = lower_ctx_get_scratch(&ctx);
+        reg_id_t t_reg = lower_ctx_get_scratch(&ctx);
+        reg_id_t u_reg = lower_ctx_get_scratch(&ctx);
+        lower_ctx_load_half(&ctx, r_reg, src, half);
+        lower_ctx_store_half_masked(&ctx, LOWER_HALF_LOW, r_reg, elem_size, t_reg, u_reg);
+    }
+    return lane_finish(&ctx);
+}
+
+/** @brief vextract{f,i}{32x4,64x2} {k} imm8, ymm/zmm -> xmm/m128 */
+static instr_t *
+lane_extract128_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, uint elem_size)
+{
+    if (!lane_opnds_supported(instr))
+        return NULL_INSTR;
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t src = instr_get_src(instr, 2);
+    uint lane = opnd_get_immed_int(instr_get_src(instr, 1)) & (IS_ZMM_REG(opnd_get_reg(src)) ? 3 : 1);
+    opnd_t dst = instr_get_dst(instr, 0);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t src_reg = opnd_get_reg(src);
+    if (opnd_is_memory_reference(dst)) {
+        opnd_t mem = lower_half_mem_opnd(dst, 0, OPSZ_16);
+        if (lower_ctx_reg_is_live(&ctx, src_reg, lane / 2)) {
+            lower_ctx_emit(&ctx, INSTR_CREATE_vextracti128(dcontext, mem,
+                                                           opnd_create_reg(TO_YMM_REG_ID_NUM(lane_reg_index(src_reg))),
+                                                           OPND_CREATE_INT8(lane % 2)));
+        } else {
+            reg_id_t x_reg = lane_xmm(lower_ctx_get_scratch(&ctx));
+            lower_ctx_load_lane(&ctx, x_reg, src, lane);
+            lower_ctx_emit(&ctx, INSTR_CREATE_vmovdqu(dcontext, mem, opnd_create_reg(x_reg)));
+        }
+    } else if (ctx.mask_reg == DR_REG_NULL && lower_ctx_reg_is_live(&ctx, ctx.dst_reg, LOWER_HALF_LOW)) {
+        lower_ctx_load_lane(&ctx, TO_XMM_REG_ID_NUM(lane_reg_index(ctx.dst_reg)), src, lane);
+    } else {
+        reg_id_t x_reg = lower_ctx_get_scratch(&ctx);
+        lower_ctx_load_lane(&ctx, x_reg, src, lane);
+        if (ctx.mask_reg == DR_REG_NULL) {
+            lower_ctx_store_half(&ctx, LOWER_HALF_LOW, x_reg);
+        } else {
+            reg_id_t t_reg = lower_ctx_get_scratch(&ctx);
+            reg_id_t u_reg = lower_ctx_get_scratch(&ctx);
+            lower_ctx_store_half_masked(&ctx, LOWER_HALF_LOW, x_reg, elem_size, t_reg, u_reg);
+        }
+    }
+    return lane_finish(&ctx);
+}
+
+/** @brief vinsert{f,i}{32x8,64x4} {k} imm8, zmm, ymm/m256 -> zmm */
+static instr_t *
+lane_insert256_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, uint elem_size)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    uint half = opnd_get_immed_int(instr_get_src(instr, 1)) & 1;
+    opnd_t src1 = instr_get_src(instr, 2);
+    opnd_t src2 = instr_get_src(instr, 3);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    // the inserted half goes first: a dst aliasing src2 only loses its low half afterwards
+    if (ctx.mask_reg == DR_REG_NULL) {
+        reg_id_t scratch = DR_REG_NULL;
+        lane_copy_half(&ctx, half, src2, LOWER_HALF_LOW, &scratch);
+        lane_copy_half(&ctx, 1 - half, src1, 1 - half, &scratch);
+    } else {
+        reg_id_t r_reg = lower_ctx_get_scratch(&ctx);
+        reg_id_t t_reg = lower_ctx_get_scratch(&ctx);
+        reg_id_t u_reg = lower_ctx_get_scratch(&ctx);
+        lower_ctx_load_half(&ctx, r_reg, src2, LOWER_HALF_LOW);
+        lower_ctx_store_half_masked(&ctx, half, r_reg, elem_size, t_reg, u_reg);
+        lower_ctx_load_half(&ctx, r_reg, src1, 1 - half);
+        lower_ctx_store_half_masked(&ctx, 1 - half, r_reg, elem_size, t_reg, u_reg);
+    }
+    return lane_finish(&ctx);
+}
+
+/** @brief vinsert{f,i}{32x4,64x2} {k} imm8, ymm/zmm, xmm/m128 -> ymm/zmm */
+static instr_t *
+lane_insert128_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, uint elem_size)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    uint lane = opnd_get_immed_int(instr_get_src(instr, 1)) & (ctx.num_halves * 2 - 1);
+    uint half = lane / 2;
+    opnd_t src1 = instr_get_src(instr, 2);
+    opnd_t src2 = instr_get_src(instr, 3);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    bool masked = ctx.mask_reg != DR_REG_NULL;
+    reg_id_t r_reg = DR_REG_NULL, t_reg = DR_REG_NULL, u_reg = DR_REG_NULL;
+    if (masked) {
+        r_reg = lower_ctx_get_scratch(&ctx);
+        t_reg = lower_ctx_get_scratch(&ctx);
+        u_reg = lower_ctx_get_scratch(&ctx);
+    }
+    // vinserti128 dst, src1.half, src2, lane % 2   ; into the live dst ymm if possible,
+    // checked after src1 may have taken a scratch that parks the dst
+    reg_id_t s1 = lane_src_half(&ctx, src1, half, &r_reg);
+    bool direct = !masked && lower_ctx_reg_is_live(&ctx, ctx.dst_reg, half);
+    if (!direct && r_reg == DR_REG_NULL)
+        r_reg = lower_ctx_get_scratch(&ctx);
+    opnd_t s2;
+    if (opnd_is_memory_reference(src2)) {
+        s2 = lower_half_mem_opnd(src2, 0, OPSZ_16);
+    } else if (lower_ctx_reg_is_live(&ctx, opnd_get_reg(src2), LOWER_HALF_LOW)) {
+        s2 = opnd_create_reg(TO_XMM_REG_ID_NUM(lane_reg_index(opnd_get_reg(src2))));
+    } else {
+        s2 = opnd_create_sized_tls_slot(os_tls_offset(TLS_ZMM_idx_SLOT(lane_reg_index(opnd_get_reg(src2)))),
+                                        OPSZ_16);
+    }
+    reg_id_t d = direct ? TO_YMM_REG_ID_NUM(lane_reg_index(ctx.dst_reg)) : r_reg;
+    lower_ctx_emit(&ctx, INSTR_CREATE_vinserti128(dcontext, opnd_create_reg(d), opnd_create_reg(s1), s2,
+                                                  OPND_CREATE_INT8(lane % 2)));
+    if (!direct)
+        lower_ctx_store_half_masked(&ctx, half, r_reg, elem_size, t_reg, u_reg);
+    if (ctx.num_halves == 2) {
+        // the other half is src1's, usually in place already
+        if (masked) {
+            lower_ctx_load_half(&ctx, r_reg, src1, 1 - half);
+            lower_ctx_store_half_masked(&ctx, 1 - half, r_reg, elem_size, t_reg, u_reg);
+        } else {
+            lane_copy_half(&ctx, 1 - half, src1, 1 - half, &r_reg);
+        }
+    }
+    return lane_finish(&ctx);
+}
+
+/** @brief vshuf{f,i}{32x4,64x2} {k} imm8, ymm/zmm, ymm/zmm/m/{1toN} -> ymm/zmm */
+static instr_t *
+lane_shuf_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, uint elem_size)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    uint imm = (uint)opnd_get_immed_int(instr_get_src(instr, 1));
+    opnd_t src1 = instr_get_src(instr, 2);
+    opnd_t src2 = instr_get_src(instr, 3);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    bool masked = ctx.mask_reg != DR_REG_NULL;
+    reg_id_t x_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t res[2] = { lower_ctx_get_scratch(&ctx), DR_REG_NULL };
+    // every lane of a broadcast is the same, load it before x_reg is reused
+    reg_id_t b_reg = ctx.is_bcst ? lower_ctx_get_scratch(&ctx) : DR_REG_NULL;
+    if (ctx.is_bcst)
+        lower_ctx_src_half(&ctx, b_reg, src2, LOWER_HALF_LOW);
+    if (ctx.num_halves == 1) {
+        // ymm: low lane from src1, high lane from src2
+        reg_id_t a = lower_ctx_src_half(&ctx, x_reg, src1, LOWER_HALF_LOW);
+        opnd_t b = lower_ctx_src_half_opnd(&ctx, b_reg, src2, LOWER_HALF_LOW);
+        lower_ctx_emit(&ctx, INSTR_CREATE_vperm2i128(dcontext, opnd_create_reg(res[0]), opnd_create_reg(a), b,
+                                                     lane_perm_sel(imm & 1, 2 + ((imm >> 1) & 1))));
+    } else {
+        // zmm: the low half picks two lanes of src1, the high half two lanes of src2,
+        // the halves of one source being the two vperm2i128 sources
+        res[1] = lower_ctx_get_scratch(&ctx);
+        for (uint half = 0; half < 2; half++) {
+            opnd_t src = half == 0 ? src1 : src2;
+            uint sel = imm >> (half * 4);
+            reg_id_t a = lower_ctx_src_half(&ctx, x_reg, src, LOWER_HALF_LOW);
+            opnd_t b = lower_ctx_src_half_opnd(&ctx, b_reg, src, LOWER_HALF_HIGH);
+            lower_ctx_emit(&ctx, INSTR_CREATE_vperm2i128(dcontext, opnd_create_reg(res[half]), opnd_create_reg(a),
+                                                         b, lane_perm_sel(sel & 3, (sel >> 2) & 3)));
+        }
+    }
+    reg_id_t t_reg = masked ? x_reg : DR_REG_NULL;
+    reg_id_t u_reg = masked ? (b_reg != DR_REG_NULL ? b_reg : lower_ctx_get_scratch(&ctx)) : DR_REG_NULL;
+    for (uint half = 0; half < ctx.num_halves; half++)
+        lower_ctx_store_half_masked(&ctx, half, res[half], elem_size, t_reg, u_reg);
+    return lane_finish(&ctx);
+}
+
+/* 256-bit unit `h` of the src1:src2 concatenation, src2 being the low end */
+static opnd_t
+lane_align_unit(lower_ctx_t *ctx, opnd_t src1, opnd_t src2, uint h)
+{
+    return h < ctx->num_halves ? src2 : src1;
+}
+
+/**
+ * @brief Bytes [32 * m / 2, +32) of the src1:src2 concatenation, i.e. 128-bit lanes m
+ * and m + 1, in `reg`; an odd `m` straddles two halves and takes a vperm2i128.
+ */
+static void
+lane_align_pair(lower_ctx_t *ctx, reg_id_t reg, reg_id_t b_reg, opnd_t src1, opnd_t src2, uint m)
+{
+    uint n = ctx->num_halves;
+    uint h = m / 2;
+    opnd_t lo = lane_align_unit(ctx, src1, src2, h);
+    if (m % 2 == 0) {
+        lower_ctx_load_half(ctx, reg, lo, h % n);
+        return;
+    }
+    opnd_t hi = lane_align_unit(ctx, src1, src2, h + 1);
+    reg_id_t a = lower_ctx_src_half(ctx, reg, lo, h % n);
+    lower_ctx_emit(ctx, INSTR_CREATE_vperm2i128(ctx->dcontext, opnd_create_reg(reg), opnd_create_reg(a),
+                                                lower_ctx_src_half_opnd(ctx, b_reg, hi, (h + 1) % n),
+                                                lane_perm_sel(1, 2)));
+}
+
+/** @brief valign{d,q} {k} imm8, xyzmm, xyzmm/m/{1toN} -> xyzmm */
+static instr_t *
+lane_align_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, uint elem_size)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    uint bytes = ctx.is_xmm ? SIZE_OF_XMM : ctx.num_halves * SIZE_OF_YMM;
+    uint shift = ((uint)opnd_get_immed_int(instr_get_src(instr, 1)) & (bytes / elem_size - 1)) * elem_size;
+    opnd_t src1 = instr_get_src(instr, 2);
+    opnd_t src2 = instr_get_src(instr, 3);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    bool masked = ctx.mask_reg != DR_REG_NULL;
+    reg_id_t a_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t res[2] = { lower_ctx_get_scratch(&ctx), DR_REG_NULL };
+    reg_id_t b_reg = ctx.is_bcst ? lower_ctx_get_scratch(&ctx) : DR_REG_NULL;
+    if (ctx.is_bcst)
+        lower_ctx_src_half(&ctx, b_reg, src2, LOWER_HALF_LOW);
+    if (ctx.is_xmm) {
+        // vpalignr res, src1, src2, shift
+        if (shift == 0) {
+            lower_ctx_load_half(&ctx, res[0], src2, LOWER_HALF_LOW);
+        } else {
+            reg_id_t a = lower_ctx_src_half(&ctx, a_reg, src1, LOWER_HALF_LOW);
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpalignr(dcontext, opnd_create_reg(res[0]), opnd_create_reg(a),
+                                                       lower_ctx_src_half_opnd(&ctx, b_reg, src2, LOWER_HALF_LOW),
+                                                       OPND_CREATE_INT8(shift)));
+        }
+    } else {
+        // dst half k = vpalignr(pair(q + 2k + 1), pair(q + 2k), r) per 128-bit lane
+        uint q = shift / SIZE_OF_XMM, r = shift % SIZE_OF_XMM;
+        if (ctx.num_halves == 2)
+            res[1] = lower_ctx_get_scratch(&ctx);
+        for (uint half = 0; half < ctx.num_halves; half++) {
+            lane_align_pair(&ctx, res[half], b_reg, src1, src2, q + 2 * half);
+            if (r == 0)
+                continue;
+            lane_align_pair(&ctx, a_reg, b_reg, src1, src2, q + 2 * half + 1);
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpalignr(dcontext, opnd_create_reg(res[half]), opnd_create_reg(a_reg),
+                                                       opnd_create_reg(res[half]), OPND_CREATE_INT8(r)));
+        }
+    }
+    reg_id_t t_reg = masked ? a_reg : DR_REG_NULL;
+    reg_id_t u_reg = masked ? (b_reg != DR_REG_NULL ? b_reg : lower_ctx_get_scratch(&ctx)) : DR_REG_NULL;
+    for (uint half = 0; half < ctx.num_halves; half++)
+        lower_ctx_store_half_masked(&ctx, half, res[half], elem_size, t_reg, u_reg);
+    return lane_finish(&ctx);
+}
+
+instr_t * /* 523 */
+rw_func_valignd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "valignd", true, true, true, true);
+#endif
+    return lane_align_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 524 */
+rw_func_valignq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "valignq", true, true, true, true);
+#endif
+    return lane_align_gen(dcontext, ilist, instr, 8);
+}
+
+instr_t * /* 568 */
+rw_func_vextractf32x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vextractf32x4", true, true, true, true);
+#endif
+    return lane_extract128_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 569 */
+rw_func_vextractf32x8(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vextractf32x8", true, true, true, true);
+#endif
+    return lane_extract256_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 571 */
+rw_func_vextractf64x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vextractf64x4", true, true, true, true);
+#endif
+    return lane_extract256_gen(dcontext, ilist, instr, 8);
+}
+
+instr_t * /* 573 */
+rw_func_vextracti32x8(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vextracti32x8", true, true, true, true);
+#endif
+    return lane_extract256_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 575 */
+rw_func_vextracti64x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vextracti64x4", true, true, true, true);
+#endif
+    return lane_extract256_gen(dcontext, ilist, instr, 8);
+}
+
+instr_t * /* 600 */
+rw_func_vinsertf32x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vinsertf32x4", true, true, true, true);
+#endif
+    return lane_insert128_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 601 */
+rw_func_vinsertf32x8(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vinsertf32x8", true, true, true, true);
+#endif
+    return lane_insert256_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 602 */
+rw_func_vinsertf64x2(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vinsertf64x2", true, true, true, true);
+#endif
+    return lane_insert128_gen(dcontext, ilist, instr, 8);
+}
+
+instr_t * /* 603 */
+rw_func_vinsertf64x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vinsertf64x4", true, true, true, true);
+#endif
+    return lane_insert256_gen(dcontext, ilist, instr, 8);
+}
+
+instr_t * /* 604 */
+rw_func_vinserti32x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vinserti32x4", true, true, true, true);
+#endif
+    return lane_insert128_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 605 */
+rw_func_vinserti32x8(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vinserti32x8", true, true, true, true);
+#endif
+    return lane_insert256_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 606 */
+rw_func_vinserti64x2(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vinserti64x2", true, true, true, true);
+#endif
+    return lane_insert128_gen(dcontext, ilist, instr, 8);
+}
+
+instr_t * /* 607 */
+rw_func_vinserti64x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vinserti64x4", true, true, true, true);
+#endif
+    return lane_insert256_gen(dcontext, ilist, instr, 8);
+}
+
+instr_t * /* 765 */
+rw_func_vshuff32x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vshuff32x4", true, true, true, true);
+#endif
+    return lane_shuf_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 766 */
+rw_func_vshuff64x2(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vshuff64x2", true, true, true, true);
+#endif
+    return lane_shuf_gen(dcontext, ilist, instr, 8);
+}
+
+instr_t * /* 767 */
+rw_func_vshufi32x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vshufi32x4", true, true, true, true);
+#endif
+    return lane_shuf_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 768 */
+rw_func_vshufi64x2(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vshufi64x2", true, true, true, true);
+#endif
+    return lane_shuf_gen(dcontext, ilist, instr, 8);
+}
+
+/* =======================================================
+ *          masked blend instr rewrite functions
+ * ======================================================= */
+
+/*
+ * vblendmps/pd and vpblendmb/w/d/q select src2 where the opmask is set and src1
+ * (or zero) elsewhere, which is one AVX2 variable blend per half once the opmask
+ * is expanded to a lane mask. With k0 every element comes from src2.
+ */
+static instr_t *
+blendm_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, uint elem_size)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t a_opnd = instr_get_src(instr, 1);
+    opnd_t b_opnd = instr_get_src(instr, 2);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    int blend_opcode = elem_size == 8 ? OP_vblendvpd : (elem_size == 4 ? OP_vblendvps : OP_vpblendvb);
+    reg_id_t r_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t m_reg = ctx.mask_reg != DR_REG_NULL ? lower_ctx_get_scratch(&ctx) : DR_REG_NULL;
+    reg_id_t b_reg = ctx.is_bcst ? lower_ctx_get_scratch(&ctx) : DR_REG_NULL;
+    opnd_t op_r = opnd_create_reg(r_reg);
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        if (ctx.mask_reg == DR_REG_NULL) {
+            lower_ctx_store_half(&ctx, half, lower_ctx_src_half(&ctx, r_reg, b_opnd, half));
+            continue;
+        }
+        lower_ctx_k_lane_mask(&ctx, m_reg, ctx.mask_reg, elem_size, half);
+        if (ctx.zero_mask) {
+            // vpand r, b, lane_mask
+            lower_ctx_load_half(&ctx, r_reg, b_opnd, half);
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_r, op_r, opnd_create_reg(m_reg)));
+        } else {
+            // vblendv r, a, b, lane_mask
+            reg_id_t a = lower_ctx_src_half(&ctx, r_reg, a_opnd, half);
+            opnd_t op_b = lower_ctx_src_half_opnd(&ctx, b_reg, b_opnd, half);
+            lower_ctx_emit(&ctx, instr_create_1dst_3src(dcontext, blend_opcode, op_r, opnd_create_reg(a), op_b,
+                                                        opnd_create_reg(m_reg)));
+        }
+        lower_ctx_store_half(&ctx, half, r_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+instr_t * /* 525 */
+rw_func_vblendmpd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vblendmpd {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vblendmpd", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vblendmpd opnd kind not support");
+        return NULL_INSTR;
+    }
+    return blendm_gen(dcontext, ilist, instr, 8);
+}
+
+instr_t * /* 526 */
+rw_func_vblendmps(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vblendmps {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vblendmps", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vblendmps opnd kind not support");
+        return NULL_INSTR;
+    }
+    return blendm_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 619 */
+rw_func_vpblendmb(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpblendmb {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpblendmb", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpblendmb opnd kind not support");
+        return NULL_INSTR;
+    }
+    return blendm_gen(dcontext, ilist, instr, 1);
+}
+
+instr_t * /* 620 */
+rw_func_vpblendmd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpblendmd {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpblendmd", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpblendmd opnd kind not support");
+        return NULL_INSTR;
+    }
+    return blendm_gen(dcontext, ilist, instr, 4);
+}
+
+instr_t * /* 621 */
+rw_func_vpblendmq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpblendmq {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpblendmq", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpblendmq opnd kind not support");
+        return NULL_INSTR;
+    }
+    return blendm_gen(dcontext, ilist, instr, 8);
+}
+
+instr_t * /* 622 */
+rw_func_vpblendmw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpblendmw {%k1} %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpblendmw", true, true, true, true);
+#endif
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vpblendmw opnd kind not support");
+        return NULL_INSTR;
+    }
+    return blendm_gen(dcontext, ilist, instr, 2);
+}
+
+/* =======================================================
+ *            SAD instr rewrite functions
+ * ======================================================= */
+
+instr_t * /* 146 */
+rw_func_vpsadbw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vpsadbw %zmm1 %zmm2 -> %zmm0   ; EVEX vpsadbw takes no opmask
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpsadbw", true, true, true, true);
+#endif
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t a_opnd = instr_get_src(instr, 0);
+    opnd_t b_opnd = instr_get_src(instr, 1);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t r_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t a_reg = lower_ctx_get_scratch(&ctx);
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        // vpsadbw r, a, b
+        reg_id_t a = lower_ctx_src_half(&ctx, a_reg, a_opnd, half);
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpsadbw(dcontext, opnd_create_reg(r_reg), opnd_create_reg(a),
+                                                  lower_ctx_src_half_opnd(&ctx, DR_REG_NULL, b_opnd, half)));
+        lower_ctx_store_half(&ctx, half, r_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+/* vmpsadbw imm8 comparing the 4-byte block `blk` of src2 against src1 from byte `offs` (0 or 4), both lanes */
+static opnd_t
+dbpsadbw_mpsadbw_imm(uint blk, uint offs)
+{
+    uint lane = blk | (offs / 4) << 2;
+    return OPND_CREATE_INT8(lane | lane << 3);
+}
+
+/**
+ * vdbpsadbw compares every src1 quadruplet against a byte window of the
+ * dword-shuffled src2 (tmp = vpshufd src2, imm8) per 64-bit chunk:
+ *   word 0/1 = SAD(src1 dword 0, tmp bytes 0-3 / 1-4)
+ *   word 2/3 = SAD(src1 dword 1, tmp bytes 2-5 / 3-6)
+ * and likewise at +8 bytes for the second qword of each lane. SAD is symmetric,
+ * so vmpsadbw with tmp as the sliding operand and src1 dwords as the fixed
+ * block yields each pair of words at its own position; three vpblendw merge
+ * the four vmpsadbw results.
+ */
+instr_t * /* 563 */
+rw_func_vdbpsadbw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vdbpsadbw {%k1} $0x1b %zmm1 %zmm2 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vdbpsadbw", true, true, true, true);
+#endif
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t imm_opnd = instr_get_src(instr, 1);
+    opnd_t a_opnd = instr_get_src(instr, 2);
+    opnd_t b_opnd = instr_get_src(instr, 3);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t x_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t r_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t t_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t u_reg = lower_ctx_get_scratch(&ctx);
+    opnd_t op_x = opnd_create_reg(x_reg);
+    opnd_t op_r = opnd_create_reg(r_reg);
+    opnd_t op_t = opnd_create_reg(t_reg);
+    opnd_t op_u = opnd_create_reg(u_reg);
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        // vpshufd x, b, imm8
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpshufd(dcontext, op_x,
+                                                  lower_ctx_src_half_opnd(&ctx, DR_REG_NULL, b_opnd, half), imm_opnd));
+        opnd_t op_a = lower_ctx_src_half_opnd(&ctx, DR_REG_NULL, a_opnd, half);
+        // words 0-1 against a.dword0 from byte 0, words 2-3 against a.dword1
+        lower_ctx_emit(&ctx, INSTR_CREATE_vmpsadbw(dcontext, op_r, op_x, op_a, dbpsadbw_mpsadbw_imm(0, 0)));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vmpsadbw(dcontext, op_t, op_x, op_a, dbpsadbw_mpsadbw_imm(1, 0)));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpblendw(dcontext, op_r, op_r, op_t, OPND_CREATE_INT8(0x0c)));
+        // words 4-5 against a.dword2 from byte 4, words 6-7 against a.dword3
+        lower_ctx_emit(&ctx, INSTR_CREATE_vmpsadbw(dcontext, op_t, op_x, op_a, dbpsadbw_mpsadbw_imm(2, 4)));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vmpsadbw(dcontext, op_u, op_x, op_a, dbpsadbw_mpsadbw_imm(3, 4)));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpblendw(dcontext, op_t, op_t, op_u, OPND_CREATE_INT8((sbyte)0xc0)));
+        lower_ctx_emit(&ctx, INSTR_CREATE_vpblendw(dcontext, op_r, op_r, op_t, OPND_CREATE_INT8((sbyte)0xf0)));
+        lower_ctx_store_half_masked(&ctx, half, r_reg, 2, t_reg, u_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+/* =======================================================
+ *           MXCSR instr rewrite functions
+ * ======================================================= */
+
+/*
+ * vldmxcsr/vstmxcsr are VEX only and run natively; the app MXCSR is swapped out only
+ * inside {er}/{sae} runs, which lower_instr_keeps_mxcsr_run() ends before either of these.
+ */
+
+instr_t * /* 244 */
+rw_func_vldmxcsr(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vldmxcsr m32
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vldmxcsr", false, false, false, false);
 #endif
-        instrlist_concat_next_instr(ilist, 20, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15, i16,
-                                    i17, i18, i19, i20);
-        return i1;
-    } break;
+    instrlist_remove(ilist, instr);
+    return instr;
+}
+
+instr_t * /* 245 */
+rw_func_vstmxcsr(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vstmxcsr -> m32
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vstmxcsr", false, false, false, true);
+#endif
+    instrlist_remove(ilist, instr);
+    return instr;
+}
+
+/* =======================================================
+ *           AVX512 FP16 instr rewrite functions
+ * ======================================================= */
+
+static const uint fp16_ones_dwords[8] = { 1, 1, 1, 1, 1, 1, 1, 1 };
+static const uint fp16_zero_dwords[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+static const uint fp16_rc_mask_dwords[8] = { 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000 };
+static const uint fp16_max_finite_dwords[8] = { 0x7f7fffff, 0x7f7fffff, 0x7f7fffff, 0x7f7fffff,
+                                                0x7f7fffff, 0x7f7fffff, 0x7f7fffff, 0x7f7fffff };
+
+/* the FP32 working set is always a full ymm, even for the xmm forms */
+static reg_id_t
+fp16_ymm(reg_id_t reg)
+{
+    return reg_is_strictly_xmm(reg) ? XMM_TO_YMM(reg) : reg;
+}
+
+static reg_id_t
+fp16_xmm(reg_id_t reg)
+{
+    return reg_is_strictly_ymm(reg) ? YMM_TO_XMM(reg) : reg;
+}
+
+/* the halves of a VEX vcvtph2ps/vcvtps2ph ymm form, which the encoder names as the ymm cut to 16 bytes */
+static opnd_t
+fp16_halves_opnd(reg_id_t reg)
+{
+    return opnd_create_reg_partial(fp16_ymm(reg), OPSZ_16);
+}
+
+static opnd_t
+fp16_const_opnd(const void *table)
+{
+    return opnd_create_rel_addr((void *)table, OPSZ_32);
+}
+
+/**
+ * @brief Widen the 8 halves of `group` (0 low, 1 high lane) of `src` to 8 floats in
+ * the ymm view of `reg`. vcvtph2ps is exact, fp16 subnormals become fp32 normals.
+ */
+static void
+fp16_load_group(lower_ctx_t *ctx, reg_id_t reg, opnd_t src, uint half, uint group)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    reg_id_t xmm = fp16_xmm(reg);
+    lower_ctx_load_half(ctx, reg, src, half);
+    if (group == 1) {
+        lower_ctx_emit(ctx, INSTR_CREATE_vextracti128(dcontext, opnd_create_reg(xmm), opnd_create_reg(reg),
+                                                      OPND_CREATE_INT8(1)));
     }
-    return NULL_INSTR;
+    lower_ctx_emit(ctx, INSTR_CREATE_vcvtph2ps(dcontext, opnd_create_reg(fp16_ymm(reg)), fp16_halves_opnd(reg)));
 }
 
-instr_t *
-vpxorq_ymm_and_ymm_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, reg_id_t src_reg1, reg_id_t src_reg2,
-                       reg_id_t dst_reg, reg_id_t mask_reg)
+/**
+ * @brief Round the 8 floats in `f32_reg` to halves into `group` of `result`.
+ *
+ * Imm 4 rounds by MXCSR.RC like the FP32 op before it; the low group must be
+ * narrowed first since the VEX write of its xmm clears the high lane.
+ */
+static void
+fp16_narrow_group(lower_ctx_t *ctx, reg_id_t result, reg_id_t f32_reg, reg_id_t tmp_reg, uint group)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    opnd_t op_f32 = opnd_create_reg(fp16_ymm(f32_reg));
+    if (group == 0) {
+        lower_ctx_emit(ctx, INSTR_CREATE_vcvtps2ph(dcontext, fp16_halves_opnd(result), op_f32, OPND_CREATE_INT8(4)));
+        return;
+    }
+    lower_ctx_emit(ctx, INSTR_CREATE_vcvtps2ph(dcontext, fp16_halves_opnd(tmp_reg), op_f32, OPND_CREATE_INT8(4)));
+    lower_ctx_emit(ctx, INSTR_CREATE_vinserti128(dcontext, opnd_create_reg(result), opnd_create_reg(result),
+                                                 opnd_create_reg(fp16_xmm(tmp_reg)), OPND_CREATE_INT8(1)));
+}
+
+/**
+ * Each 256-bit half holds 16 halves, done as two groups of 8 widened to FP32.
+ * One FP32 add/sub/mul/div/sqrt followed by a rounding to fp16 is correctly rounded,
+ * since 24 >= 2 * 11 + 2 makes the double rounding innocuous.
+ */
+static instr_t *
+vph_arith_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, int ps_opcode)
 {
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    bool unary = ps_opcode == OP_vsqrtps;
+    opnd_t a_opnd = instr_get_src(instr, 1);
+    opnd_t b_opnd = unary ? opnd_create_null() : instr_get_src(instr, 2);
     instrlist_remove(ilist, instr);
     instr_destroy(dcontext, instr);
-    opnd_t src_opnd1 = create_mapping_ymm_opnd(dcontext, src_reg1);
-    opnd_t src_opnd2 = create_mapping_ymm_opnd(dcontext, src_reg2);
-    opnd_t dst_opnd = create_mapping_ymm_opnd(dcontext, dst_reg);
 
-    spill_state_t *state = &dcontext->local_state->spill_space;
+    reg_id_t r_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t a_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t b_reg = lower_ctx_get_scratch(&ctx);
+    opnd_t op_a = opnd_create_reg(fp16_ymm(a_reg));
+    opnd_t op_b = opnd_create_reg(fp16_ymm(b_reg));
+    uint num_groups = ctx.is_xmm ? 1 : 2;
 
-    int k_idx = TO_K_REG_INDEX(mask_reg);
-    if (k_idx == 0) {
-        // if k0 = 0 means no mask operation no blend, if 0x02 = 128(xmm)/64(quardword) means all elements include
-        if (state->k_regs[k_idx] == 0 || state->k_regs[k_idx] == 0x02) {
-            // vex.256 encoded version
-            instr_t *new_instr1 = instr_create_1dst_2src(dcontext, OP_vpxor, dst_opnd, src_opnd1, src_opnd2);
-#ifdef DEBUG
-            print_rewrite_variadic_instr(dcontext, 1, new_instr1);
-#endif
-            return new_instr1;
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        for (uint group = 0; group < num_groups; group++) {
+            fp16_load_group(&ctx, a_reg, a_opnd, half, group);
+            if (unary) {
+                lower_ctx_emit(&ctx, instr_create_1dst_1src(dcontext, ps_opcode, op_a, op_a));
+            } else {
+                fp16_load_group(&ctx, b_reg, b_opnd, half, group);
+                lower_ctx_emit(&ctx, instr_create_1dst_2src(dcontext, ps_opcode, op_a, op_a, op_b));
+            }
+            fp16_narrow_group(&ctx, r_reg, a_reg, b_reg, group);
         }
-    } else {
-        // unsigned char imm8 = rewrite_reserved_opmask[k_idx];
+        lower_ctx_store_half_masked(&ctx, half, r_reg, 2, a_reg, b_reg);
     }
-    return NULL_INSTR;
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
 }
 
-instr_t *
-vpxorq_xmm_and_xmm_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, reg_id_t src_reg1, reg_id_t src_reg2,
-                       reg_id_t dst_reg, reg_id_t mask_reg)
+/**
+ * min/max return one of their sources bit for bit, the second one when either is a
+ * NaN or both are zeros. Narrowing vminps/vmaxps would quiet an sNaN, so an ordered
+ * FP32 compare picks the raw halves instead: its all-ones dwords narrow to all-ones
+ * halves, a NaN, and the zeros to zeros.
+ */
+static instr_t *
+vph_minmax_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, bool is_max)
 {
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t a_opnd = instr_get_src(instr, 1);
+    opnd_t b_opnd = instr_get_src(instr, 2);
     instrlist_remove(ilist, instr);
     instr_destroy(dcontext, instr);
-    opnd_t src_opnd1 = create_mapping_xmm_opnd(dcontext, src_reg1);
-    opnd_t src_opnd2 = create_mapping_xmm_opnd(dcontext, src_reg2);
-    opnd_t dst_opnd = create_mapping_xmm_opnd(dcontext, dst_reg);
 
-    spill_state_t *state = &dcontext->local_state->spill_space;
+    reg_id_t r_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t a_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t b_reg = lower_ctx_get_scratch(&ctx);
+    opnd_t op_r = opnd_create_reg(r_reg);
+    opnd_t op_a = opnd_create_reg(fp16_ymm(a_reg));
+    opnd_t op_b = opnd_create_reg(fp16_ymm(b_reg));
+    uint num_groups = ctx.is_xmm ? 1 : 2;
 
-    int k_idx = TO_K_REG_INDEX(mask_reg);
-    if (k_idx == 0) {
-        // if k0 = 0 means no mask operation no blend, if 0x02 = 128(xmm)/64(quardword) means all elements include
-        if (state->k_regs[k_idx] == 0 || state->k_regs[k_idx] == 0x02) {
-            // vex.128 encoded version
-            instr_t *new_instr1 = instr_create_1dst_2src(dcontext, OP_vpxor, dst_opnd, src_opnd1, src_opnd2);
-#ifdef DEBUG
-            print_rewrite_variadic_instr(dcontext, 1, new_instr1);
-#endif
-            return new_instr1;
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        for (uint group = 0; group < num_groups; group++) {
+            fp16_load_group(&ctx, a_reg, a_opnd, half, group);
+            fp16_load_group(&ctx, b_reg, b_opnd, half, group);
+            // vcmpps $lt_os, b, a -> a   ; a < b for min, b < a for max, false if unordered
+            lower_ctx_emit(&ctx, INSTR_CREATE_vcmpps(dcontext, op_a, is_max ? op_b : op_a, is_max ? op_a : op_b,
+                                                     OPND_CREATE_INT8(1)));
+            fp16_narrow_group(&ctx, r_reg, a_reg, b_reg, group);
         }
-    } else {
-        // unsigned char imm8 = rewrite_reserved_opmask[k_idx];
+        // vpblendvb r, a, b -> r   ; the raw a where the compare held, else the raw b
+        lower_ctx_load_half(&ctx, a_reg, a_opnd, half);
+        lower_ctx_load_half(&ctx, b_reg, b_opnd, half);
+        lower_ctx_emit(&ctx,
+                       INSTR_CREATE_vpblendvb(dcontext, op_r, opnd_create_reg(b_reg), opnd_create_reg(a_reg), op_r));
+        lower_ctx_store_half_masked(&ctx, half, r_reg, 2, a_reg, b_reg);
     }
-    // // TODO: add vpxor and vpblend, there is a problem, vpblendd don't support quadwords, only double words,
-    // // then how to make it corrdinates with vpxorq's quadword,
-    return NULL_INSTR;
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
 }
 
 /**
- * @brief 720 vpxorq rewrite function
+ * a * b + c is not correctly rounded by a FP32 FMA plus a rounding to fp16, so the
+ * sum is rounded to odd instead: the product of two halves is exact in FP32, TwoSum
+ * gives s + e == p + c exactly, and an even inexact s is stepped one ulp towards
+ * the exact value. 24 >= 11 + 2 bits of round-to-odd then round correctly to fp16.
+ * TwoSum is only exact under RN, so the step is dropped when MXCSR.RC is anything
+ * else: a directed FP32 rounding followed by the same rounding to fp16 is already
+ * the directed rounding of the exact value.
  */
-instr_t *
-rw_func_vpxorq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+static instr_t *
+vfmaddph_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, uint form)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t h_opnd = instr_get_src(instr, 1);
+    opnd_t w_opnd = instr_get_src(instr, 2);
+    opnd_t d_opnd = instr_get_src(instr, 3);
+    opnd_t x_opnd, y_opnd, c_opnd;
+    switch (form) {
+    case 132: x_opnd = d_opnd, y_opnd = w_opnd, c_opnd = h_opnd; break;
+    case 213: x_opnd = h_opnd, y_opnd = d_opnd, c_opnd = w_opnd; break;
+    default: x_opnd = h_opnd, y_opnd = w_opnd, c_opnd = d_opnd; break;
+    }
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t r_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t p_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t c_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t s_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t t_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t u_reg = lower_ctx_get_scratch(&ctx);
+    opnd_t op_p = opnd_create_reg(fp16_ymm(p_reg));
+    opnd_t op_c = opnd_create_reg(fp16_ymm(c_reg));
+    opnd_t op_s = opnd_create_reg(fp16_ymm(s_reg));
+    opnd_t op_t = opnd_create_reg(fp16_ymm(t_reg));
+    opnd_t op_u = opnd_create_reg(fp16_ymm(u_reg));
+    // the override slot is only live inside lower_mxcsr_switch(), so it holds the MXCSR here
+    opnd_t mxcsr_opnd = opnd_create_sized_tls_slot(os_tls_offset(TLS_MXCSR_OVERRIDE_SLOT), OPSZ_4);
+    uint num_groups = ctx.is_xmm ? 1 : 2;
+
+    lower_ctx_emit(&ctx, INSTR_CREATE_vstmxcsr(dcontext, mxcsr_opnd));
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        for (uint group = 0; group < num_groups; group++) {
+            // p = x * y (exact), c
+            fp16_load_group(&ctx, p_reg, x_opnd, half, group);
+            fp16_load_group(&ctx, c_reg, y_opnd, half, group);
+            lower_ctx_emit(&ctx, INSTR_CREATE_vmulps(dcontext, op_p, op_p, op_c));
+            fp16_load_group(&ctx, c_reg, c_opnd, half, group);
+            // TwoSum: s = p + c ; t = s - p ; u = p - (s - t) ; t = (c - t) + u   ; s + t == p + c
+            lower_ctx_emit(&ctx, INSTR_CREATE_vaddps(dcontext, op_s, op_p, op_c));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vsubps(dcontext, op_t, op_s, op_p));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vsubps(dcontext, op_u, op_s, op_t));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vsubps(dcontext, op_u, op_p, op_u));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vsubps(dcontext, op_t, op_c, op_t));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vaddps(dcontext, op_t, op_u, op_t));
+            // vpxor p, t, s ; vpsrad $31, p -> p ; vpor p, p, 1..   ; p = +1 if |exact| > |s| else -1
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, op_p, op_t, op_s));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrad(dcontext, op_p, OPND_CREATE_INT8(31), op_p));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpor(dcontext, op_p, op_p, fp16_const_opnd(fp16_ones_dwords)));
+            // vpslld $1, t -> u ; vpcmpeqd u, u, 0.. ; vpandn p, u, p   ; s is exact
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpslld(dcontext, op_u, OPND_CREATE_INT8(1), op_t));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpcmpeqd(dcontext, op_u, op_u, fp16_const_opnd(fp16_zero_dwords)));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpandn(dcontext, op_p, op_u, op_p));
+            // vpslld $31, s -> u ; vpsrad $31, u -> u ; vpandn p, u, p   ; s is already odd
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpslld(dcontext, op_u, OPND_CREATE_INT8(31), op_s));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrad(dcontext, op_u, OPND_CREATE_INT8(31), op_u));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpandn(dcontext, op_p, op_u, op_p));
+            // vpslld $1, s -> u ; vpsrld $1, u -> u ; vpcmpgtd u, u, 0x7f7fffff.. ; vpandn p, u, p   ; s is inf/nan
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpslld(dcontext, op_u, OPND_CREATE_INT8(1), op_s));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpsrld(dcontext, op_u, OPND_CREATE_INT8(1), op_u));
+            lower_ctx_emit(&ctx,
+                           INSTR_CREATE_vpcmpgtd(dcontext, op_u, op_u, fp16_const_opnd(fp16_max_finite_dwords)));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpandn(dcontext, op_p, op_u, op_p));
+            // vpbroadcastd mxcsr -> u ; vpand u, u, 0x6000.. ; vpcmpeqd u, u, 0.. ; vpand p, p, u   ; RC is RN
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpbroadcastd(dcontext, op_u, mxcsr_opnd));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_u, op_u, fp16_const_opnd(fp16_rc_mask_dwords)));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpcmpeqd(dcontext, op_u, op_u, fp16_const_opnd(fp16_zero_dwords)));
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_p, op_p, op_u));
+            // vpaddd s, s, p   ; step the bit pattern one ulp
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpaddd(dcontext, op_s, op_s, op_p));
+            fp16_narrow_group(&ctx, r_reg, s_reg, c_reg, group);
+        }
+        lower_ctx_store_half_masked(&ctx, half, r_reg, 2, p_reg, c_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+/* the FP32 working set goes through vcvtph2ps/vcvtps2ph, which F16C brings */
+static bool
+vph_host_supported(const char *name)
+{
+    if (proc_has_feature(FEATURE_F16C))
+        return true;
+    REWRITE_ERROR(STD_ERRF, "%s needs F16C on the host", name);
+    return false;
+}
+
+static bool
+vph_opnds_supported(instr_t *instr, bool unary)
+{
+    // {er}/{sae} need no care here: exec_rewrite_avx512_bb() runs the FP32 ops under an MXCSR override
+    if (unary) {
+        // vsqrtph {%k1} %zmm1/m512/m16bcst -> %zmm0
+        return opnd_is_reg(instr_get_dst(instr, 0)) &&
+            (opnd_is_reg(instr_get_src(instr, 1)) || opnd_is_memory_reference(instr_get_src(instr, 1)));
+    }
+    return lower_binop_opnds_supported(instr);
+}
+
+instr_t * /* 812 */
+rw_func_vsqrtph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vsqrtph {%k1} %zmm1 -> %zmm0
+#ifdef DEBUG
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vsqrtph", true, true, false, true);
+#endif
+    if (!vph_opnds_supported(instr, true)) {
+        REWRITE_ERROR(STD_ERRF, "vsqrtph opnd kind not support");
+        return NULL_INSTR;
+    }
+    if (!vph_host_supported("vsqrtph"))
+        return NULL_INSTR;
+    return vph_arith_gen(dcontext, ilist, instr, OP_vsqrtps);
+}
+
+instr_t * /* 813 */
+rw_func_vaddph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
 {
-    opnd_t mask_opnd = instr_get_src(instr, 0);
-    opnd_t src_opnd1 = instr_get_src(instr, 1);
-    opnd_t src_opnd2 = instr_get_src(instr, 2);
-    opnd_t dst_opnd = instr_get_dst(instr, 0);
+    // vaddph {%k1} %zmm2 %zmm1 -> %zmm0
 #ifdef DEBUG
-    print_rewrite_info(dcontext, ilist, instr, instr_start, "vpxorq", true, true, true, true);
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vaddph", true, true, false, true);
 #endif
-    reg_id_t mask_reg = opnd_get_reg(mask_opnd);
-    reg_id_t src_reg1 = opnd_get_reg(src_opnd1);
-    reg_id_t src_reg2 = opnd_get_reg(src_opnd2);
-    reg_id_t dst_reg = opnd_get_reg(dst_opnd);
-    if (IS_ZMM_REG(src_reg1))
-        return vpxorq_zmm_and_zmm_gen(dcontext, ilist, instr, src_reg1, src_reg2, dst_reg, mask_reg);
-    if (IS_YMM_REG(src_reg1))
-        return vpxorq_ymm_and_ymm_gen(dcontext, ilist, instr, src_reg1, src_reg2, dst_reg, mask_reg);
-    if (IS_XMM_REG(src_reg1))
-        return vpxorq_xmm_and_xmm_gen(dcontext, ilist, instr, src_reg1, src_reg2, dst_reg, mask_reg);
-    REWRITE_INFO(STD_OUTF, "vpxorq pattern not support");
-    return NULL_INSTR;
+    if (!vph_opnds_supported(instr, false)) {
+        REWRITE_ERROR(STD_ERRF, "vaddph opnd kind not support");
+        return NULL_INSTR;
+    }
+    if (!vph_host_supported("vaddph"))
+        return NULL_INSTR;
+    return vph_arith_gen(dcontext, ilist, instr, OP_vaddps);
 }
 
-instr_t * /* 738 */
-rw_func_vrndscaleps(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+instr_t * /* 814 */
+rw_func_vmulph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
 {
-    // vrndscaleps {%k0} $0x00 %ymm4 -> %ymm4
-    // opnd_t mask_opnd = instr_get_src(instr, 0);
-    opnd_t imm8_opnd = instr_get_src(instr, 1);
-    opnd_t src_opnd = instr_get_src(instr, 2); // src2 can be reg/mem
-    opnd_t dst_opnd = instr_get_dst(instr, 0);
+    // vmulph {%k1} %zmm2 %zmm1 -> %zmm0
 #ifdef DEBUG
-    print_rewrite_info(dcontext, ilist, instr, instr_start, "vrndscaleps", true, true, true, true);
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vmulph", true, true, false, true);
 #endif
-    instrlist_remove(ilist, instr);
-    instr_destroy(dcontext, instr);
+    if (!vph_opnds_supported(instr, false)) {
+        REWRITE_ERROR(STD_ERRF, "vmulph opnd kind not support");
+        return NULL_INSTR;
+    }
+    if (!vph_host_supported("vmulph"))
+        return NULL_INSTR;
+    return vph_arith_gen(dcontext, ilist, instr, OP_vmulps);
+}
 
-    int imm8 = opnd_get_immed_int(imm8_opnd);
-    if (imm8 == 0x0) {
-        instr_t *i1 = INSTR_CREATE_vroundps(dcontext, dst_opnd, src_opnd, opnd_create_immed_int(0x00, OPSZ_1));
+instr_t * /* 815 */
+rw_func_vsubph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vsubph {%k1} %zmm2 %zmm1 -> %zmm0
 #ifdef DEBUG
-        print_rewrite_variadic_instr(dcontext, 1, i1);
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vsubph", true, true, false, true);
 #endif
-        return i1;
+    if (!vph_opnds_supported(instr, false)) {
+        REWRITE_ERROR(STD_ERRF, "vsubph opnd kind not support");
+        return NULL_INSTR;
     }
-    return NULL_INSTR;
+    if (!vph_host_supported("vsubph"))
+        return NULL_INSTR;
+    return vph_arith_gen(dcontext, ilist, instr, OP_vsubps);
 }
 
-instr_t * /* 740 */
-rw_func_vrndscaless(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+instr_t * /* 816 */
+rw_func_vminph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
 {
-    // vrndscaless {%k0} $0x09 %xmm0[12byte] %xmm0[4byte] -> %xmm0
-    // opnd_t mask_opnd = instr_get_src(instr, 0);
-    opnd_t src2_opnd = instr_get_src(instr, 2);
-    opnd_t src3_opnd = instr_get_src(instr, 3); // src3 can be reg/mem
-    opnd_t dst_opnd = instr_get_dst(instr, 0);
+    // vminph {%k1} %zmm2 %zmm1 -> %zmm0
 #ifdef DEBUG
-    opnd_t src1_opnd = instr_get_src(instr, 1);
-    REWRITE_INFO(STD_OUTF, "rewrite %s at %p :", "vrndscaless", instr_start);
-    instr_disassemble(dcontext, instr, STD_OUTF);
-    NEWLINE(STD_OUTF);
-    // dr_print_opnd(dcontext, STD_OUTF, mask_opnd, "mask:");
-    dr_print_opnd(dcontext, STD_OUTF, src1_opnd, "src1:");
-    dr_print_opnd(dcontext, STD_OUTF, src2_opnd, "src2:");
-    dr_print_opnd(dcontext, STD_OUTF, src3_opnd, "src3:");
-    dr_print_opnd(dcontext, STD_OUTF, dst_opnd, "dst:");
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vminph", true, true, false, true);
 #endif
-    instrlist_remove(ilist, instr);
-    instr_destroy(dcontext, instr);
+    if (!vph_opnds_supported(instr, false)) {
+        REWRITE_ERROR(STD_ERRF, "vminph opnd kind not support");
+        return NULL_INSTR;
+    }
+    if (!vph_host_supported("vminph"))
+        return NULL_INSTR;
+    return vph_minmax_gen(dcontext, ilist, instr, false);
+}
 
-    reg_id_t src2_xmm = opnd_get_reg(src2_opnd);
-    reg_id_t src3_xmm = opnd_get_reg(src3_opnd);
-    reg_id_t dst_xmm = opnd_get_reg(dst_opnd);
-    src2_opnd = opnd_create_reg(src2_xmm);
-    src3_opnd = opnd_create_reg(src3_xmm);
-    dst_opnd = opnd_create_reg(dst_xmm);
-    if (src2_xmm == src3_xmm && src3_xmm == dst_xmm) {
-        reg_id_t spill_xmm_reg = find_one_available_spill_xmm(src2_xmm);
-        opnd_t spill_xmm_opnd = opnd_create_reg(spill_xmm_reg);
-        reg_id_t rax_reg = DR_REG_RAX;
-        reg_id_t eax_reg = DR_REG_EAX;
-        opnd_t rax_opnd = opnd_create_reg(rax_reg);
-        opnd_t eax_opnd = opnd_create_reg(eax_reg);
-        // spill_xmm_reg -> tls_slot(spill_xmm_reg)
-        instr_t *i1 =
-            SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_xmm_reg, TLS_ZMM_idx_SLOT(TO_XMM_REG_INDEX(spill_xmm_reg)), OPSZ_16);
-        // push %rax
-        instr_t *i2 = INSTR_CREATE_push(dcontext, rax_opnd);
-        // extractps $3, %xmm0 %eax
-        instr_t *i3 = INSTR_CREATE_extractps(dcontext, eax_opnd, src3_opnd, opnd_create_immed_int(3, OPSZ_1));
-        // movd %rax, %spill_xmm_reg
-        instr_t *i4 = INSTR_CREATE_movd(dcontext, spill_xmm_opnd, eax_opnd);
-        // vbroadcastss %spill_xmm_reg, %spill_xmm_reg
-        instr_t *i5 = INSTR_CREATE_vbroadcastss(dcontext, spill_xmm_opnd, spill_xmm_opnd);
-        // pop %rax
-        instr_t *i6 = INSTR_CREATE_pop(dcontext, rax_opnd);
-        // vroundss $0x09, spill_xmm_reg, spill_xmm_reg -> spill_xmm_reg
-        instr_t *i7 = INSTR_CREATE_vroundss(dcontext, spill_xmm_opnd, spill_xmm_opnd, spill_xmm_opnd,
-                                            opnd_create_immed_int(0x09, OPSZ_1));
-        // vinsertps $0x10, src2[12byte], spill_xmm_reg -> dst[16byte]
-        instr_t *i8 =
-            INSTR_CREATE_vinsertps(dcontext, dst_opnd, opnd_create_immed_int(0x00, OPSZ_1), src2_opnd, spill_xmm_opnd);
-        // tls_slot(spill_xmm_reg) -> spill_xmm_reg
-        instr_t *i9 = RESTORE_SIMD_FROM_SIZED_TLS(dcontext, spill_xmm_reg,
-                                                  TLS_ZMM_idx_SLOT(TO_XMM_REG_INDEX(spill_xmm_reg)), OPSZ_16);
+instr_t * /* 817 */
+rw_func_vdivph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vdivph {%k1} %zmm2 %zmm1 -> %zmm0
 #ifdef DEBUG
-        print_rewrite_variadic_instr(dcontext, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vdivph", true, true, false, true);
 #endif
-        instrlist_concat_next_instr(ilist, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
-        return i1;
-    } else { // not all the three operands are same registers
-        if (src2_xmm == dst_xmm) {
-            // vrndscaless {%k0} $0x09 %xmm2[12byte] %xmm1[4byte] -> %xmm2[16byte] | onlye 4 byte are changed
-            //                    src1  src2          src3            dst
-            reg_id_t spill_xmm_reg = find_available_spill_xmm_avoiding(src2_xmm, dst_xmm, DR_REG_NULL);
-            opnd_t spill_xmm_opnd = opnd_create_reg(spill_xmm_reg);
-            reg_id_t rax_reg = DR_REG_RAX;
-            reg_id_t eax_reg = DR_REG_EAX;
-            opnd_t rax_opnd = opnd_create_reg(rax_reg);
-            opnd_t eax_opnd = opnd_create_reg(eax_reg);
-            // spill_xmm_reg -> tls_slot(spill_xmm_reg)
-            instr_t *i1 = SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_xmm_reg,
-                                                 TLS_ZMM_idx_SLOT(TO_XMM_REG_INDEX(spill_xmm_reg)), OPSZ_16);
-            // push %rax
-            instr_t *i2 = INSTR_CREATE_push(dcontext, rax_opnd);
-            // extractps $3, %xmm0 %eax
-            instr_t *i3 = INSTR_CREATE_extractps(dcontext, eax_opnd, src3_opnd, opnd_create_immed_int(3, OPSZ_1));
-            // movd %rax, %spill_xmm_reg
-            instr_t *i4 = INSTR_CREATE_movd(dcontext, spill_xmm_opnd, eax_opnd);
-            // vbroadcastss %spill_xmm_reg, %spill_xmm_reg
-            instr_t *i5 = INSTR_CREATE_vbroadcastss(dcontext, spill_xmm_opnd, spill_xmm_opnd);
-            // pop %rax
-            instr_t *i6 = INSTR_CREATE_pop(dcontext, rax_opnd);
-            // vroundss $0x09, spill_xmm_reg, spill_xmm_reg -> spill_xmm_reg
-            instr_t *i7 = INSTR_CREATE_vroundss(dcontext, spill_xmm_opnd, spill_xmm_opnd, spill_xmm_opnd,
-                                                opnd_create_immed_int(0x09, OPSZ_1));
-            // vinsertps $0x10, src2[12byte], spill_xmm_reg -> dst[16byte]
-            instr_t *i8 = INSTR_CREATE_vinsertps(dcontext, dst_opnd, opnd_create_immed_int(0x00, OPSZ_1), src2_opnd,
-                                                 spill_xmm_opnd);
-            // tls_slot(spill_xmm_reg) -> spill_xmm_reg
-            instr_t *i9 = RESTORE_SIMD_FROM_SIZED_TLS(dcontext, spill_xmm_reg,
-                                                      TLS_ZMM_idx_SLOT(TO_XMM_REG_INDEX(spill_xmm_reg)), OPSZ_16);
+    if (!vph_opnds_supported(instr, false)) {
+        REWRITE_ERROR(STD_ERRF, "vdivph opnd kind not support");
+        return NULL_INSTR;
+    }
+    if (!vph_host_supported("vdivph"))
+        return NULL_INSTR;
+    return vph_arith_gen(dcontext, ilist, instr, OP_vdivps);
+}
+
+instr_t * /* 818 */
+rw_func_vmaxph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vmaxph {%k1} %zmm2 %zmm1 -> %zmm0
 #ifdef DEBUG
-            print_rewrite_variadic_instr(dcontext, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vmaxph", true, true, false, true);
 #endif
-            instrlist_concat_next_instr(ilist, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
-            return i1;
-        }
-        reg_id_t spill_xmm_reg = find_available_spill_xmm_avoiding_variadic(3, src2_xmm, src3_xmm, dst_xmm);
-        opnd_t spill_xmm_opnd = opnd_create_reg(spill_xmm_reg);
-        reg_id_t rax_reg = DR_REG_RAX;
-        reg_id_t eax_reg = DR_REG_EAX;
-        opnd_t rax_opnd = opnd_create_reg(rax_reg);
-        opnd_t eax_opnd = opnd_create_reg(eax_reg);
-        // spill_xmm_reg -> tls_slot(spill_xmm_reg)
-        instr_t *i1 =
-            SAVE_SIMD_TO_SIZED_TLS(dcontext, spill_xmm_reg, TLS_ZMM_idx_SLOT(TO_XMM_REG_INDEX(spill_xmm_reg)), OPSZ_16);
-        // push %rax
-        instr_t *i2 = INSTR_CREATE_push(dcontext, rax_opnd);
-        // extractps $3, %xmm0 %eax
-        instr_t *i3 = INSTR_CREATE_extractps(dcontext, eax_opnd, src3_opnd, opnd_create_immed_int(3, OPSZ_1));
-        // movd %rax, %spill_xmm_reg
-        instr_t *i4 = INSTR_CREATE_movd(dcontext, spill_xmm_opnd, eax_opnd);
-        // vbroadcastss %spill_xmm_reg, %spill_xmm_reg
-        instr_t *i5 = INSTR_CREATE_vbroadcastss(dcontext, spill_xmm_opnd, spill_xmm_opnd);
-        // pop %rax
-        instr_t *i6 = INSTR_CREATE_pop(dcontext, rax_opnd);
-        // vroundss $0x09, spill_xmm_reg, spill_xmm_reg -> spill_xmm_reg
-        instr_t *i7 = INSTR_CREATE_vroundss(dcontext, spill_xmm_opnd, spill_xmm_opnd, spill_xmm_opnd,
-                                            opnd_create_immed_int(0x09, OPSZ_1));
-        // vinsertps $0x10, src2[12byte], spill_xmm_reg -> dst[16byte]
-        instr_t *i8 =
-            INSTR_CREATE_vinsertps(dcontext, dst_opnd, opnd_create_immed_int(0x00, OPSZ_1), src2_opnd, spill_xmm_opnd);
-        // tls_slot(spill_xmm_reg) -> spill_xmm_reg
-        instr_t *i9 = RESTORE_SIMD_FROM_SIZED_TLS(dcontext, spill_xmm_reg,
-                                                  TLS_ZMM_idx_SLOT(TO_XMM_REG_INDEX(spill_xmm_reg)), OPSZ_16);
+    if (!vph_opnds_supported(instr, false)) {
+        REWRITE_ERROR(STD_ERRF, "vmaxph opnd kind not support");
+        return NULL_INSTR;
+    }
+    if (!vph_host_supported("vmaxph"))
+        return NULL_INSTR;
+    return vph_minmax_gen(dcontext, ilist, instr, true);
+}
+
+instr_t * /* 819 */
+rw_func_vfmadd132ph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vfmadd132ph {%k1} %zmm2 %zmm1 %zmm0 -> %zmm0
 #ifdef DEBUG
-        print_rewrite_variadic_instr(dcontext, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vfmadd132ph", true, true, false, true);
 #endif
-        instrlist_concat_next_instr(ilist, 9, i1, i2, i3, i4, i5, i6, i7, i8, i9);
-        return i1;
+    if (!vph_opnds_supported(instr, false)) {
+        REWRITE_ERROR(STD_ERRF, "vfmadd132ph opnd kind not support");
+        return NULL_INSTR;
     }
-    return NULL_INSTR;
+    if (!vph_host_supported("vfmadd132ph"))
+        return NULL_INSTR;
+    return vfmaddph_gen(dcontext, ilist, instr, 132);
 }
 
-instr_t * /* 779 */
-rw_func_vrndscalesd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+instr_t * /* 820 */
+rw_func_vfmadd213ph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
 {
-    // vrndscalesd {%k0} $0x09 %xmm0[8byte] 0xffffffa0(%rbp)[8byte] -> %xmm0
-    // opnd_t mask_opnd = instr_get_src(instr, 0);
-    opnd_t src_opnd1 = instr_get_src(instr, 1);
-    opnd_t src_opnd2 = instr_get_src(instr, 2);
-    opnd_t src_opnd3 = instr_get_src(instr, 3); // src3 can be reg/mem
-    opnd_t dst_opnd = instr_get_dst(instr, 0);
+    // vfmadd213ph {%k1} %zmm2 %zmm1 %zmm0 -> %zmm0
 #ifdef DEBUG
-    REWRITE_INFO(STD_OUTF, "rewrite %s at %p :", "vrndscalesd", instr_start);
-    instr_disassemble(dcontext, instr, STD_OUTF);
-    NEWLINE(STD_OUTF);
-    // dr_print_opnd(dcontext, STD_OUTF, mask_opnd, "mask:");
-    dr_print_opnd(dcontext, STD_OUTF, src_opnd1, "src1:");
-    dr_print_opnd(dcontext, STD_OUTF, src_opnd2, "src2:");
-    dr_print_opnd(dcontext, STD_OUTF, src_opnd3, "src3:");
-    dr_print_opnd(dcontext, STD_OUTF, dst_opnd, "dst:");
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vfmadd213ph", true, true, false, true);
 #endif
-    // TODO: change into VEX.LIG.66.0F3A.WIG 0B /r ib VROUNDSD xmm1, xmm2, xmm3/m64, imm8
-    ptr_int_t imm8 = opnd_get_immed_int(src_opnd1);
-    reg_id_t src_reg1 = opnd_get_reg(src_opnd2);
-    reg_id_t dst_reg = opnd_get_reg(dst_opnd);
-    if (src_opnd3.kind == REG_kind) {
-        reg_id_t src_reg2 = opnd_get_reg(src_opnd3);
-        instr_t *new_instr1 =
-            instr_create_1dst_3src(dcontext, OP_vroundsd, create_mapping_xmm_opnd(dcontext, dst_reg),
-                                   create_mapping_xmm_opnd(dcontext, src_reg1),
-                                   create_mapping_xmm_opnd(dcontext, src_reg2), opnd_create_immed_int(imm8, OPSZ_1));
+    if (!vph_opnds_supported(instr, false)) {
+        REWRITE_ERROR(STD_ERRF, "vfmadd213ph opnd kind not support");
+        return NULL_INSTR;
+    }
+    if (!vph_host_supported("vfmadd213ph"))
+        return NULL_INSTR;
+    return vfmaddph_gen(dcontext, ilist, instr, 213);
+}
+
+instr_t * /* 821 */
+rw_func_vfmadd231ph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vfmadd231ph {%k1} %zmm2 %zmm1 %zmm0 -> %zmm0
 #ifdef DEBUG
-        print_rewrite_variadic_instr(dcontext, 1, new_instr1);
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vfmadd231ph", true, true, false, true);
 #endif
-        instrlist_remove(ilist, instr);
-        instr_destroy(dcontext, instr);
-        return new_instr1;
+    if (!vph_opnds_supported(instr, false)) {
+        REWRITE_ERROR(STD_ERRF, "vfmadd231ph opnd kind not support");
+        return NULL_INSTR;
     }
-    if (src_opnd3.kind == BASE_DISP_kind) {
-        // mem
-        instr_t *new_instr1 = instr_create_1dst_3src(dcontext, OP_vroundsd, create_mapping_xmm_opnd(dcontext, dst_reg),
-                                                     create_mapping_xmm_opnd(dcontext, src_reg1), src_opnd3,
-                                                     opnd_create_immed_int(imm8, OPSZ_1));
+    if (!vph_host_supported("vfmadd231ph"))
+        return NULL_INSTR;
+    return vfmaddph_gen(dcontext, ilist, instr, 231);
+}
+
+/* =======================================================
+ *           AVX512 BF16 instr rewrite functions
+ * ======================================================= */
+
+static const uint bf16_exp_mask[8] = { 0x7f800000, 0x7f800000, 0x7f800000, 0x7f800000,
+                                       0x7f800000, 0x7f800000, 0x7f800000, 0x7f800000 };
+static const uint bf16_abs_mask[8] = { 0x7fffffff, 0x7fffffff, 0x7fffffff, 0x7fffffff,
+                                       0x7fffffff, 0x7fffffff, 0x7fffffff, 0x7fffffff };
+static const uint bf16_hi_mask[8] = { 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+                                      0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000 };
+static const uint bf16_round_bias[8] = { 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff };
+static const uint bf16_quiet_bit[8] = { 0x00400000, 0x00400000, 0x00400000, 0x00400000,
+                                        0x00400000, 0x00400000, 0x00400000, 0x00400000 };
+
+/**
+ * @brief Flush fp32 denormals in `x_reg` to signed zero, the DAZ/FTZ behaviour
+ * every BF16 instruction has regardless of MXCSR. `t_reg` is clobbered.
+ */
+static void
+emit_bf16_flush(lower_ctx_t *ctx, reg_id_t x_reg, reg_id_t t_reg)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    opnd_t op_x = opnd_create_reg(x_reg);
+    opnd_t op_t = opnd_create_reg(t_reg);
+    // vpand t, x, exp ; vpcmpeqd t, t, 0.. ; vpand t, t, 0x7fffffff.. ; vpandn x, t, x
+    lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_t, op_x, lower_ctx_const_opnd(ctx, bf16_exp_mask)));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpcmpeqd(dcontext, op_t, op_t, lower_ctx_const_opnd(ctx, fp16_zero_dwords)));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_t, op_t, lower_ctx_const_opnd(ctx, bf16_abs_mask)));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpandn(dcontext, op_x, op_t, op_x));
+}
+
+/**
+ * @brief Round the floats in `x_reg` to bf16, leaving the words packed in its low
+ * 128 (xmm: 64) bits with the rest zeroed.
+ *
+ * Round to nearest even is an integer add of 0x7fff plus the lsb of the kept upper
+ * word; NaNs bypass the add and are quieted instead. `t_reg` and `u_reg` are clobbered.
+ */
+static void
+emit_bf16_narrow(lower_ctx_t *ctx, reg_id_t x_reg, reg_id_t t_reg, reg_id_t u_reg)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    opnd_t op_x = opnd_create_reg(x_reg);
+    opnd_t op_t = opnd_create_reg(t_reg);
+    opnd_t op_u = opnd_create_reg(u_reg);
+    emit_bf16_flush(ctx, x_reg, t_reg);
+    // vpand t, x, 0x7fffffff.. ; vpcmpgtd u, t, exp   ; u = NaN lanes
+    lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_t, op_x, lower_ctx_const_opnd(ctx, bf16_abs_mask)));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpcmpgtd(dcontext, op_u, op_t, lower_ctx_const_opnd(ctx, bf16_exp_mask)));
+    // vpsrld $16, x -> t ; vpand t, t, 1.. ; vpaddd t, t, 0x7fff.. ; vpaddd t, x, t
+    lower_ctx_emit(ctx, INSTR_CREATE_vpsrld(dcontext, op_t, OPND_CREATE_INT8(16), op_x));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_t, op_t, lower_ctx_const_opnd(ctx, fp16_ones_dwords)));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpaddd(dcontext, op_t, op_t, lower_ctx_const_opnd(ctx, bf16_round_bias)));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpaddd(dcontext, op_t, op_x, op_t));
+    // vpor x, x, quiet ; vpblendvb x, t, x, u
+    lower_ctx_emit(ctx, INSTR_CREATE_vpor(dcontext, op_x, op_x, lower_ctx_const_opnd(ctx, bf16_quiet_bit)));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpblendvb(dcontext, op_x, op_t, op_x, op_u));
+    // vpsrld $16, x -> x ; vpackusdw x, x, 0.. ; vpermq $0xd8, x -> x   ; both lanes low, zeros high
+    lower_ctx_emit(ctx, INSTR_CREATE_vpsrld(dcontext, op_x, OPND_CREATE_INT8(16), op_x));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpackusdw(dcontext, op_x, op_x, lower_ctx_const_opnd(ctx, fp16_zero_dwords)));
+    if (!ctx->is_xmm)
+        lower_ctx_emit(ctx, INSTR_CREATE_vpermq(dcontext, op_x, op_x, OPND_CREATE_INT8((sbyte)0xd8)));
+}
+
+/**
+ * The low half of the destination words comes from src2 and the high half from
+ * src1, across the whole vector: a zmm destination half h converts all of src2
+ * (h == 0) or src1 (h == 1). Both halves are held until every source is read.
+ */
+static instr_t *
+vcvtne2ps2bf16_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t hi_opnd = instr_get_src(instr, 1);
+    opnd_t lo_opnd = instr_get_src(instr, 2);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t r_reg[2] = { lower_ctx_get_scratch(&ctx), DR_REG_NULL };
+    reg_id_t s_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t t_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t u_reg = lower_ctx_get_scratch(&ctx);
+    opnd_t op_s = opnd_create_reg(s_reg);
+    if (ctx.num_halves == 2)
+        r_reg[1] = lower_ctx_get_scratch(&ctx);
+
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        opnd_t first_opnd = ctx.num_halves == 2 ? (half == 0 ? lo_opnd : hi_opnd) : lo_opnd;
+        opnd_t second_opnd = ctx.num_halves == 2 ? first_opnd : hi_opnd;
+        uint second_half = ctx.num_halves == 2 ? LOWER_HALF_HIGH : LOWER_HALF_LOW;
+        opnd_t op_r = opnd_create_reg(r_reg[half]);
+        lower_ctx_load_half(&ctx, r_reg[half], first_opnd, LOWER_HALF_LOW);
+        emit_bf16_narrow(&ctx, r_reg[half], t_reg, u_reg);
+        lower_ctx_load_half(&ctx, s_reg, second_opnd, second_half);
+        emit_bf16_narrow(&ctx, s_reg, t_reg, u_reg);
+        if (ctx.is_xmm) {
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpunpcklqdq(dcontext, op_r, op_r, op_s));
+        } else {
+            lower_ctx_emit(&ctx, INSTR_CREATE_vinserti128(dcontext, op_r, op_r, opnd_create_reg(YMM_TO_XMM(s_reg)),
+                                                          OPND_CREATE_INT8(1)));
+        }
+    }
+    for (uint half = 0; half < ctx.num_halves; half++)
+        lower_ctx_store_half_masked(&ctx, half, r_reg[half], 2, t_reg, u_reg);
+    instr_t *first = lower_ctx_finish(&ctx);
 #ifdef DEBUG
-        print_rewrite_variadic_instr(dcontext, 1, new_instr1);
+    print_rewrite_instr_chain(dcontext, first);
 #endif
-        instrlist_remove(ilist, instr);
-        instr_destroy(dcontext, instr);
-        return new_instr1;
+    return first;
+}
+
+/**
+ * The destination is half as wide as the source, whose width only L'L tells: a
+ * ymm, m256 or {1to8} source narrows into an xmm just like an xmm one does.
+ * The conversion runs as wide as the source (two halves for a zmm), the opmask
+ * is applied at the destination width, and everything above the 4, 8 or 16
+ * result words is zeroed, the TLS upper half of the zmm included.
+ */
+static instr_t *
+vcvtneps2bf16_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t src_opnd = instr_get_src(instr, 1);
+    uint src_bytes = lower_instr_vector_bytes(instr);
+    bool dst_xmm = src_bytes != 64;
+    uint dst_idx = reg_resize_to_opsz(ctx.dst_reg, OPSZ_64) - DR_REG_ZMM0;
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    // the decoder names the destination in the class of the source, sized to half of it
+    ctx.dst_reg = reg_resize_to_opsz(ctx.dst_reg, dst_xmm ? OPSZ_16 : OPSZ_32);
+    ctx.num_halves = 1;
+
+    ctx.is_xmm = src_bytes == 16;
+    reg_id_t r_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t t_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t u_reg = lower_ctx_get_scratch(&ctx);
+    lower_ctx_load_half(&ctx, r_reg, src_opnd, LOWER_HALF_LOW);
+    emit_bf16_narrow(&ctx, r_reg, t_reg, u_reg);
+    if (src_bytes == 64) {
+        reg_id_t s_reg = lower_ctx_get_scratch(&ctx);
+        lower_ctx_load_half(&ctx, s_reg, src_opnd, LOWER_HALF_HIGH);
+        emit_bf16_narrow(&ctx, s_reg, t_reg, u_reg);
+        lower_ctx_emit(&ctx, INSTR_CREATE_vinserti128(dcontext, opnd_create_reg(r_reg), opnd_create_reg(r_reg),
+                                                      opnd_create_reg(YMM_TO_XMM(s_reg)), OPND_CREATE_INT8(1)));
+    } else if (!ctx.is_xmm) {
+        // the 8 words sit in the low lane of a ymm scratch
+        r_reg = YMM_TO_XMM(r_reg);
+        t_reg = YMM_TO_XMM(t_reg);
+        u_reg = YMM_TO_XMM(u_reg);
+    }
+    ctx.is_xmm = dst_xmm;
+    opnd_t op_r = opnd_create_reg(r_reg);
+    if (ctx.mask_reg != DR_REG_NULL) {
+        lower_ctx_k_lane_mask(&ctx, t_reg, ctx.mask_reg, 2, LOWER_HALF_LOW);
+        if (ctx.zero_mask) {
+            // vpand r, r, lane_mask
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_r, op_r, opnd_create_reg(t_reg)));
+        } else {
+            // vpblendvb r, old_dst, r, lane_mask
+            lower_ctx_load_half(&ctx, u_reg, opnd_create_reg(ctx.dst_reg), LOWER_HALF_LOW);
+            lower_ctx_emit(&ctx, INSTR_CREATE_vpblendvb(dcontext, op_r, opnd_create_reg(u_reg), op_r,
+                                                        opnd_create_reg(t_reg)));
+        }
+        // vmovq r, r   ; words 4-7 of an xmm source's result are zero whatever the mask
+        if (src_bytes == 16)
+            lower_ctx_emit(&ctx, INSTR_CREATE_vmovq(dcontext, op_r, op_r));
     }
-    return NULL_INSTR;
+    // an xmm result is stored as the whole ymm, whose upper lane the vex ops above cleared
+    ctx.is_xmm = false;
+    lower_ctx_store_half(&ctx, LOWER_HALF_LOW, dst_xmm ? XMM_TO_YMM(r_reg) : r_reg);
+    // vpxor t, t, t ; t -> tls(dst, high)
+    reg_id_t t_ymm = dst_xmm ? XMM_TO_YMM(t_reg) : t_reg;
+    lower_ctx_emit(&ctx, INSTR_CREATE_vpxor(dcontext, opnd_create_reg(t_ymm), opnd_create_reg(t_ymm),
+                                            opnd_create_reg(t_ymm)));
+    lower_ctx_emit(&ctx, SAVE_SIMD_TO_SIZED_TLS(dcontext, t_ymm, TLS_ZMM_idx_SLOT(dst_idx) + SIZE_OF_YMM, OPSZ_32));
+    ctx.is_xmm = dst_xmm;
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
 }
 
-instr_t * /* 767 */
-rw_func_vshufi32x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+/**
+ * dst.fp32[i] += src1.bf16[2i+1] * src2.bf16[2i+1], then += the even pair. A
+ * bf16 widens to fp32 by a 16-bit shift (odd elements by masking the low word),
+ * each step is one FMA, and every operand and result is flushed as DAZ/FTZ.
+ */
+static instr_t *
+vdpbf16ps_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr)
 {
-    // vshufi32x4 {%k0} $0x02 %ymm1 %ymm6 -> %ymm1
-    opnd_t mask_opnd = instr_get_src(instr, 0);
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t acc_opnd = instr_get_dst(instr, 0);
     opnd_t src1_opnd = instr_get_src(instr, 1);
     opnd_t src2_opnd = instr_get_src(instr, 2);
-    opnd_t src3_opnd = instr_get_src(instr, 3);
-    opnd_t dst_opnd = instr_get_dst(instr, 0);
-#if DEBUG
-    REWRITE_INFO(STD_OUTF, "rewrite %s at %p :", "vshufi32x4", instr_start);
-    instr_disassemble(dcontext, instr, STD_OUTF);
-    NEWLINE(STD_OUTF);
-    dr_print_opnd(dcontext, STD_OUTF, mask_opnd, "mask:");
-    dr_print_opnd(dcontext, STD_OUTF, src1_opnd, "src1:");
-    dr_print_opnd(dcontext, STD_OUTF, src2_opnd, "src2:");
-    dr_print_opnd(dcontext, STD_OUTF, src3_opnd, "src3:");
-    dr_print_opnd(dcontext, STD_OUTF, dst_opnd, "dst:");
-#endif
-    int k_idx = TO_K_REG_INDEX(opnd_get_reg(mask_opnd));
-    int imm8 = opnd_get_immed_int(src1_opnd);
-    if (k_idx == 0) {
-        instrlist_remove(ilist, instr);
-        instr_destroy(dcontext, instr);
-        switch (imm8) {
-        case 0x00: {
-            // vshufi32x4 $0x00: low 128 from src2[127:0], high 128 from src3[127:0]
-            opnd_t imm_0x20 = opnd_create_immed_int(0x20, OPSZ_1);
-            instr_t *i1 = instr_create_1dst_3src(dcontext, OP_vperm2i128, dst_opnd, src2_opnd, src3_opnd, imm_0x20);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t acc_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t a_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t b_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t x_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t y_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t t_reg = lower_ctx_get_scratch(&ctx);
+    opnd_t op_acc = opnd_create_reg(acc_reg);
+    opnd_t op_x = opnd_create_reg(x_reg);
+    opnd_t op_y = opnd_create_reg(y_reg);
+
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        lower_ctx_load_half(&ctx, acc_reg, acc_opnd, half);
+        emit_bf16_flush(&ctx, acc_reg, t_reg);
+        opnd_t op_a = opnd_create_reg(lower_ctx_src_half(&ctx, a_reg, src1_opnd, half));
+        opnd_t op_b = opnd_create_reg(lower_ctx_src_half(&ctx, b_reg, src2_opnd, half));
+        for (uint pass = 0; pass < 2; pass++) {
+            if (pass == 0) {
+                // vpand x, a, 0xffff0000.. ; vpand y, b, 0xffff0000..
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_x, op_a, lower_ctx_const_opnd(&ctx, bf16_hi_mask)));
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpand(dcontext, op_y, op_b, lower_ctx_const_opnd(&ctx, bf16_hi_mask)));
+            } else {
+                // vpslld $16, a -> x ; vpslld $16, b -> y
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpslld(dcontext, op_x, OPND_CREATE_INT8(16), op_a));
+                lower_ctx_emit(&ctx, INSTR_CREATE_vpslld(dcontext, op_y, OPND_CREATE_INT8(16), op_b));
+            }
+            emit_bf16_flush(&ctx, x_reg, t_reg);
+            emit_bf16_flush(&ctx, y_reg, t_reg);
+            // vfmadd231ps acc, x, y
+            lower_ctx_emit(&ctx, INSTR_CREATE_vfmadd231ps(dcontext, op_acc, op_x, op_y));
+            emit_bf16_flush(&ctx, acc_reg, t_reg);
+        }
+        lower_ctx_store_half_masked(&ctx, half, acc_reg, 4, x_reg, y_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
 #ifdef DEBUG
-            print_rewrite_variadic_instr(dcontext, 1, i1);
+    print_rewrite_instr_chain(dcontext, first);
 #endif
-            return i1;
-        } break;
-        case 0x01: {
-            // vshufi32x4 $0x01: low 128 from src2[255:128], high 128 from src3[127:0]
-            opnd_t imm_0x21 = opnd_create_immed_int(0x21, OPSZ_1);
-            instr_t *i1 = instr_create_1dst_3src(dcontext, OP_vperm2i128, dst_opnd, src2_opnd, src3_opnd, imm_0x21);
+    return first;
+}
+
+instr_t * /* 795 */
+rw_func_vcvtne2ps2bf16(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vcvtne2ps2bf16 {%k1} %zmm2 %zmm1/m512/m32bcst -> %zmm0
 #ifdef DEBUG
-            print_rewrite_variadic_instr(dcontext, 1, i1);
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vcvtne2ps2bf16", true, true, false, true);
 #endif
-            return i1;
-        } break;
-        case 0x02: {
-            // vshufi32x4 $0x02: low 128 from src2[127:0], high 128 from src3[255:128]
-            opnd_t imm_0x30 = opnd_create_immed_int(0x30, OPSZ_1);
-            instr_t *i1 = instr_create_1dst_3src(dcontext, OP_vperm2i128, dst_opnd, src2_opnd, src3_opnd, imm_0x30);
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vcvtne2ps2bf16 opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vcvtne2ps2bf16_gen(dcontext, ilist, instr);
+}
+
+instr_t * /* 796 */
+rw_func_vcvtneps2bf16(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vcvtneps2bf16 {%k1} %zmm1/m512/m32bcst -> %ymm0
 #ifdef DEBUG
-            print_rewrite_variadic_instr(dcontext, 1, i1);
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vcvtneps2bf16", true, true, false, true);
 #endif
-            return i1;
-        } break;
-        case 0x03: {
-            // vshufi32x4 $0x03: low 128 from src2[255:128], high 128 from src3[255:128]
-            opnd_t imm_0x31 = opnd_create_immed_int(0x31, OPSZ_1);
-            instr_t *i1 = instr_create_1dst_3src(dcontext, OP_vperm2i128, dst_opnd, src2_opnd, src3_opnd, imm_0x31);
+    opnd_t src_opnd = instr_get_src(instr, 1);
+    if (!opnd_is_reg(instr_get_dst(instr, 0)) || !(opnd_is_reg(src_opnd) || opnd_is_memory_reference(src_opnd))) {
+        REWRITE_ERROR(STD_ERRF, "vcvtneps2bf16 opnd kind not support");
+        return NULL_INSTR;
+    }
+    return vcvtneps2bf16_gen(dcontext, ilist, instr);
+}
+
+instr_t * /* 797 */
+rw_func_vdpbf16ps(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
+{
+    // vdpbf16ps {%k1} %zmm2 %zmm1/m512/m32bcst -> %zmm0
 #ifdef DEBUG
-            print_rewrite_variadic_instr(dcontext, 1, i1);
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "vdpbf16ps", true, true, false, true);
 #endif
-            return i1;
-        } break;
-        default: {
-            REWRITE_ERROR(STD_OUTF, "vshufi32x4 imm8 %d not supported", imm8);
-            return NULL_INSTR;
-        }
-        }
+    if (!lower_binop_opnds_supported(instr)) {
+        REWRITE_ERROR(STD_ERRF, "vdpbf16ps opnd kind not support");
         return NULL_INSTR;
-    } else {
+    }
+    if (!proc_has_feature(FEATURE_FMA)) {
+        REWRITE_ERROR(STD_ERRF, "vdpbf16ps needs FMA on the host");
         return NULL_INSTR;
     }
-    return NULL_INSTR;
+    return vdpbf16ps_gen(dcontext, ilist, instr);
+}
+
+void
+rewrite_init(void)
+{
+    compress_lut_init();
+    // VEX.256 VAES/VPCLMULQDQ also exist on hosts without AVX-512 (e.g. Zen 3, Alder Lake)
+    host_has_vaes_ymm = proc_has_feature(FEATURE_VAES) && proc_has_feature(FEATURE_AVX2);
+    host_has_vpclmulqdq_ymm = proc_has_feature(FEATURE_VPCLMULQDQ) && proc_has_feature(FEATURE_AVX2);
+    host_has_gfni_ymm = proc_has_feature(FEATURE_GFNI) && proc_has_feature(FEATURE_AVX2);
 }
 
 /* =======================================================
@@ -44998,7 +48436,7 @@ rw_func_knotw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc i
     // not %ax
     instr_t *i4 = INSTR_CREATE_not(dcontext, spill_gpr16_opnd);
     // and $0xffff, %ax (clear higher bits - ensure only lower 16 bits are set)
-    instr_t *i5 = INSTR_CREATE_and(dcontext, spill_gpr16_opnd, OPND_CREATE_INT16(0xffff));
+    instr_t *i5 = INSTR_CREATE_and(dcontext, spill_gpr16_opnd, OPND_CREATE_INT16((short)0xffff));
     // mov %ax, tls_slot(output_mask)
     instr_t *i6 = SAVE_TO_SIZED_TLS(dcontext, spill_gpr16, TLS_K_idx_SLOT(output_k_idx), OPSZ_2);
     // pop rax
@@ -45051,7 +48489,7 @@ rw_func_knotb(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc i
     // not %al
     instr_t *i4 = INSTR_CREATE_not(dcontext, spill_gpr8_opnd);
     // and $0xff, %al (clear higher bits - ensure only lower 8 bits are set)
-    instr_t *i5 = INSTR_CREATE_and(dcontext, spill_gpr8_opnd, OPND_CREATE_INT8(0xff));
+    instr_t *i5 = INSTR_CREATE_and(dcontext, spill_gpr8_opnd, OPND_CREATE_INT8((sbyte)0xff));
     // mov %al, tls_slot(output_mask)
     instr_t *i6 = SAVE_TO_SIZED_TLS(dcontext, spill_gpr8, TLS_K_idx_SLOT(output_k_idx), OPSZ_1);
     // pop rax
@@ -45153,7 +48591,7 @@ rw_func_knotd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc i
     // not %eax
     instr_t *i4 = INSTR_CREATE_not(dcontext, spill_gpr32_opnd);
     // and $0xffffffff, %eax (clear higher bits - ensure only lower 32 bits are set)
-    instr_t *i5 = INSTR_CREATE_and(dcontext, spill_gpr32_opnd, OPND_CREATE_INT32(0xffffffff));
+    instr_t *i5 = INSTR_CREATE_and(dcontext, spill_gpr32_opnd, OPND_CREATE_INT32((int)0xffffffff));
     // mov %eax, tls_slot(output_mask)
     instr_t *i6 = SAVE_TO_SIZED_TLS(dcontext, spill_gpr32, TLS_K_idx_SLOT(output_k_idx), OPSZ_4);
     // pop rax
@@ -45219,7 +48657,7 @@ rw_func_korw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc in
     // or %bx, %ax
     instr_t *i6 = INSTR_CREATE_or(dcontext, spill_gpr16_1_opnd, spill_gpr16_2_opnd);
     // and $0xffff, %ax (clear higher bits - ensure only lower 16 bits are set)
-    instr_t *i7 = INSTR_CREATE_and(dcontext, spill_gpr16_1_opnd, OPND_CREATE_INT16(0xffff));
+    instr_t *i7 = INSTR_CREATE_and(dcontext, spill_gpr16_1_opnd, OPND_CREATE_INT16((short)0xffff));
     // mov %ax, tls_slot(output_mask)
     instr_t *i8 = SAVE_TO_SIZED_TLS(dcontext, spill_gpr16_1, TLS_K_idx_SLOT(output_k_idx), OPSZ_2);
     // pop rbx
@@ -45287,7 +48725,7 @@ rw_func_korb(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc in
     // or %bl, %al
     instr_t *i6 = INSTR_CREATE_or(dcontext, spill_gpr8_1_opnd, spill_gpr8_2_opnd);
     // and $0xff, %al (clear higher bits - ensure only lower 8 bits are set)
-    instr_t *i7 = INSTR_CREATE_and(dcontext, spill_gpr8_1_opnd, OPND_CREATE_INT8(0xff));
+    instr_t *i7 = INSTR_CREATE_and(dcontext, spill_gpr8_1_opnd, OPND_CREATE_INT8((sbyte)0xff));
     // mov %al, tls_slot(output_mask)
     instr_t *i8 = SAVE_TO_SIZED_TLS(dcontext, spill_gpr8_1, TLS_K_idx_SLOT(output_k_idx), OPSZ_1);
     // pop rbx
@@ -45417,7 +48855,7 @@ rw_func_kord(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc in
     // or %ebx, %eax
     instr_t *i6 = INSTR_CREATE_or(dcontext, spill_gpr32_1_opnd, spill_gpr32_2_opnd);
     // and $0xffffffff, %eax (clear higher bits - ensure only lower 32 bits are set)
-    instr_t *i7 = INSTR_CREATE_and(dcontext, spill_gpr32_1_opnd, OPND_CREATE_INT32(0xffffffff));
+    instr_t *i7 = INSTR_CREATE_and(dcontext, spill_gpr32_1_opnd, OPND_CREATE_INT32((int)0xffffffff));
     // mov %eax, tls_slot(output_mask)
     instr_t *i8 = SAVE_TO_SIZED_TLS(dcontext, spill_gpr32_1, TLS_K_idx_SLOT(output_k_idx), OPSZ_4);
     // pop rbx
@@ -46475,122 +49913,80 @@ rw_func_kortestb(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_p
     return NULL_INSTR;
 }
 
+/**
+ * @brief kortestq and kortestd: ZF := (SRC1 | SRC2) == 0, CF := (SRC1 | SRC2) is all ones,
+ *        OF, SF, AF and PF cleared.
+ *
+ * SRC1 is in the modrm.reg field, which the decoder gives as dst 0. The flags are built
+ * in %ah and loaded with sahf, after an xor has cleared OF.
+ */
+static instr_t *
+kortest_dq_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, opnd_size_t size)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    uint k1_idx = TO_K_REG_INDEX(opnd_get_reg(instr_get_dst(instr, 0)));
+    uint k2_idx = TO_K_REG_INDEX(opnd_get_reg(instr_get_src(instr, 0)));
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t tmp = lower_ctx_get_gpr(&ctx, opnd_create_null());   // %rax
+    reg_id_t other = lower_ctx_get_gpr(&ctx, opnd_create_null()); // %rbx
+    if (size == OPSZ_4) {
+        tmp = reg_64_to_32(tmp);
+        other = reg_64_to_32(other);
+    }
+    opnd_t tmp_opnd = opnd_create_reg(tmp);
+    opnd_t other_opnd = opnd_create_reg(other);
+    // tmp := k1 | k2
+    lower_ctx_emit(&ctx, RESTORE_FROM_SIZED_TLS(dcontext, tmp, TLS_K_idx_SLOT(k1_idx), size));
+    lower_ctx_emit(&ctx, RESTORE_FROM_SIZED_TLS(dcontext, other, TLS_K_idx_SLOT(k2_idx), size));
+    lower_ctx_emit(&ctx, INSTR_CREATE_or(dcontext, tmp_opnd, other_opnd));
+    // %bl := ZF, %bh := CF
+    lower_ctx_emit(&ctx, INSTR_CREATE_test(dcontext, tmp_opnd, tmp_opnd));
+    lower_ctx_emit(&ctx, INSTR_CREATE_setcc(dcontext, OP_setz, opnd_create_reg(DR_REG_BL)));
+    lower_ctx_emit(&ctx, INSTR_CREATE_cmp(dcontext, tmp_opnd, OPND_CREATE_INT8(-1)));
+    lower_ctx_emit(&ctx, INSTR_CREATE_setcc(dcontext, OP_setz, opnd_create_reg(DR_REG_BH)));
+    // %ah := ZF << 6 | CF
+    lower_ctx_emit(&ctx, INSTR_CREATE_movzx(dcontext, opnd_create_reg(DR_REG_EAX), opnd_create_reg(DR_REG_BL)));
+    lower_ctx_emit(&ctx, INSTR_CREATE_shl(dcontext, opnd_create_reg(DR_REG_EAX), OPND_CREATE_INT8(6)));
+    lower_ctx_emit(&ctx, INSTR_CREATE_or(dcontext, opnd_create_reg(DR_REG_AL), opnd_create_reg(DR_REG_BH)));
+    lower_ctx_emit(&ctx, INSTR_CREATE_mov_ld(dcontext, opnd_create_reg(DR_REG_AH), opnd_create_reg(DR_REG_AL)));
+    lower_ctx_emit(&ctx, INSTR_CREATE_xor(dcontext, opnd_create_reg(DR_REG_EBX), opnd_create_reg(DR_REG_EBX)));
+    lower_ctx_emit(&ctx, INSTR_CREATE_sahf(dcontext));
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
 instr_t * /* 509 */
 rw_func_kortestq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
 {
     // kortestq %k1, %k2 - Test 64-bit mask registers and set flags
-    // TEMP1 := SRC1[63:0] OR SRC2[63:0]
-    // SF := 0; OF := 0; AF := 0; PF := 0
-    // IF TEMP1 = 0 THEN ZF := 1 ELSE ZF := 0 FI
-    // TEMP2 := SRC1[63:0] AND SRC2[63:0]
-    // IF TEMP2 = 0 THEN CF := 1 ELSE CF := 0 FI
-    opnd_t src1_opnd = instr_get_src(instr, 0);
-    opnd_t src2_opnd = instr_get_src(instr, 1);
-#ifdef DEBUG
-    REWRITE_INFO(STD_OUTF, "==== Rewriting kortestq at %p ====", instr_start);
-    instr_disassemble(dcontext, instr, STD_OUTF);
-    NEWLINE(STD_OUTF);
-    dr_print_opnd(dcontext, STD_OUTF, src1_opnd, "input src1: ");
-    dr_print_opnd(dcontext, STD_OUTF, src2_opnd, "input src2: ");
-#endif
-    reg_id_t input_mask1 = opnd_get_reg(src1_opnd);
-    reg_id_t input_mask2 = opnd_get_reg(src2_opnd);
-    uint input_k1_idx = TO_K_REG_INDEX(input_mask1);
-    uint input_k2_idx = TO_K_REG_INDEX(input_mask2);
-
-    reg_id_t spill_gpr64_1 = DR_REG_RAX;
-    reg_id_t spill_gpr64_2 = DR_REG_RBX;
-
-    opnd_t spill_gpr64_1_opnd = opnd_create_reg(spill_gpr64_1);
-    opnd_t spill_gpr64_2_opnd = opnd_create_reg(spill_gpr64_2);
-
-    // pushfq
-    instr_t *i1 = INSTR_CREATE_pushf(dcontext);
-    // push rax
-    instr_t *i2 = INSTR_CREATE_push(dcontext, spill_gpr64_1_opnd);
-    // push rbx
-    instr_t *i3 = INSTR_CREATE_push(dcontext, spill_gpr64_2_opnd);
-    // tls_slot(input_mask1) -> %rax
-    instr_t *i4 = RESTORE_FROM_SIZED_TLS(dcontext, spill_gpr64_1, TLS_K_idx_SLOT(input_k1_idx), OPSZ_8);
-    // tls_slot(input_mask2) -> %rbx
-    instr_t *i5 = RESTORE_FROM_SIZED_TLS(dcontext, spill_gpr64_2, TLS_K_idx_SLOT(input_k2_idx), OPSZ_8);
-    // or %rbx, %rax - compute OR for ZF
-    instr_t *i6 = INSTR_CREATE_or(dcontext, spill_gpr64_1_opnd, spill_gpr64_2_opnd);
-    // tls_slot(input_mask1) -> %rax (reload for AND operation)
-    instr_t *i7 = RESTORE_FROM_SIZED_TLS(dcontext, spill_gpr64_1, TLS_K_idx_SLOT(input_k1_idx), OPSZ_8);
-    // and %rbx, %rax - compute AND for CF
-    instr_t *i8 = INSTR_CREATE_and(dcontext, spill_gpr64_1_opnd, spill_gpr64_2_opnd);
-    // pop rbx
-    instr_t *i9 = INSTR_CREATE_pop(dcontext, spill_gpr64_2_opnd);
-    // pop rax
-    instr_t *i10 = INSTR_CREATE_pop(dcontext, spill_gpr64_1_opnd);
-    // popfq
-    instr_t *i11 = INSTR_CREATE_popf(dcontext);
-
+    // TEMP := SRC1[63:0] OR SRC2[63:0]
+    // IF TEMP = 0 THEN ZF := 1 ELSE ZF := 0 FI
+    // IF TEMP = FFFFFFFF_FFFFFFFFh THEN CF := 1 ELSE CF := 0 FI
+    // OF := 0; SF := 0; AF := 0; PF := 0
 #ifdef DEBUG
-    print_rewrite_variadic_instr(dcontext, 11, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11);
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "kortestq", true, false, false, true);
 #endif
-    instrlist_concat_next_instr(ilist, 11, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11);
-    return i1;
+    return kortest_dq_gen(dcontext, ilist, instr, OPSZ_8);
 }
 
 instr_t * /* 510 */
 rw_func_kortestd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start)
 {
     // kortestd %k1, %k2 - Test 32-bit mask registers and set flags
-    // TEMP1 := SRC1[31:0] OR SRC2[31:0]
-    // SF := 0; OF := 0; AF := 0; PF := 0
-    // IF TEMP1 = 0 THEN ZF := 1 ELSE ZF := 0 FI
-    // TEMP2 := SRC1[31:0] AND SRC2[31:0]
-    // IF TEMP2 = 0 THEN CF := 1 ELSE CF := 0 FI
-    opnd_t src1_opnd = instr_get_src(instr, 0);
-    opnd_t src2_opnd = instr_get_src(instr, 1);
-#ifdef DEBUG
-    REWRITE_INFO(STD_OUTF, "==== Rewriting kortestd at %p ====", instr_start);
-    instr_disassemble(dcontext, instr, STD_OUTF);
-    NEWLINE(STD_OUTF);
-    dr_print_opnd(dcontext, STD_OUTF, src1_opnd, "input src1: ");
-    dr_print_opnd(dcontext, STD_OUTF, src2_opnd, "input src2: ");
-#endif
-    reg_id_t input_mask1 = opnd_get_reg(src1_opnd);
-    reg_id_t input_mask2 = opnd_get_reg(src2_opnd);
-    uint input_k1_idx = TO_K_REG_INDEX(input_mask1);
-    uint input_k2_idx = TO_K_REG_INDEX(input_mask2);
-
-    reg_id_t spill_gpr32_1 = DR_REG_EAX;
-    reg_id_t spill_gpr32_2 = DR_REG_EBX;
-
-    opnd_t spill_gpr32_1_opnd = opnd_create_reg(spill_gpr32_1);
-    opnd_t spill_gpr32_2_opnd = opnd_create_reg(spill_gpr32_2);
-
-    // pushfq
-    instr_t *i1 = INSTR_CREATE_pushf(dcontext);
-    // push rax
-    instr_t *i2 = INSTR_CREATE_push(dcontext, opnd_create_reg(DR_REG_RAX));
-    // push rbx
-    instr_t *i3 = INSTR_CREATE_push(dcontext, opnd_create_reg(DR_REG_RBX));
-    // tls_slot(input_mask1) -> %eax
-    instr_t *i4 = RESTORE_FROM_SIZED_TLS(dcontext, spill_gpr32_1, TLS_K_idx_SLOT(input_k1_idx), OPSZ_4);
-    // tls_slot(input_mask2) -> %ebx
-    instr_t *i5 = RESTORE_FROM_SIZED_TLS(dcontext, spill_gpr32_2, TLS_K_idx_SLOT(input_k2_idx), OPSZ_4);
-    // or %ebx, %eax - compute OR for ZF
-    instr_t *i6 = INSTR_CREATE_or(dcontext, spill_gpr32_1_opnd, spill_gpr32_2_opnd);
-    // tls_slot(input_mask1) -> %eax (reload for AND operation)
-    instr_t *i7 = RESTORE_FROM_SIZED_TLS(dcontext, spill_gpr32_1, TLS_K_idx_SLOT(input_k1_idx), OPSZ_4);
-    // and %ebx, %eax - compute AND for CF
-    instr_t *i8 = INSTR_CREATE_and(dcontext, spill_gpr32_1_opnd, spill_gpr32_2_opnd);
-    // pop rbx
-    instr_t *i9 = INSTR_CREATE_pop(dcontext, opnd_create_reg(DR_REG_RBX));
-    // pop rax
-    instr_t *i10 = INSTR_CREATE_pop(dcontext, opnd_create_reg(DR_REG_RAX));
-    // popfq
-    instr_t *i11 = INSTR_CREATE_popf(dcontext);
-
+    // TEMP := SRC1[31:0] OR SRC2[31:0]
+    // IF TEMP = 0 THEN ZF := 1 ELSE ZF := 0 FI
+    // IF TEMP = FFFFFFFFh THEN CF := 1 ELSE CF := 0 FI
+    // OF := 0; SF := 0; AF := 0; PF := 0
 #ifdef DEBUG
-    print_rewrite_variadic_instr(dcontext, 11, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11);
+    print_rewrite_info(dcontext, ilist, instr, instr_start, "kortestd", true, false, false, true);
 #endif
-    instrlist_concat_next_instr(ilist, 11, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11);
-    return i1;
+    return kortest_dq_gen(dcontext, ilist, instr, OPSZ_4);
 }
 
 instr_t * /* 511 */
@@ -47297,7 +50693,7 @@ rw_func_ktestb(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
     // test %al, %al - test for zero (sets ZF)
     instr_t *i4 = INSTR_CREATE_test(dcontext, spill_gpr8_opnd, spill_gpr8_opnd);
     // cmp $0xFF, %al - test for all ones (sets CF if equal)
-    instr_t *i5 = INSTR_CREATE_cmp(dcontext, spill_gpr8_opnd, opnd_create_immed_int(0xFF, OPSZ_1));
+    instr_t *i5 = INSTR_CREATE_cmp(dcontext, spill_gpr8_opnd, opnd_create_immed_int((sbyte)0xFF, OPSZ_1));
     // pop rax
     instr_t *i6 = INSTR_CREATE_pop(dcontext, spill_gpr64_opnd);
     // popfq
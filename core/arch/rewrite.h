@@ -204,6 +204,21 @@ rw_func_vpmovzxdq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_
 instr_t * /* 211 */
 rw_func_vpmulld(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
+instr_t * /* 214 */
+rw_func_vaesenc(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 215 */
+rw_func_vaesenclast(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 216 */
+rw_func_vaesdec(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 217 */
+rw_func_vaesdeclast(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 238 */
+rw_func_vpclmulqdq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
 instr_t * /* 440 */
 rw_func_vpgatherdd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
@@ -393,6 +408,12 @@ rw_func_ktestd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
  * k regs manipulation instructions end
  *=========================================*/
 
+instr_t * /* 537 */
+rw_func_vcompresspd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 538 */
+rw_func_vcompressps(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
 instr_t * /* 555 */
 rw_func_vcvttsd2usi(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
@@ -408,6 +429,12 @@ rw_func_vcvtusi2ss(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app
 instr_t * /* 563 */
 rw_func_vextractf64x2(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
+instr_t * /* 566 */
+rw_func_vexpandpd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 567 */
+rw_func_vexpandps(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
 instr_t * /* 572 */
 rw_func_vextracti32x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
@@ -456,6 +483,12 @@ rw_func_vpcmpud(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc
 instr_t * /* 632 */
 rw_func_vpcmpw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
+instr_t * /* 633 */
+rw_func_vpcompressd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 634 */
+rw_func_vpcompressq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
 instr_t * /* 642 */
 rw_func_vpermi2q(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
@@ -474,9 +507,36 @@ rw_func_vpermt2q(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_p
 instr_t * /* 649 */
 rw_func_vpermt2w(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
+instr_t * /* 651 */
+rw_func_vpexpandd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 652 */
+rw_func_vpexpandq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
 instr_t * /* 653 */
 rw_func_vpextr_(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
+instr_t * /* 657 */
+rw_func_vpmadd52huq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 658 */
+rw_func_vpmadd52luq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 614 */
+rw_func_vpabsq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 659 */
+rw_func_vpmaxsq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 660 */
+rw_func_vpmaxuq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 661 */
+rw_func_vpminsq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 662 */
+rw_func_vpminuq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
 instr_t * /* 689 */
 rw_func_vpmullq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
@@ -486,9 +546,21 @@ rw_func_vporq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc i
 instr_t * /* 693 */
 rw_func_vprolq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
+instr_t * /* 694 */
+rw_func_vprolvd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 695 */
+rw_func_vprolvq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
 instr_t * /* 697 */
 rw_func_vprorq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
+instr_t * /* 698 */
+rw_func_vprorvd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 699 */
+rw_func_vprorvq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
 instr_t * /* 700 */
 rw_func_vpscatterdd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
@@ -501,6 +573,21 @@ rw_func_vpscatterqd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, ap
 instr_t * /* 703 */
 rw_func_vpscatterqq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
+instr_t * /* 704 */
+rw_func_vpsllvw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 705 */
+rw_func_vpsraq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 706 */
+rw_func_vpsravq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 707 */
+rw_func_vpsravw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 708 */
+rw_func_vpsrlvw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
 instr_t * /* 719 */
 rw_func_vpxord(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
@@ -519,6 +606,159 @@ rw_func_vshufi32x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app
 instr_t * /* 779 */
 rw_func_vrndscalesd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
 
+instr_t * /* 791 */
+rw_func_vpdpbusd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 792 */
+rw_func_vpdpbusds(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 793 */
+rw_func_vpdpwssd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 794 */
+rw_func_vpdpwssds(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 795 */
+rw_func_vcvtne2ps2bf16(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 796 */
+rw_func_vcvtneps2bf16(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 797 */
+rw_func_vdpbf16ps(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 798 */
+rw_func_vpopcntd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 799 */
+rw_func_vpopcntq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 807 */
+rw_func_vgf2p8mulb(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 809 */
+rw_func_vgf2p8affineqb(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 811 */
+rw_func_vgf2p8affineinvqb(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 523 */
+rw_func_valignd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 524 */
+rw_func_valignq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 568 */
+rw_func_vextractf32x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 569 */
+rw_func_vextractf32x8(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 571 */
+rw_func_vextractf64x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 573 */
+rw_func_vextracti32x8(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 575 */
+rw_func_vextracti64x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 600 */
+rw_func_vinsertf32x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 601 */
+rw_func_vinsertf32x8(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 602 */
+rw_func_vinsertf64x2(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 603 */
+rw_func_vinsertf64x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 604 */
+rw_func_vinserti32x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 605 */
+rw_func_vinserti32x8(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 606 */
+rw_func_vinserti64x2(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 765 */
+rw_func_vshuff32x4(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 766 */
+rw_func_vshuff64x2(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 768 */
+rw_func_vshufi64x2(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 525 */
+rw_func_vblendmpd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 526 */
+rw_func_vblendmps(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 619 */
+rw_func_vpblendmb(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 620 */
+rw_func_vpblendmd(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 621 */
+rw_func_vpblendmq(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 622 */
+rw_func_vpblendmw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 146 */
+rw_func_vpsadbw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 563 */
+rw_func_vdbpsadbw(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 244 */
+rw_func_vldmxcsr(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 245 */
+rw_func_vstmxcsr(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 812 */
+rw_func_vsqrtph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 813 */
+rw_func_vaddph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 814 */
+rw_func_vmulph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 815 */
+rw_func_vsubph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 816 */
+rw_func_vminph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 817 */
+rw_func_vdivph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 818 */
+rw_func_vmaxph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 819 */
+rw_func_vfmadd132ph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 820 */
+rw_func_vfmadd213ph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+instr_t * /* 821 */
+rw_func_vfmadd231ph(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, app_pc instr_start);
+
+/**
+ * @brief One-time setup of the lookup tables used by the rewrite functions.
+ */
+void
+rewrite_init(void);
+
 /**
  * @brief binary rewriting driver
  */
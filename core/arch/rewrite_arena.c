@@ -0,0 +1,119 @@
+/**
+ * @file rewrite_arena.c
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * rewrite_arena.c -- per-thread bump-pointer arena for the IR of AVX-512 rewrites
+ *
+ * Lowering one AVX-512 instr creates tens of instrs, each with its own operand
+ * arrays, and every one of them goes through the thread heap only to be freed
+ * together with the block's ilist once the block is emitted.  While
+ * exec_rewrite_avx512_bb() runs, instr_create(), instr_clone() and the operand
+ * array allocations of the thread are instead carved out of one region with a
+ * bump pointer.
+ *
+ * Objects are not freed one by one: the arena counts those still live and
+ * rewinds to its start as soon as the count drops to zero, which is when the
+ * ilist of the block is destroyed.  An arena object that outlives its block
+ * merely keeps the arena from rewinding, and allocations past its end fall back
+ * to the heap, so an instr can be freed and moved between ilists as before.
+ * Memory is told apart by address, leaving the instr flags alone.
+ */
+
+#include "rewrite_arena.h"
+#include "../heap.h"
+
+#define RWARENA_SIZE (128 * 1024)
+
+typedef struct _rwarena_t {
+    byte *start; /* NULL until the first rewrite */
+    byte *cur;
+    byte *end;
+    uint live;   /* objects not freed yet */
+    uint active; /* nesting of rewrite_arena_enter() */
+} rwarena_t;
+
+void
+rewrite_arena_thread_init(dcontext_t *dcontext)
+{
+    rwarena_t *arena = NULL;
+    if (DYNAMO_OPTION(avx512_ir_arena)) {
+        arena = HEAP_TYPE_ALLOC(dcontext, rwarena_t, ACCT_IR, PROTECTED);
+        memset(arena, 0, sizeof(*arena));
+    }
+    dcontext->avx512_arena_field = arena;
+}
+
+void
+rewrite_arena_thread_exit(dcontext_t *dcontext)
+{
+    rwarena_t *arena = (rwarena_t *)dcontext->avx512_arena_field;
+    if (arena == NULL)
+        return;
+    // clear the field first: the instrs freed from here on are all heap ones
+    dcontext->avx512_arena_field = NULL;
+    if (arena->start != NULL)
+        HEAP_ARRAY_FREE(dcontext, arena->start, byte, RWARENA_SIZE, ACCT_IR, PROTECTED);
+    HEAP_TYPE_FREE(dcontext, arena, rwarena_t, ACCT_IR, PROTECTED);
+}
+
+void
+rewrite_arena_enter(dcontext_t *dcontext)
+{
+    rwarena_t *arena = (rwarena_t *)dcontext->avx512_arena_field;
+    if (arena == NULL)
+        return;
+    if (arena->start == NULL) {
+        arena->start = HEAP_ARRAY_ALLOC(dcontext, byte, RWARENA_SIZE, ACCT_IR, PROTECTED);
+        arena->cur = arena->start;
+        arena->end = arena->start + RWARENA_SIZE;
+    }
+    arena->active++;
+}
+
+void
+rewrite_arena_leave(dcontext_t *dcontext)
+{
+    rwarena_t *arena = (rwarena_t *)dcontext->avx512_arena_field;
+    if (arena == NULL)
+        return;
+    ASSERT(arena->active > 0);
+    arena->active--;
+    STATS_TRACK_MAX(avx512_arena_peak_bytes, arena->cur - arena->start);
+}
+
+void *
+rewrite_arena_alloc(dcontext_t *dcontext, size_t size)
+{
+    rwarena_t *arena = (rwarena_t *)dcontext->avx512_arena_field;
+    byte *p;
+    if (arena == NULL || arena->active == 0)
+        return NULL;
+    size = ALIGN_FORWARD(size, sizeof(void *));
+    if (arena->cur + size > arena->end) {
+        STATS_INC(avx512_arena_full);
+        return NULL;
+    }
+    p = arena->cur;
+    arena->cur += size;
+    arena->live++;
+    STATS_ADD(avx512_arena_bytes, size);
+    return p;
+}
+
+bool
+rewrite_arena_free(dcontext_t *dcontext, void *p)
+{
+    rwarena_t *arena = (rwarena_t *)dcontext->avx512_arena_field;
+    if (arena == NULL || (byte *)p < arena->start || (byte *)p >= arena->end)
+        return false;
+    ASSERT(arena->live > 0);
+    if (--arena->live == 0) {
+        arena->cur = arena->start;
+        STATS_INC(avx512_arena_rewinds);
+    }
+    return true;
+}
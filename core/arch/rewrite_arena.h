@@ -0,0 +1,58 @@
+/**
+ * @file rewrite_arena.h
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * rewrite_arena.h -- per-thread bump-pointer arena for the IR of AVX-512 rewrites
+ */
+
+#ifndef _REWRITE_ARENA_H_
+#define _REWRITE_ARENA_H_
+
+#include "../globals.h"
+
+/**
+ * @brief Set up the arena field of a new thread; the arena itself is only
+ * allocated once the thread rewrites its first block.
+ */
+void
+rewrite_arena_thread_init(dcontext_t *dcontext);
+
+/**
+ * @brief Free the arena of an exiting thread.
+ */
+void
+rewrite_arena_thread_exit(dcontext_t *dcontext);
+
+/**
+ * @brief Serve the instrs and operand arrays allocated by `dcontext` from its arena
+ * until the matching rewrite_arena_leave().
+ */
+void
+rewrite_arena_enter(dcontext_t *dcontext);
+
+/**
+ * @brief Go back to the heap for the IR allocations of `dcontext`.
+ */
+void
+rewrite_arena_leave(dcontext_t *dcontext);
+
+/**
+ * @brief Carve `size` bytes of IR out of the active arena of `dcontext`.
+ * Returns NULL when no arena is active or it is full, for the caller to fall
+ * back to the heap.
+ */
+void *
+rewrite_arena_alloc(dcontext_t *dcontext, size_t size);
+
+/**
+ * @brief Release `p` if it lies in the arena of `dcontext`, rewinding the arena
+ * once nothing in it is live. Returns false for memory from the heap.
+ */
+bool
+rewrite_arena_free(dcontext_t *dcontext, void *p);
+
+#endif /* _REWRITE_ARENA_H_ */
@@ -0,0 +1,725 @@
+/**
+ * @file rewrite_cache.c
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * rewrite_cache.c -- persistent on-disk cache of rewritten AVX-512 instrs
+ *
+ * Lowering an AVX-512 instr into its AVX2 chain is by far the most expensive part of
+ * building a block, and the same libraries are rewritten again on every run.  This
+ * cache keeps the encoded chain of each rewritten app instr in one file per module,
+ * named after the module's ELF build-id and keyed inside the file by the instr's
+ * offset from the module start.  The file header records a hash of the DR library
+ * build-id, the rewrite options and the host features the lowerings pick from, so
+ * a file written under a different configuration is simply ignored.
+ *
+ * Files are mapped read-only at module load and entries are validated lazily: an
+ * entry is only used once a block containing its instr is built and the app bytes
+ * it recorded still match.  New entries are written back at module unload and at
+ * exit through a tmp file and a rename, and an index file in the cache directory
+ * tracks the size and last use of every module file so that the least recently
+ * used ones, and those written under a stale configuration, can be evicted once
+ * -avx512_cache_max_size is exceeded.
+ *
+ * Rip-relative operands are the only position-dependent part of a lowered chain:
+ * each instr is encoded as if it sat at the start of the module or of the DR
+ * library, whichever its target lies in, and decode_from_copy() relocates it
+ * against the current base on load.
+ */
+
+#include "rewrite_cache.h"
+#include "rewrite_utils.h"
+#include "../module_shared.h"
+#include "decode.h"
+#include "instr_api.h"
+#include "opnd_api.h"
+
+#define RWCACHE_MAGIC 0x43585641 /* "AVXC" */
+#define RWCACHE_VERSION 1
+#define RWCACHE_FILE_SUFFIX "dravx"
+#define RWCACHE_INDEX_NAME "index"
+
+/* per-instr record flags, a record is [len][flags][len encoded bytes] */
+#define RWCACHE_RELOC_NONE 0x0
+#define RWCACHE_RELOC_MODULE 0x1 /* rip-rel target in the app module */
+#define RWCACHE_RELOC_DR 0x2     /* rip-rel target in the DR library */
+#define RWCACHE_RELOC_MASK 0x3
+#define RWCACHE_INSTR_META 0x4
+#define RWCACHE_RECORD_HEADER 2
+
+typedef struct _rwcache_file_header_t {
+    uint magic;
+    uint version;
+    uint64 config_hash;
+    uint64 module_size;
+    uint num_entries;
+    uint data_size;
+} rwcache_file_header_t;
+
+/* the entry array follows the header, sorted by offs, then the data area */
+typedef struct _rwcache_file_entry_t {
+    uint offs;      /* app instr offset from the module start */
+    uint data_offs; /* into the data area */
+    uint data_len;  /* app bytes followed by the instr records */
+    uint app_len;
+} rwcache_file_entry_t;
+
+typedef struct _rwcache_entry_t {
+    uint offs;
+    uint data_len;
+    uint app_len;
+    bool stale;   /* failed lazy validation, dropped on write back */
+    bool on_heap; /* added this run rather than mapped from the file */
+    byte *data;
+} rwcache_entry_t;
+
+typedef struct _rwcache_module_t {
+    app_pc start;
+    app_pc end;
+    byte build_id[MODULE_BUILD_ID_MAX_LEN];
+    uint build_id_len;
+    char path[MAXIMUM_PATH];
+    byte *map; /* read-only view of the file this run started from */
+    size_t map_size;
+    rwcache_entry_t *entries;
+    uint num_entries;
+    uint capacity;
+    bool dirty; /* entries added or gone stale since the file was written */
+    bool used;  /* had a hit, bumps the last use time in the index */
+    struct _rwcache_module_t *next;
+} rwcache_module_t;
+
+typedef struct _rwcache_index_rec_t {
+    byte build_id[MODULE_BUILD_ID_MAX_LEN];
+    uint build_id_len;
+    uint last_use; /* query_time_seconds() */
+    uint64 config_hash;
+    uint64 file_size;
+} rwcache_index_rec_t;
+
+static bool rwcache_enabled;
+static uint64 rwcache_config_hash;
+static char rwcache_dir[MAXIMUM_PATH];
+static rwcache_module_t *rwcache_modules;
+DECLARE_CXTSWPROT_VAR(static mutex_t avx512_cache_lock, INIT_LOCK_FREE(avx512_cache_lock));
+
+/* ======================================== *
+ *    configuration hash and file names
+ * ======================================== */
+
+/* the lowerings that look at the host pick between these */
+static const feature_bit_t rwcache_host_features[] = {
+    FEATURE_AVX2, FEATURE_FMA,  FEATURE_F16C, FEATURE_AES,
+    FEATURE_VAES, FEATURE_GFNI, FEATURE_VPCLMULQDQ,
+};
+
+static bool
+rwcache_compute_config_hash(void)
+{
+    struct MD5Context ctx;
+    byte digest[MD5_RAW_BYTES];
+    byte dr_id[MODULE_BUILD_ID_MAX_LEN];
+    app_pc dr_start = get_dynamorio_dll_start();
+    uint dr_id_len = module_get_build_id(dr_start, get_dynamorio_dll_end() - dr_start, dr_id);
+    uint version = RWCACHE_VERSION;
+    uint quick_rw = DYNAMO_OPTION(quick_rw);
+    uint features = 0;
+    ushort tls_base = os_tls_offset(0);
+    // without a build-id of our own, entries from an older DR could not be told apart
+    if (dr_id_len == 0)
+        return false;
+    for (uint i = 0; i < BUFFER_SIZE_ELEMENTS(rwcache_host_features); i++) {
+        if (proc_has_feature(rwcache_host_features[i]))
+            features |= 1 << i;
+    }
+    d_r_md5_init(&ctx);
+    d_r_md5_update(&ctx, (byte *)&version, sizeof(version));
+    d_r_md5_update(&ctx, dr_id, dr_id_len);
+    d_r_md5_update(&ctx, (byte *)&quick_rw, sizeof(quick_rw));
+    d_r_md5_update(&ctx, (byte *)&features, sizeof(features));
+    d_r_md5_update(&ctx, (byte *)&tls_base, sizeof(tls_base));
+    d_r_md5_final(digest, &ctx);
+    memcpy(&rwcache_config_hash, digest, sizeof(rwcache_config_hash));
+    return true;
+}
+
+static void
+rwcache_file_path(const byte *build_id, uint build_id_len, char *path, size_t path_len)
+{
+    char hex[2 * MODULE_BUILD_ID_MAX_LEN + 1];
+    for (uint i = 0; i < build_id_len; i++)
+        snprintf(hex + 2 * i, 3, "%02x", build_id[i]);
+    hex[2 * build_id_len] = '\0';
+    snprintf(path, path_len, "%s%c%s." RWCACHE_FILE_SUFFIX, rwcache_dir, DIRSEP, hex);
+    path[path_len - 1] = '\0';
+}
+
+/* writes [buf, buf+len) pieces to a tmp file next to path and renames it over path */
+static bool
+rwcache_write_file(const char *path, const void **bufs, const size_t *lens, uint num_bufs)
+{
+    char tmp[MAXIMUM_PATH];
+    bool ok = true;
+    file_t fd;
+    snprintf(tmp, BUFFER_SIZE_ELEMENTS(tmp), "%s." PIDFMT ".tmp", path, get_process_id());
+    NULL_TERMINATE_BUFFER(tmp);
+    fd = os_open(tmp, OS_OPEN_WRITE | OS_OPEN_REQUIRE_NEW);
+    if (fd == INVALID_FILE)
+        return false;
+    for (uint i = 0; i < num_bufs && ok; i++) {
+        if (lens[i] > 0 && os_write(fd, bufs[i], lens[i]) != (ssize_t)lens[i])
+            ok = false;
+    }
+    os_close(fd);
+    if (ok)
+        ok = os_rename_file(tmp, path, true /*replace*/);
+    if (!ok)
+        os_delete_file(tmp);
+    return ok;
+}
+
+/* ======================================== *
+ *    index of module files for eviction
+ * ======================================== */
+
+static rwcache_index_rec_t *
+rwcache_index_read(const char *path, uint *num DR_PARAM_OUT, uint *capacity DR_PARAM_OUT)
+{
+    rwcache_index_rec_t *recs = NULL;
+    uint64 size = 0;
+    file_t fd = os_open(path, OS_OPEN_READ);
+    *num = 0;
+    if (fd != INVALID_FILE && os_get_file_size_by_handle(fd, &size) && size % sizeof(*recs) == 0)
+        *num = (uint)(size / sizeof(*recs));
+    *capacity = *num + 1;
+    recs = HEAP_ARRAY_ALLOC(GLOBAL_DCONTEXT, rwcache_index_rec_t, *capacity, ACCT_OTHER, PROTECTED);
+    if (*num > 0 && os_read(fd, recs, *num * sizeof(*recs)) != (ssize_t)(*num * sizeof(*recs)))
+        *num = 0;
+    if (fd != INVALID_FILE)
+        os_close(fd);
+    return recs;
+}
+
+static void
+rwcache_index_drop(rwcache_index_rec_t *recs, uint *num, uint i)
+{
+    char path[MAXIMUM_PATH];
+    rwcache_file_path(recs[i].build_id, recs[i].build_id_len, path, BUFFER_SIZE_ELEMENTS(path));
+    LOG(GLOBAL, LOG_CACHE, 2, "%s: evicting %s\n", __FUNCTION__, path);
+    os_delete_file(path);
+    STATS_INC(avx512_cache_files_evicted);
+    recs[i] = recs[--(*num)];
+}
+
+/* Records that mod's file was just written or used, then evicts the files written
+ * under another configuration and, least recently used first, those past the cap.
+ * Concurrent processes may lose each other's updates, which only delays eviction.
+ */
+static void
+rwcache_index_update(rwcache_module_t *mod, uint64 file_size)
+{
+    char path[MAXIMUM_PATH];
+    uint num, capacity, self = UINT_MAX;
+    uint64 total = 0;
+    rwcache_index_rec_t *recs;
+    snprintf(path, BUFFER_SIZE_ELEMENTS(path), "%s%c" RWCACHE_INDEX_NAME, rwcache_dir, DIRSEP);
+    NULL_TERMINATE_BUFFER(path);
+    recs = rwcache_index_read(path, &num, &capacity);
+    for (uint i = 0; i < num; i++) {
+        if (recs[i].build_id_len == mod->build_id_len &&
+            memcmp(recs[i].build_id, mod->build_id, mod->build_id_len) == 0)
+            self = i;
+    }
+    if (self == UINT_MAX) {
+        self = num++;
+        memset(&recs[self], 0, sizeof(recs[self]));
+        memcpy(recs[self].build_id, mod->build_id, mod->build_id_len);
+        recs[self].build_id_len = mod->build_id_len;
+    }
+    recs[self].config_hash = rwcache_config_hash;
+    recs[self].file_size = file_size;
+    recs[self].last_use = query_time_seconds();
+    // keep our own record at index 0 so that dropping others never moves it
+    if (self != 0) {
+        rwcache_index_rec_t tmp = recs[0];
+        recs[0] = recs[self];
+        recs[self] = tmp;
+    }
+    for (uint i = num - 1; i > 0; i--) {
+        if (recs[i].config_hash != rwcache_config_hash || recs[i].build_id_len > MODULE_BUILD_ID_MAX_LEN)
+            rwcache_index_drop(recs, &num, i);
+    }
+    for (uint i = 0; i < num; i++)
+        total += recs[i].file_size;
+    while (total > DYNAMO_OPTION(avx512_cache_max_size) && num > 1) {
+        uint oldest = 1;
+        for (uint i = 2; i < num; i++) {
+            if (recs[i].last_use < recs[oldest].last_use)
+                oldest = i;
+        }
+        total -= recs[oldest].file_size;
+        rwcache_index_drop(recs, &num, oldest);
+    }
+    const void *bufs[] = { recs };
+    size_t lens[] = { num * sizeof(*recs) };
+    rwcache_write_file(path, bufs, lens, 1);
+    HEAP_ARRAY_FREE(GLOBAL_DCONTEXT, recs, rwcache_index_rec_t, capacity, ACCT_OTHER, PROTECTED);
+}
+
+/* ======================================== *
+ *    per-module files
+ * ======================================== */
+
+static bool
+rwcache_file_valid(rwcache_module_t *mod, byte *map, size_t size)
+{
+    rwcache_file_header_t *header = (rwcache_file_header_t *)map;
+    rwcache_file_entry_t *entries = (rwcache_file_entry_t *)(header + 1);
+    if (size < sizeof(*header) || header->magic != RWCACHE_MAGIC || header->version != RWCACHE_VERSION ||
+        header->config_hash != rwcache_config_hash || header->module_size != (uint64)(mod->end - mod->start))
+        return false;
+    if (sizeof(*header) + (uint64)header->num_entries * sizeof(*entries) + header->data_size != size)
+        return false;
+    for (uint i = 0; i < header->num_entries; i++) {
+        if ((uint64)entries[i].data_offs + entries[i].data_len > header->data_size ||
+            entries[i].app_len > entries[i].data_len || entries[i].app_len > MAX_INSTR_LENGTH ||
+            (i > 0 && entries[i].offs <= entries[i - 1].offs))
+            return false;
+    }
+    return true;
+}
+
+static void
+rwcache_module_read(rwcache_module_t *mod)
+{
+    uint64 size;
+    file_t fd = os_open(mod->path, OS_OPEN_READ);
+    if (fd == INVALID_FILE)
+        return;
+    if (os_get_file_size_by_handle(fd, &size) && size >= sizeof(rwcache_file_header_t) &&
+        size <= DYNAMO_OPTION(avx512_cache_max_size)) {
+        size_t map_size = (size_t)size;
+        byte *map = d_r_map_file(fd, &map_size, 0, NULL, MEMPROT_READ, 0);
+        if (map != NULL && map_size >= size && rwcache_file_valid(mod, map, (size_t)size)) {
+            rwcache_file_header_t *header = (rwcache_file_header_t *)map;
+            rwcache_file_entry_t *entries = (rwcache_file_entry_t *)(header + 1);
+            byte *data = (byte *)(entries + header->num_entries);
+            mod->map = map;
+            mod->map_size = map_size;
+            mod->capacity = header->num_entries + 16;
+            mod->entries =
+                HEAP_ARRAY_ALLOC(GLOBAL_DCONTEXT, rwcache_entry_t, mod->capacity, ACCT_OTHER, PROTECTED);
+            for (uint i = 0; i < header->num_entries; i++) {
+                rwcache_entry_t *entry = &mod->entries[i];
+                entry->offs = entries[i].offs;
+                entry->data_len = entries[i].data_len;
+                entry->app_len = entries[i].app_len;
+                entry->stale = false;
+                entry->on_heap = false;
+                entry->data = data + entries[i].data_offs;
+            }
+            mod->num_entries = header->num_entries;
+            STATS_INC(avx512_cache_modules_loaded);
+            STATS_ADD(avx512_cache_entries_loaded, mod->num_entries);
+        } else if (map != NULL) {
+            LOG(GLOBAL, LOG_CACHE, 1, "%s: ignoring stale or corrupt %s\n", __FUNCTION__, mod->path);
+            d_r_unmap_file(map, map_size);
+        }
+    }
+    os_close(fd);
+}
+
+static void
+rwcache_module_write(rwcache_module_t *mod)
+{
+    rwcache_file_header_t header;
+    rwcache_file_entry_t *entries;
+    const void **bufs;
+    size_t *lens;
+    uint num = 0, num_bufs;
+    if (!mod->dirty) {
+        if (mod->used)
+            rwcache_index_update(mod, mod->map_size);
+        mod->used = false;
+        return;
+    }
+    entries = HEAP_ARRAY_ALLOC(GLOBAL_DCONTEXT, rwcache_file_entry_t, mod->num_entries + 1, ACCT_OTHER, PROTECTED);
+    bufs = HEAP_ARRAY_ALLOC(GLOBAL_DCONTEXT, const void *, mod->num_entries + 2, ACCT_OTHER, PROTECTED);
+    lens = HEAP_ARRAY_ALLOC(GLOBAL_DCONTEXT, size_t, mod->num_entries + 2, ACCT_OTHER, PROTECTED);
+    memset(&header, 0, sizeof(header));
+    for (uint i = 0; i < mod->num_entries; i++) {
+        rwcache_entry_t *entry = &mod->entries[i];
+        if (entry->stale)
+            continue;
+        entries[num].offs = entry->offs;
+        entries[num].data_offs = header.data_size;
+        entries[num].data_len = entry->data_len;
+        entries[num].app_len = entry->app_len;
+        bufs[2 + num] = entry->data;
+        lens[2 + num] = entry->data_len;
+        header.data_size += entry->data_len;
+        num++;
+    }
+    header.magic = RWCACHE_MAGIC;
+    header.version = RWCACHE_VERSION;
+    header.config_hash = rwcache_config_hash;
+    header.module_size = mod->end - mod->start;
+    header.num_entries = num;
+    bufs[0] = &header;
+    lens[0] = sizeof(header);
+    bufs[1] = entries;
+    lens[1] = num * sizeof(*entries);
+    num_bufs = 2 + num;
+    if (rwcache_write_file(mod->path, bufs, lens, num_bufs)) {
+        LOG(GLOBAL, LOG_CACHE, 1, "%s: wrote %d entries to %s\n", __FUNCTION__, num, mod->path);
+        STATS_INC(avx512_cache_files_written);
+        rwcache_index_update(mod, sizeof(header) + lens[1] + header.data_size);
+    }
+    mod->dirty = false;
+    mod->used = false;
+    HEAP_ARRAY_FREE(GLOBAL_DCONTEXT, entries, rwcache_file_entry_t, mod->num_entries + 1, ACCT_OTHER, PROTECTED);
+    HEAP_ARRAY_FREE(GLOBAL_DCONTEXT, bufs, const void *, mod->num_entries + 2, ACCT_OTHER, PROTECTED);
+    HEAP_ARRAY_FREE(GLOBAL_DCONTEXT, lens, size_t, mod->num_entries + 2, ACCT_OTHER, PROTECTED);
+}
+
+static void
+rwcache_module_free(rwcache_module_t *mod)
+{
+    for (uint i = 0; i < mod->num_entries; i++) {
+        if (mod->entries[i].on_heap) {
+            HEAP_ARRAY_FREE(GLOBAL_DCONTEXT, mod->entries[i].data, byte, mod->entries[i].data_len, ACCT_OTHER,
+                            PROTECTED);
+        }
+    }
+    if (mod->entries != NULL)
+        HEAP_ARRAY_FREE(GLOBAL_DCONTEXT, mod->entries, rwcache_entry_t, mod->capacity, ACCT_OTHER, PROTECTED);
+    if (mod->map != NULL)
+        d_r_unmap_file(mod->map, mod->map_size);
+    HEAP_TYPE_FREE(GLOBAL_DCONTEXT, mod, rwcache_module_t, ACCT_OTHER, PROTECTED);
+}
+
+/* caller holds avx512_cache_lock */
+static rwcache_module_t *
+rwcache_module_lookup(app_pc pc)
+{
+    for (rwcache_module_t *mod = rwcache_modules; mod != NULL; mod = mod->next) {
+        if (pc >= mod->start && pc < mod->end)
+            return mod;
+    }
+    return NULL;
+}
+
+/* returns the index of the first entry with offs >= the given one */
+static uint
+rwcache_entry_search(rwcache_module_t *mod, uint offs)
+{
+    uint lo = 0, hi = mod->num_entries;
+    while (lo < hi) {
+        uint mid = (lo + hi) / 2;
+        if (mod->entries[mid].offs < offs)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/* ======================================== *
+ *    chain encoding
+ * ======================================== */
+
+static byte *
+rwcache_reloc_base(rwcache_module_t *mod, uint reloc)
+{
+    if (reloc == RWCACHE_RELOC_MODULE)
+        return mod->start;
+    if (reloc == RWCACHE_RELOC_DR)
+        return get_dynamorio_dll_start();
+    return NULL;
+}
+
+/* Encodes one instr of a lowered chain as a record into buf, which holds at least
+ * RWCACHE_RECORD_HEADER + MAX_INSTR_LENGTH bytes. Returns the record length, 0 if the
+ * instr cannot be replayed on another run.
+ */
+static uint
+rwcache_encode_instr(dcontext_t *dcontext, rwcache_module_t *mod, instr_t *instr, byte *buf)
+{
+    uint reloc = RWCACHE_RELOC_NONE;
+    byte *final_pc, *next_pc;
+    app_pc dr_start = get_dynamorio_dll_start();
+    if (instr_is_label(instr) || instr_is_cti(instr) || !instr_operands_valid(instr))
+        return 0;
+    for (int i = 0; i < instr_num_srcs(instr) + instr_num_dsts(instr); i++) {
+        opnd_t opnd = i < instr_num_srcs(instr) ? instr_get_src(instr, i) : instr_get_dst(instr, i - instr_num_srcs(instr));
+        if (opnd_is_pc(opnd) || opnd_is_instr(opnd) || opnd_is_near_abs_addr(opnd))
+            return 0;
+        if (opnd_is_rel_addr(opnd)) {
+            app_pc target = (app_pc)opnd_get_addr(opnd);
+            if (target >= mod->start && target < mod->end)
+                reloc = RWCACHE_RELOC_MODULE;
+            else if (target >= dr_start && target < get_dynamorio_dll_end())
+                reloc = RWCACHE_RELOC_DR;
+            else
+                return 0;
+        }
+    }
+    final_pc = reloc == RWCACHE_RELOC_NONE ? buf + RWCACHE_RECORD_HEADER : rwcache_reloc_base(mod, reloc);
+    next_pc = instr_encode_to_copy(dcontext, instr, buf + RWCACHE_RECORD_HEADER, final_pc);
+    if (next_pc == NULL)
+        return 0;
+    buf[0] = (byte)(next_pc - (buf + RWCACHE_RECORD_HEADER));
+    buf[1] = (byte)(reloc | (instr_is_meta(instr) ? RWCACHE_INSTR_META : 0));
+    return RWCACHE_RECORD_HEADER + buf[0];
+}
+
+static void
+rwcache_chain_destroy(dcontext_t *dcontext, instr_t *first)
+{
+    while (first != NULL) {
+        instr_t *next = instr_get_next(first);
+        instr_destroy(dcontext, first);
+        first = next;
+    }
+}
+
+/* decodes the records of entry into a fresh chain, NULL if any fails to decode */
+static instr_t *
+rwcache_decode_chain(dcontext_t *dcontext, rwcache_module_t *mod, rwcache_entry_t *entry)
+{
+    instr_t *first = NULL, *last = NULL;
+    byte *rec = entry->data + entry->app_len;
+    byte *end = entry->data + entry->data_len;
+    while (rec < end) {
+        byte *code = rec + RWCACHE_RECORD_HEADER;
+        uint reloc = rec[1] & RWCACHE_RELOC_MASK;
+        instr_t *instr;
+        if (code > end || code + rec[0] > end || reloc == RWCACHE_RELOC_MASK) {
+            rwcache_chain_destroy(dcontext, first);
+            return NULL;
+        }
+        instr = instr_create(dcontext);
+        if (decode_from_copy(dcontext, code, reloc == RWCACHE_RELOC_NONE ? code : rwcache_reloc_base(mod, reloc),
+                             instr) != code + rec[0]) {
+            instr_destroy(dcontext, instr);
+            rwcache_chain_destroy(dcontext, first);
+            return NULL;
+        }
+        // the bytes live in a file mapping, have the chain re-encoded from its operands
+        instr_set_raw_bits_valid(instr, false);
+        if (TEST(RWCACHE_INSTR_META, rec[1]))
+            instr_set_meta(instr);
+        if (first == NULL)
+            first = instr;
+        else
+            instr_concat_next(last, instr);
+        last = instr;
+        rec = code + rec[0];
+    }
+    return first;
+}
+
+/* ======================================== *
+ *    interface
+ * ======================================== */
+
+void
+rewrite_cache_init(void)
+{
+    string_option_read_lock();
+    if (!IS_STRING_OPTION_EMPTY(avx512_cache_dir))
+        strncpy(rwcache_dir, DYNAMO_OPTION(avx512_cache_dir), BUFFER_SIZE_ELEMENTS(rwcache_dir));
+    string_option_read_unlock();
+    NULL_TERMINATE_BUFFER(rwcache_dir);
+    if (rwcache_dir[0] == '\0')
+        return;
+    if (!rwcache_compute_config_hash()) {
+        SYSLOG_INTERNAL_WARNING("-avx512_cache_dir ignored: no build-id in the DR library");
+        return;
+    }
+    if (!os_file_exists(rwcache_dir, true /*is dir*/) && !os_create_dir(rwcache_dir, CREATE_DIR_ALLOW_EXISTING)) {
+        SYSLOG_INTERNAL_WARNING("-avx512_cache_dir ignored: cannot create %s", rwcache_dir);
+        return;
+    }
+    rwcache_enabled = true;
+}
+
+void
+rewrite_cache_fast_exit(void)
+{
+    if (!rwcache_enabled)
+        return;
+    d_r_mutex_lock(&avx512_cache_lock);
+    for (rwcache_module_t *mod = rwcache_modules; mod != NULL; mod = mod->next)
+        rwcache_module_write(mod);
+    d_r_mutex_unlock(&avx512_cache_lock);
+}
+
+void
+rewrite_cache_exit(void)
+{
+    if (rwcache_enabled) {
+        rewrite_cache_fast_exit();
+        d_r_mutex_lock(&avx512_cache_lock);
+        while (rwcache_modules != NULL) {
+            rwcache_module_t *mod = rwcache_modules;
+            rwcache_modules = mod->next;
+            rwcache_module_free(mod);
+        }
+        rwcache_enabled = false;
+        d_r_mutex_unlock(&avx512_cache_lock);
+    }
+    DELETE_LOCK(avx512_cache_lock);
+}
+
+void
+rewrite_cache_module_load(module_area_t *ma)
+{
+#ifdef LINUX
+    rwcache_module_t *mod;
+    if (!rwcache_enabled || ma->os_data.build_id_len == 0)
+        return;
+    mod = HEAP_TYPE_ALLOC(GLOBAL_DCONTEXT, rwcache_module_t, ACCT_OTHER, PROTECTED);
+    memset(mod, 0, sizeof(*mod));
+    mod->start = ma->start;
+    mod->end = ma->end;
+    memcpy(mod->build_id, ma->os_data.build_id, ma->os_data.build_id_len);
+    mod->build_id_len = ma->os_data.build_id_len;
+    rwcache_file_path(mod->build_id, mod->build_id_len, mod->path, BUFFER_SIZE_ELEMENTS(mod->path));
+    rwcache_module_read(mod);
+    d_r_mutex_lock(&avx512_cache_lock);
+    mod->next = rwcache_modules;
+    rwcache_modules = mod;
+    d_r_mutex_unlock(&avx512_cache_lock);
+#endif
+}
+
+void
+rewrite_cache_module_unload(module_area_t *ma)
+{
+    rwcache_module_t *mod = NULL;
+    if (!rwcache_enabled)
+        return;
+    d_r_mutex_lock(&avx512_cache_lock);
+    for (rwcache_module_t **prev = &rwcache_modules; *prev != NULL; prev = &(*prev)->next) {
+        if ((*prev)->start == ma->start) {
+            mod = *prev;
+            *prev = mod->next;
+            break;
+        }
+    }
+    if (mod != NULL)
+        rwcache_module_write(mod);
+    d_r_mutex_unlock(&avx512_cache_lock);
+    if (mod != NULL)
+        rwcache_module_free(mod);
+}
+
+instr_t *
+rewrite_cache_lookup(dcontext_t *dcontext, instr_t *instr, rewrite_cache_key_t *key)
+{
+    rwcache_module_t *mod;
+    instr_t *first = NULL;
+    key->pc = NULL;
+    if (!rwcache_enabled || instr_get_translation(instr) == NULL || !instr_raw_bits_valid(instr) ||
+        instr_length(dcontext, instr) > MAX_INSTR_LENGTH)
+        return NULL;
+    key->app_len = instr_length(dcontext, instr);
+    memcpy(key->app_bytes, instr_get_raw_bits(instr), key->app_len);
+    d_r_mutex_lock(&avx512_cache_lock);
+    mod = rwcache_module_lookup(instr_get_translation(instr));
+    if (mod != NULL) {
+        uint offs = (uint)(instr_get_translation(instr) - mod->start);
+        uint i = rwcache_entry_search(mod, offs);
+        key->pc = instr_get_translation(instr);
+        if (i < mod->num_entries && mod->entries[i].offs == offs && !mod->entries[i].stale) {
+            rwcache_entry_t *entry = &mod->entries[i];
+            if (entry->app_len == key->app_len && memcmp(entry->data, key->app_bytes, key->app_len) == 0)
+                first = rwcache_decode_chain(dcontext, mod, entry);
+            if (first == NULL) {
+                // the module was patched or the file is damaged: rewrite and replace it
+                entry->stale = true;
+                mod->dirty = true;
+                STATS_INC(avx512_cache_stale);
+            }
+        }
+        if (first != NULL) {
+            mod->used = true;
+            STATS_INC(avx512_cache_hits);
+        } else
+            STATS_INC(avx512_cache_misses);
+    }
+    d_r_mutex_unlock(&avx512_cache_lock);
+    return first;
+}
+
+void
+rewrite_cache_add(dcontext_t *dcontext, rewrite_cache_key_t *key, instr_t *first)
+{
+    byte buf[RWCACHE_RECORD_HEADER + MAX_INSTR_LENGTH];
+    rwcache_module_t *mod;
+    rwcache_entry_t *entry;
+    uint data_len, i;
+    byte *data, *pos;
+    if (key->pc == NULL || first == NULL)
+        return;
+    d_r_mutex_lock(&avx512_cache_lock);
+    mod = rwcache_module_lookup(key->pc);
+    if (mod == NULL) {
+        d_r_mutex_unlock(&avx512_cache_lock);
+        return;
+    }
+    // size the records first, bailing out on anything that cannot be replayed
+    data_len = key->app_len;
+    for (instr_t *instr = first; instr != NULL; instr = instr_get_next(instr)) {
+        uint len = rwcache_encode_instr(dcontext, mod, instr, buf);
+        if (len == 0) {
+            STATS_INC(avx512_cache_uncacheable);
+            d_r_mutex_unlock(&avx512_cache_lock);
+            return;
+        }
+        data_len += len;
+    }
+    data = HEAP_ARRAY_ALLOC(GLOBAL_DCONTEXT, byte, data_len, ACCT_OTHER, PROTECTED);
+    memcpy(data, key->app_bytes, key->app_len);
+    pos = data + key->app_len;
+    for (instr_t *instr = first; instr != NULL; instr = instr_get_next(instr)) {
+        uint len = rwcache_encode_instr(dcontext, mod, instr, buf);
+        memcpy(pos, buf, len);
+        pos += len;
+    }
+    i = rwcache_entry_search(mod, (uint)(key->pc - mod->start));
+    if (i < mod->num_entries && mod->entries[i].offs == (uint)(key->pc - mod->start)) {
+        // replaces a stale entry, or one added by a racing block build
+        entry = &mod->entries[i];
+        if (entry->on_heap)
+            HEAP_ARRAY_FREE(GLOBAL_DCONTEXT, entry->data, byte, entry->data_len, ACCT_OTHER, PROTECTED);
+    } else {
+        if (mod->num_entries == mod->capacity) {
+            uint capacity = mod->capacity == 0 ? 64 : 2 * mod->capacity;
+            rwcache_entry_t *entries =
+                HEAP_ARRAY_ALLOC(GLOBAL_DCONTEXT, rwcache_entry_t, capacity, ACCT_OTHER, PROTECTED);
+            if (mod->entries != NULL) {
+                memcpy(entries, mod->entries, mod->num_entries * sizeof(*entries));
+                HEAP_ARRAY_FREE(GLOBAL_DCONTEXT, mod->entries, rwcache_entry_t, mod->capacity, ACCT_OTHER,
+                                PROTECTED);
+            }
+            mod->entries = entries;
+            mod->capacity = capacity;
+        }
+        memmove(&mod->entries[i + 1], &mod->entries[i], (mod->num_entries - i) * sizeof(*mod->entries));
+        mod->num_entries++;
+        entry = &mod->entries[i];
+    }
+    entry->offs = (uint)(key->pc - mod->start);
+    entry->data_len = data_len;
+    entry->app_len = key->app_len;
+    entry->stale = false;
+    entry->on_heap = true;
+    entry->data = data;
+    mod->dirty = true;
+    d_r_mutex_unlock(&avx512_cache_lock);
+}
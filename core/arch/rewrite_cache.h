@@ -0,0 +1,84 @@
+/**
+ * @file rewrite_cache.h
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * rewrite_cache.h -- persistent on-disk cache of rewritten AVX-512 instrs
+ */
+
+#ifndef _REWRITE_CACHE_H_
+#define _REWRITE_CACHE_H_
+
+#include "../globals.h"
+#include "../module_shared.h"
+#include "instr.h"
+
+/**
+ * @brief Identifies one app AVX-512 instr for the rewrite cache.
+ *
+ * Filled in by rewrite_cache_lookup() before the rewrite function destroys the
+ * app instr, and handed back to rewrite_cache_add() with its lowered chain.
+ * pc is NULL when the instr cannot be cached.
+ */
+typedef struct _rewrite_cache_key_t {
+    app_pc pc;
+    uint app_len;
+    byte app_bytes[MAX_INSTR_LENGTH];
+} rewrite_cache_key_t;
+
+/**
+ * @brief Set up the cache from -avx512_cache_dir; a no-op when the option is empty.
+ */
+void
+rewrite_cache_init(void);
+
+/**
+ * @brief Write back every module with new entries and free the cache.
+ */
+void
+rewrite_cache_exit(void);
+
+/**
+ * @brief Write back every module with new entries, for the release-build exit path.
+ */
+void
+rewrite_cache_fast_exit(void);
+
+/**
+ * @brief Map the cache file of a newly loaded module, keyed by its ELF build-id.
+ *
+ * Called with the module list write lock held. Entries are only checked against
+ * the app bytes once a block that contains them is built.
+ */
+void
+rewrite_cache_module_load(module_area_t *ma);
+
+/**
+ * @brief Write back the entries of an unloading module and drop its mapping.
+ */
+void
+rewrite_cache_module_unload(module_area_t *ma);
+
+/**
+ * @brief Look up the lowered chain for the AVX-512 `instr`.
+ *
+ * Fills in `key` either way. On a hit returns a freshly decoded chain that the
+ * caller inserts in place of `instr`; returns NULL on a miss, a stale entry or
+ * when the instr is not cacheable.
+ */
+instr_t *
+rewrite_cache_lookup(dcontext_t *dcontext, instr_t *instr, rewrite_cache_key_t *key);
+
+/**
+ * @brief Record the chain produced by a rewrite function for the instr in `key`.
+ *
+ * Chains holding labels, ctis or addresses outside the module and the DR library
+ * are skipped, as they cannot be relocated on the next run.
+ */
+void
+rewrite_cache_add(dcontext_t *dcontext, rewrite_cache_key_t *key, instr_t *first);
+
+#endif /* _REWRITE_CACHE_H_ */
@@ -0,0 +1,256 @@
+/**
+ * @file rewrite_helper.c
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * rewrite_helper.c -- shared out-of-line routines for large AVX-512 lowerings
+ *
+ * Lowerings like vpermt2w or vcvttsd2usi expand into 30-60 instrs, which are
+ * copied into every fragment holding the app instr and crowd hot code out of the
+ * fcache and the I-cache.  Under -avx512_helper_threshold every lowered chain that
+ * encodes to at least that many bytes is emitted once into a pool of helper
+ * routines, much like the shared IBL routines, and each occurrence becomes
+ *
+ *     mov %rsp,%gs:avx512_helper_xsp
+ *     mov %gs:avx512_helper_stack,%rsp
+ *     call <helper>
+ *
+ * The app stack is never written: avx512_helper_stack holds the address just past
+ * TLS_AVX512_HELPER_RET_SLOT, so the call pushes the return pc into that slot.
+ * The helper runs the chain and goes back with the app stack pointer restored:
+ *
+ *     <chain>
+ *     mov %gs:avx512_helper_xsp,%rsp
+ *     jmp *%gs:avx512_helper_ret
+ *
+ * Chains are keyed by their encoding, so every occurrence of the same app instr
+ * shape shares one helper.  Only chains whose encoding does not depend on where
+ * it sits are taken: no rip-relative or absolute operands and no ctis leaving the
+ * chain.  Chains that touch memory other than TLS are kept inline, as a fault in
+ * a helper cannot be translated back to its app instr, and so are chains using
+ * the stack pointer, which does not point at the app stack in there.
+ *
+ * A relative call survives decode_fragment() when a block is copied into a trace,
+ * which is why the return pc is not passed as an immediate.  A signal arriving in
+ * a helper is delayed as for the other generated routines, with the fragment
+ * holding the call unlinked through rewrite_helper_return_pc().
+ */
+
+#include "rewrite_helper.h"
+#include "rewrite_utils.h"
+#include "../heap.h"
+#include "instr_api.h"
+#include "instr_create_shared.h"
+#include "instrlist.h"
+#include "opnd_api.h"
+
+#include <stddef.h> /* for offsetof */
+
+#define RWHELPER_POOL_SIZE (256 * 1024)
+#define RWHELPER_TABLE_SIZE 4096 /* power of 2 */
+#define RWHELPER_ALIGN 16
+/* longest helper, chains beyond it stay inline */
+#define RWHELPER_MAX_LEN 1024
+/* two %gs movs and a call: what an occurrence costs once its chain is out of line */
+#define RWHELPER_CALL_LEN 23
+
+typedef struct _rwhelper_entry_t {
+    uint hash;
+    uint len;
+    cache_pc pc;
+} rwhelper_entry_t;
+
+static byte *rwhelper_pool;
+static byte *rwhelper_pool_cur;
+static rwhelper_entry_t *rwhelper_table;
+static uint rwhelper_count;
+DECLARE_CXTSWPROT_VAR(static mutex_t avx512_helper_lock, INIT_LOCK_FREE(avx512_helper_lock));
+
+static opnd_t
+rwhelper_slot(ushort slot)
+{
+    return opnd_create_sized_tls_slot(os_tls_offset(slot), OPSZ_8);
+}
+
+void
+rewrite_helper_init(void)
+{
+    byte *pool;
+    if (DYNAMO_OPTION(avx512_helper_threshold) == 0)
+        return;
+    pool = heap_mmap(RWHELPER_POOL_SIZE, MEMPROT_EXEC | MEMPROT_READ | MEMPROT_WRITE,
+                     VMM_SPECIAL_MMAP | VMM_REACHABLE);
+    rwhelper_table = HEAP_ARRAY_ALLOC(GLOBAL_DCONTEXT, rwhelper_entry_t, RWHELPER_TABLE_SIZE, ACCT_OTHER, PROTECTED);
+    memset(rwhelper_table, 0, RWHELPER_TABLE_SIZE * sizeof(*rwhelper_table));
+    rwhelper_pool_cur = vmcode_get_executable_addr(pool);
+    rwhelper_pool = rwhelper_pool_cur;
+}
+
+void
+rewrite_helper_exit(void)
+{
+    if (rwhelper_pool != NULL) {
+        heap_munmap(vmcode_get_writable_addr(rwhelper_pool), RWHELPER_POOL_SIZE, VMM_SPECIAL_MMAP | VMM_REACHABLE);
+        HEAP_ARRAY_FREE(GLOBAL_DCONTEXT, rwhelper_table, rwhelper_entry_t, RWHELPER_TABLE_SIZE, ACCT_OTHER, PROTECTED);
+        rwhelper_pool = NULL;
+    }
+    DELETE_LOCK(avx512_helper_lock);
+}
+
+void
+rewrite_helper_thread_init(dcontext_t *dcontext)
+{
+    spill_state_t *spill = &dcontext->local_state->spill_space;
+    spill->avx512_helper_stack = (reg_t)(&spill->avx512_helper_ret + 1);
+}
+
+bool
+rewrite_helper_in_pool(cache_pc pc)
+{
+    return rwhelper_pool != NULL && pc >= rwhelper_pool && pc < rwhelper_pool_cur;
+}
+
+cache_pc
+rewrite_helper_return_pc(dcontext_t *dcontext)
+{
+    return (cache_pc)dcontext->local_state->spill_space.avx512_helper_ret;
+}
+
+void
+rewrite_helper_restore_xsp(dcontext_t *dcontext, priv_mcontext_t *mc)
+{
+    spill_state_t *spill = &dcontext->local_state->spill_space;
+    /* between the switch to the TLS stack and the helper's switch back */
+    if (mc->xsp == (reg_t)&spill->avx512_helper_ret || mc->xsp == spill->avx512_helper_stack)
+        mc->xsp = spill->avx512_helper_xsp;
+}
+
+static bool
+rwhelper_chain_has(instr_t *first, instr_t *target)
+{
+    for (instr_t *instr = first; instr != NULL; instr = instr_get_next(instr)) {
+        if (instr == target)
+            return true;
+    }
+    return false;
+}
+
+/* whether the chain encodes the same wherever it sits, only touches TLS and leaves xsp alone */
+static bool
+rwhelper_chain_outlinable(instr_t *first)
+{
+    for (instr_t *instr = first; instr != NULL; instr = instr_get_next(instr)) {
+        int num_srcs = instr_num_srcs(instr);
+        if (instr_is_label(instr))
+            continue;
+        if (!instr_operands_valid(instr) || instr_is_call(instr) || instr_is_return(instr) || instr_is_mbr(instr) ||
+            instr_is_syscall(instr) || instr_is_interrupt(instr) || instr_uses_reg(instr, DR_REG_XSP))
+            return false;
+        if (instr_is_cti(instr)) {
+            opnd_t target = instr_get_target(instr);
+            if (!opnd_is_instr(target) || !rwhelper_chain_has(first, opnd_get_instr(target)))
+                return false;
+            continue;
+        }
+        for (int i = 0; i < num_srcs + instr_num_dsts(instr); i++) {
+            opnd_t opnd = i < num_srcs ? instr_get_src(instr, i) : instr_get_dst(instr, i - num_srcs);
+            if (opnd_is_far_base_disp(opnd) && opnd_get_segment(opnd) == SEG_TLS && opnd_get_base(opnd) == DR_REG_NULL &&
+                opnd_get_index(opnd) == DR_REG_NULL)
+                continue;
+            if (opnd_is_pc(opnd) || opnd_is_instr(opnd) || opnd_is_memory_reference(opnd))
+                return false;
+        }
+    }
+    return true;
+}
+
+static uint
+rwhelper_hash(byte *code, uint len)
+{
+    uint hash = 2166136261u; /* FNV-1a */
+    for (uint i = 0; i < len; i++)
+        hash = (hash ^ code[i]) * 16777619u;
+    return hash;
+}
+
+/* caller holds avx512_helper_lock; NULL once the pool or the table is full */
+static cache_pc
+rwhelper_lookup_or_emit(byte *code, uint len, uint hash)
+{
+    rwhelper_entry_t *entry;
+    uint i;
+    for (i = hash & (RWHELPER_TABLE_SIZE - 1); rwhelper_table[i].pc != NULL; i = (i + 1) & (RWHELPER_TABLE_SIZE - 1)) {
+        entry = &rwhelper_table[i];
+        if (entry->hash == hash && entry->len == len && memcmp(entry->pc, code, len) == 0)
+            return entry->pc;
+    }
+    // keep probes short
+    if (rwhelper_count >= RWHELPER_TABLE_SIZE / 4 * 3 || rwhelper_pool_cur + len > rwhelper_pool + RWHELPER_POOL_SIZE)
+        return NULL;
+    entry = &rwhelper_table[i];
+    entry->hash = hash;
+    entry->len = len;
+    entry->pc = rwhelper_pool_cur;
+    memcpy(vmcode_get_writable_addr(entry->pc), code, len);
+    rwhelper_count++;
+    // publish the pool end only once the code is in place, for rewrite_helper_in_pool()
+    rwhelper_pool_cur = (byte *)ALIGN_FORWARD(entry->pc + len, RWHELPER_ALIGN);
+    RSTATS_INC(avx512_helpers_emitted);
+    RSTATS_ADD(avx512_helper_bytes, len);
+    return entry->pc;
+}
+
+instr_t *
+rewrite_helper_outline(dcontext_t *dcontext, instr_t *first)
+{
+    byte code[RWHELPER_MAX_LEN];
+    instrlist_t ilist;
+    instr_t *restore, *exit, *save, *load, *call;
+    byte *end;
+    uint len, chain_len;
+    cache_pc helper;
+    if (rwhelper_pool == NULL || first == NULL || !rwhelper_chain_outlinable(first))
+        return first;
+    instrlist_init(&ilist);
+    instrlist_append(&ilist, first);
+    restore = INSTR_CREATE_mov_ld(dcontext, opnd_create_reg(DR_REG_XSP), rwhelper_slot(TLS_AVX512_HELPER_XSP_SLOT));
+    exit = INSTR_CREATE_jmp_ind(dcontext, rwhelper_slot(TLS_AVX512_HELPER_RET_SLOT));
+    instrlist_append(&ilist, restore);
+    instrlist_append(&ilist, exit);
+    end = instrlist_encode_to_copy(dcontext, &ilist, code, code, code + sizeof(code), true /*instr targets*/);
+    len = end == NULL ? 0 : (uint)(end - code);
+    chain_len = end == NULL ? 0 : len - instr_length(dcontext, restore) - instr_length(dcontext, exit);
+    helper = NULL;
+    if (chain_len > RWHELPER_CALL_LEN && chain_len >= DYNAMO_OPTION(avx512_helper_threshold)) {
+        d_r_mutex_lock(&avx512_helper_lock);
+        helper = rwhelper_lookup_or_emit(code, len, rwhelper_hash(code, len));
+        d_r_mutex_unlock(&avx512_helper_lock);
+        if (helper == NULL)
+            RSTATS_INC(avx512_helper_pool_full);
+    }
+    if (helper == NULL) {
+        // hand the chain back as it came
+        instrlist_remove(&ilist, restore);
+        instrlist_remove(&ilist, exit);
+        instr_destroy(dcontext, restore);
+        instr_destroy(dcontext, exit);
+        return first;
+    }
+    instrlist_clear(dcontext, &ilist);
+    RSTATS_INC(avx512_helper_calls);
+    RSTATS_ADD(avx512_helper_bytes_saved, chain_len - RWHELPER_CALL_LEN);
+    save = INSTR_CREATE_mov_st(dcontext, rwhelper_slot(TLS_AVX512_HELPER_XSP_SLOT), opnd_create_reg(DR_REG_XSP));
+    load = INSTR_CREATE_mov_ld(dcontext, opnd_create_reg(DR_REG_XSP), rwhelper_slot(TLS_AVX512_HELPER_STACK_SLOT));
+    call = INSTR_CREATE_call(dcontext, opnd_create_pc(helper));
+    instr_set_meta(save);
+    instr_set_meta(load);
+    instr_set_meta(call);
+    instr_set_next(save, load);
+    instr_set_prev(load, save);
+    instr_set_next(load, call);
+    instr_set_prev(call, load);
+    return save;
+}
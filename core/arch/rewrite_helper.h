@@ -0,0 +1,65 @@
+/**
+ * @file rewrite_helper.h
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * rewrite_helper.h -- shared out-of-line routines for large AVX-512 lowerings
+ */
+
+#ifndef _REWRITE_HELPER_H_
+#define _REWRITE_HELPER_H_
+
+#include "../globals.h"
+#include "instr.h"
+
+/**
+ * @brief Reserve the helper pool when -avx512_helper_threshold is set.
+ */
+void
+rewrite_helper_init(void);
+
+/**
+ * @brief Free the helper pool.
+ */
+void
+rewrite_helper_exit(void);
+
+/**
+ * @brief Move the lowered chain starting at `first` out of line if it is large enough.
+ *
+ * Returns the chain to insert in its place: either `first` itself, or, once the
+ * chain has been found in or emitted into the pool and destroyed, the three meta
+ * instrs that call its helper.
+ */
+instr_t *
+rewrite_helper_outline(dcontext_t *dcontext, instr_t *first);
+
+/**
+ * @brief Point the thread's helper stack slot just past its return pc slot.
+ */
+void
+rewrite_helper_thread_init(dcontext_t *dcontext);
+
+/**
+ * @brief Whether `pc` lies in a helper routine.
+ */
+bool
+rewrite_helper_in_pool(cache_pc pc);
+
+/**
+ * @brief The fragment pc a thread interrupted in a helper will return to.
+ */
+cache_pc
+rewrite_helper_return_pc(dcontext_t *dcontext);
+
+/**
+ * @brief Put back the app stack pointer in `mc` if it was taken while a helper
+ *        call had switched to the TLS stack.
+ */
+void
+rewrite_helper_restore_xsp(dcontext_t *dcontext, priv_mcontext_t *mc);
+
+#endif /* _REWRITE_HELPER_H_ */
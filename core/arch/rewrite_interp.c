@@ -0,0 +1,700 @@
+/**
+ * @file rewrite_interp.c
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * rewrite_interp.c -- clean-call reference interpreter for cold AVX-512 instrs
+ *
+ * Most AVX-512 sites run a handful of times, yet each one is lowered into an
+ * inline chain of tens of instrs.  Under -avx512_tier_threshold an instr the
+ * interpreter implements starts on tier 0: a clean call into rwinterp_clean_call(),
+ * which decodes the app instr and carries it out in C on the emulated state, and
+ * counts the executions of its site.  Once a site reaches the threshold its
+ * fragments are unlinked and flushed, and the rebuilt block gets the inline
+ * lowering.
+ *
+ * The interpreter is also the answer for instrs that have no lowering
+ * (rw_func_empty) or whose lowering fails: those run on tier 0 for good, and an
+ * instr the interpreter does not implement either raises SIGILL, as it would on
+ * a host without AVX-512, rather than being dropped.
+ *
+ * The emulated state is read where the lowerings keep it: the low 256 bits of
+ * zmm0-15 in the ymm regs saved by the clean call, their upper halves,
+ * zmm16-31 and the opmask regs in TLS.  With -avx512_native_subsets a tier-0
+ * call sits in a run bracketed by the state copies, so the same holds there.
+ * FP ops run with the app MXCSR, which is live at a tier-0 call since the
+ * {er}/{sae} runs are closed before it; instrs carrying their own rounding are
+ * not interpreted.
+ */
+
+#include "rewrite_interp.h"
+#include "rewrite_utils.h"
+#include "../monitor.h"
+#include "decode.h"
+#include "dr_ir_utils.h"
+#include "dr_tools.h"
+#include "instr_api.h"
+#include "instrlist.h"
+#include "opnd_api.h"
+
+#define RWINTERP_TABLE_SIZE 16384 /* power of 2 */
+
+typedef enum {
+    RWI_NONE,
+    /* vector, element-wise */
+    RWI_ADD,
+    RWI_SUB,
+    RWI_MULLO,
+    RWI_AND,
+    RWI_ANDN,
+    RWI_OR,
+    RWI_XOR,
+    RWI_MINS,
+    RWI_MINU,
+    RWI_MAXS,
+    RWI_MAXU,
+    RWI_MOV,
+    RWI_BCST,
+    RWI_FADD,
+    RWI_FSUB,
+    RWI_FMUL,
+    RWI_FDIV,
+    RWI_FMIN,
+    RWI_FMAX,
+    /* vector, element-wise into an opmask */
+    RWI_TESTM,
+    RWI_TESTNM,
+    RWI_CMPEQ,
+    RWI_CMP,
+    RWI_CMPU,
+    /* opmask */
+    RWI_KAND,
+    RWI_KANDN,
+    RWI_KOR,
+    RWI_KXOR,
+    RWI_KXNOR,
+    RWI_KNOT,
+    RWI_KMOV,
+} rwinterp_kind_t;
+
+typedef enum {
+    RWINTERP_OK,
+    RWINTERP_UNSUPPORTED,
+    RWINTERP_FAULT,
+} rwinterp_status_t;
+
+typedef struct _rwinterp_op_t {
+    int opcode;
+    rwinterp_kind_t kind;
+    uint esize; /* element bytes, or opmask width in bytes */
+} rwinterp_op_t;
+
+static const rwinterp_op_t rwinterp_ops[] = {
+    { OP_vpaddb, RWI_ADD, 1 },          { OP_vpaddw, RWI_ADD, 2 },          { OP_vpaddd, RWI_ADD, 4 },
+    { OP_vpaddq, RWI_ADD, 8 },          { OP_vpsubb, RWI_SUB, 1 },          { OP_vpsubw, RWI_SUB, 2 },
+    { OP_vpsubd, RWI_SUB, 4 },          { OP_vpsubq, RWI_SUB, 8 },          { OP_vpmullw, RWI_MULLO, 2 },
+    { OP_vpmulld, RWI_MULLO, 4 },       { OP_vpmullq, RWI_MULLO, 8 },       { OP_vpandd, RWI_AND, 4 },
+    { OP_vpandq, RWI_AND, 8 },          { OP_vpandnd, RWI_ANDN, 4 },        { OP_vpandnq, RWI_ANDN, 8 },
+    { OP_vpord, RWI_OR, 4 },            { OP_vporq, RWI_OR, 8 },            { OP_vpxord, RWI_XOR, 4 },
+    { OP_vpxorq, RWI_XOR, 8 },          { OP_vpminsb, RWI_MINS, 1 },        { OP_vpminsw, RWI_MINS, 2 },
+    { OP_vpminsd, RWI_MINS, 4 },        { OP_vpminsq, RWI_MINS, 8 },        { OP_vpminub, RWI_MINU, 1 },
+    { OP_vpminuw, RWI_MINU, 2 },        { OP_vpminud, RWI_MINU, 4 },        { OP_vpminuq, RWI_MINU, 8 },
+    { OP_vpmaxsb, RWI_MAXS, 1 },        { OP_vpmaxsw, RWI_MAXS, 2 },        { OP_vpmaxsd, RWI_MAXS, 4 },
+    { OP_vpmaxsq, RWI_MAXS, 8 },        { OP_vpmaxub, RWI_MAXU, 1 },        { OP_vpmaxuw, RWI_MAXU, 2 },
+    { OP_vpmaxud, RWI_MAXU, 4 },        { OP_vpmaxuq, RWI_MAXU, 8 },        { OP_vmovdqa32, RWI_MOV, 4 },
+    { OP_vmovdqa64, RWI_MOV, 8 },       { OP_vmovdqu8, RWI_MOV, 1 },        { OP_vmovdqu16, RWI_MOV, 2 },
+    { OP_vmovdqu32, RWI_MOV, 4 },       { OP_vmovdqu64, RWI_MOV, 8 },       { OP_vmovups, RWI_MOV, 4 },
+    { OP_vmovaps, RWI_MOV, 4 },         { OP_vmovupd, RWI_MOV, 8 },         { OP_vmovapd, RWI_MOV, 8 },
+    { OP_vpbroadcastb, RWI_BCST, 1 },   { OP_vpbroadcastw, RWI_BCST, 2 },   { OP_vpbroadcastd, RWI_BCST, 4 },
+    { OP_vpbroadcastq, RWI_BCST, 8 },   { OP_vbroadcastss, RWI_BCST, 4 },   { OP_vbroadcastsd, RWI_BCST, 8 },
+    { OP_vaddps, RWI_FADD, 4 },         { OP_vaddpd, RWI_FADD, 8 },         { OP_vsubps, RWI_FSUB, 4 },
+    { OP_vsubpd, RWI_FSUB, 8 },         { OP_vmulps, RWI_FMUL, 4 },         { OP_vmulpd, RWI_FMUL, 8 },
+    { OP_vdivps, RWI_FDIV, 4 },         { OP_vdivpd, RWI_FDIV, 8 },         { OP_vminps, RWI_FMIN, 4 },
+    { OP_vminpd, RWI_FMIN, 8 },         { OP_vmaxps, RWI_FMAX, 4 },         { OP_vmaxpd, RWI_FMAX, 8 },
+    { OP_vptestmb, RWI_TESTM, 1 },      { OP_vptestmw, RWI_TESTM, 2 },      { OP_vptestmd, RWI_TESTM, 4 },
+    { OP_vptestmq, RWI_TESTM, 8 },      { OP_vptestnmb, RWI_TESTNM, 1 },    { OP_vptestnmw, RWI_TESTNM, 2 },
+    { OP_vptestnmd, RWI_TESTNM, 4 },    { OP_vptestnmq, RWI_TESTNM, 8 },    { OP_vpcmpeqb, RWI_CMPEQ, 1 },
+    { OP_vpcmpeqw, RWI_CMPEQ, 2 },      { OP_vpcmpeqd, RWI_CMPEQ, 4 },      { OP_vpcmpeqq, RWI_CMPEQ, 8 },
+    { OP_vpcmpb, RWI_CMP, 1 },          { OP_vpcmpw, RWI_CMP, 2 },          { OP_vpcmpd, RWI_CMP, 4 },
+    { OP_vpcmpq, RWI_CMP, 8 },          { OP_vpcmpub, RWI_CMPU, 1 },        { OP_vpcmpuw, RWI_CMPU, 2 },
+    { OP_vpcmpud, RWI_CMPU, 4 },        { OP_vpcmpuq, RWI_CMPU, 8 },
+    { OP_kandb, RWI_KAND, 1 },          { OP_kandw, RWI_KAND, 2 },          { OP_kandd, RWI_KAND, 4 },
+    { OP_kandq, RWI_KAND, 8 },          { OP_kandnb, RWI_KANDN, 1 },        { OP_kandnw, RWI_KANDN, 2 },
+    { OP_kandnd, RWI_KANDN, 4 },        { OP_kandnq, RWI_KANDN, 8 },        { OP_korb, RWI_KOR, 1 },
+    { OP_korw, RWI_KOR, 2 },            { OP_kord, RWI_KOR, 4 },            { OP_korq, RWI_KOR, 8 },
+    { OP_kxorb, RWI_KXOR, 1 },          { OP_kxorw, RWI_KXOR, 2 },          { OP_kxord, RWI_KXOR, 4 },
+    { OP_kxorq, RWI_KXOR, 8 },          { OP_kxnorb, RWI_KXNOR, 1 },        { OP_kxnorw, RWI_KXNOR, 2 },
+    { OP_kxnord, RWI_KXNOR, 4 },        { OP_kxnorq, RWI_KXNOR, 8 },        { OP_knotb, RWI_KNOT, 1 },
+    { OP_knotw, RWI_KNOT, 2 },          { OP_knotd, RWI_KNOT, 4 },          { OP_knotq, RWI_KNOT, 8 },
+    { OP_kmovb, RWI_KMOV, 1 },          { OP_kmovw, RWI_KMOV, 2 },          { OP_kmovd, RWI_KMOV, 4 },
+    { OP_kmovq, RWI_KMOV, 8 },
+};
+
+/* index + 1 into rwinterp_ops, 0 for opcodes not interpreted */
+static byte rwinterp_op_index[OP_AFTER_LAST];
+
+typedef union _rwinterp_vec_t {
+    byte b[64];
+    ushort w[32];
+    uint d[16];
+    uint64 q[8];
+} rwinterp_vec_t;
+
+typedef struct _rwinterp_site_t {
+    app_pc pc;
+    volatile uint count;
+    volatile bool hot; /* promoted to the inline lowering */
+} rwinterp_site_t;
+
+static rwinterp_site_t *rwinterp_sites;
+static uint rwinterp_num_sites;
+DECLARE_CXTSWPROT_VAR(static mutex_t avx512_interp_lock, INIT_LOCK_FREE(avx512_interp_lock));
+
+void
+rewrite_interp_init(void)
+{
+    for (uint i = 0; i < sizeof(rwinterp_ops) / sizeof(rwinterp_ops[0]); i++)
+        rwinterp_op_index[rwinterp_ops[i].opcode] = (byte)(i + 1);
+    if (DYNAMO_OPTION(avx512_tier_threshold) == 0)
+        return;
+    rwinterp_sites = HEAP_ARRAY_ALLOC(GLOBAL_DCONTEXT, rwinterp_site_t, RWINTERP_TABLE_SIZE, ACCT_OTHER, PROTECTED);
+    memset(rwinterp_sites, 0, RWINTERP_TABLE_SIZE * sizeof(*rwinterp_sites));
+}
+
+void
+rewrite_interp_exit(void)
+{
+    if (rwinterp_sites != NULL) {
+        HEAP_ARRAY_FREE(GLOBAL_DCONTEXT, rwinterp_sites, rwinterp_site_t, RWINTERP_TABLE_SIZE, ACCT_OTHER, PROTECTED);
+        rwinterp_sites = NULL;
+    }
+    DELETE_LOCK(avx512_interp_lock);
+}
+
+static const rwinterp_op_t *
+rwinterp_op(instr_t *instr)
+{
+    byte index = rwinterp_op_index[instr_get_opcode(instr)];
+    return index == 0 ? NULL : &rwinterp_ops[index - 1];
+}
+
+bool
+rewrite_interp_supports(instr_t *instr)
+{
+    const rwinterp_op_t *op = rwinterp_op(instr);
+    opnd_t dst;
+    if (op == NULL || instr_num_dsts(instr) != 1)
+        return false;
+    dst = instr_get_dst(instr, 0);
+    if (op->kind >= RWI_KAND)
+        return !opnd_is_reg(dst) || reg_is_opmask(opnd_get_reg(dst)) || reg_is_gpr(opnd_get_reg(dst));
+    // the evex forms only, which carry the opmask as their first source
+    if (instr_num_srcs(instr) < 2 || !opnd_is_reg(instr_get_src(instr, 0)) ||
+        !reg_is_opmask(opnd_get_reg(instr_get_src(instr, 0))))
+        return false;
+    // {er}/{sae} on a reg-reg form
+    if (TEST(AVX512_PREFIX_EVEX_B, instr_get_prefixes(instr)) && !instr_reads_memory(instr))
+        return false;
+    if (op->kind >= RWI_TESTM)
+        return opnd_is_reg(dst) && reg_is_opmask(opnd_get_reg(dst));
+    if (opnd_is_reg(dst))
+        return reg_is_vector_simd(opnd_get_reg(dst));
+    return op->kind == RWI_MOV && opnd_is_memory_reference(dst);
+}
+
+/* ======================================== *
+ *    emulated state
+ * ======================================== */
+
+static void
+rwinterp_get_zmm(dcontext_t *dcontext, priv_mcontext_t *mc, uint idx, rwinterp_vec_t *v)
+{
+    dr_zmm_t *tls = &dcontext->local_state->spill_space.zmm_regs[idx];
+    if (idx < 16) {
+        memcpy(v->b, &mc->simd[idx], SIZE_OF_YMM);
+        memcpy(v->b + SIZE_OF_YMM, tls->u8 + SIZE_OF_YMM, SIZE_OF_YMM);
+    } else
+        memcpy(v->b, tls->u8, sizeof(*v));
+}
+
+static void
+rwinterp_set_zmm(dcontext_t *dcontext, priv_mcontext_t *mc, uint idx, rwinterp_vec_t *v)
+{
+    dr_zmm_t *tls = &dcontext->local_state->spill_space.zmm_regs[idx];
+    if (idx < 16) {
+        memcpy(&mc->simd[idx], v->b, SIZE_OF_YMM);
+        memcpy(tls->u8 + SIZE_OF_YMM, v->b + SIZE_OF_YMM, SIZE_OF_YMM);
+    } else
+        memcpy(tls->u8, v->b, sizeof(*v));
+}
+
+static uint64 *
+rwinterp_k(dcontext_t *dcontext, reg_id_t reg)
+{
+    return (uint64 *)&dcontext->local_state->spill_space.k_regs[reg - DR_REG_K0];
+}
+
+static uint64
+rwinterp_get_elem(rwinterp_vec_t *v, uint i, uint esize)
+{
+    switch (esize) {
+    case 1: return v->b[i];
+    case 2: return v->w[i];
+    case 4: return v->d[i];
+    default: return v->q[i];
+    }
+}
+
+static void
+rwinterp_set_elem(rwinterp_vec_t *v, uint i, uint esize, uint64 val)
+{
+    switch (esize) {
+    case 1: v->b[i] = (byte)val; break;
+    case 2: v->w[i] = (ushort)val; break;
+    case 4: v->d[i] = (uint)val; break;
+    default: v->q[i] = val; break;
+    }
+}
+
+/* the first byte of [addr, addr + size) the app cannot read (or write), NULL if none */
+static app_pc
+rwinterp_inaccessible(app_pc addr, size_t size, bool write)
+{
+    app_pc end = addr + size;
+    while (addr < end) {
+        byte *base;
+        size_t len;
+        uint prot;
+        if (!get_memory_info(addr, &base, &len, &prot) ||
+            !TEST(write ? MEMPROT_WRITE : MEMPROT_READ, prot))
+            return addr;
+        if (base + len <= addr)
+            break;
+        addr = base + len;
+    }
+    return NULL;
+}
+
+static rwinterp_status_t
+rwinterp_read_mem(app_pc addr, size_t size, void *buf, app_pc *fault)
+{
+    if (d_r_safe_read(addr, size, buf))
+        return RWINTERP_OK;
+    *fault = rwinterp_inaccessible(addr, size, false);
+    // a fault the memory view does not explain lands on the first byte
+    if (*fault == NULL)
+        *fault = addr;
+    return RWINTERP_FAULT;
+}
+
+/* A vector source, with element 0 spread over the vector for broadcasts.  As in
+ * hardware a memory source reads only the elements enabled in mask, so that a
+ * masked-off element on an unmapped page does not fault, and {1toN} reads one.
+ */
+static rwinterp_status_t
+rwinterp_read_vec(dcontext_t *dcontext, priv_mcontext_t *mc, opnd_t opnd, uint vl, uint esize, bool bcst,
+                  uint64 mask, rwinterp_vec_t *v, app_pc *fault)
+{
+    uint size = opnd_size_in_bytes(opnd_get_size(opnd));
+    memset(v, 0, sizeof(*v));
+    if (opnd_is_reg(opnd) && reg_is_gpr(opnd_get_reg(opnd))) {
+        v->q[0] = reg_get_value_priv(reg_to_pointer_sized(opnd_get_reg(opnd)), mc);
+        bcst = true;
+    } else if (opnd_is_reg(opnd)) {
+        if (!reg_is_vector_simd(opnd_get_reg(opnd)))
+            return RWINTERP_UNSUPPORTED;
+        rwinterp_get_zmm(dcontext, mc, reg_resize_to_opsz(opnd_get_reg(opnd), OPSZ_64) - DR_REG_ZMM0, v);
+    } else if (opnd_is_memory_reference(opnd)) {
+        app_pc addr = opnd_compute_address_priv(opnd, mc);
+        uint n = vl / esize;
+        uint64 all = n == 64 ? ~0ull : (1ull << n) - 1;
+        rwinterp_status_t status = RWINTERP_OK;
+        if (size > sizeof(*v))
+            return RWINTERP_UNSUPPORTED;
+        if ((mask & all) == 0)
+            return RWINTERP_OK;
+        bcst = bcst || size < vl;
+        if (bcst)
+            status = rwinterp_read_mem(addr, MIN(size, esize), v->b, fault);
+        else if ((mask & all) == all)
+            status = rwinterp_read_mem(addr, size, v->b, fault);
+        else {
+            for (uint i = 0; i < n && status == RWINTERP_OK; i++) {
+                if (TEST(1ull << i, mask))
+                    status = rwinterp_read_mem(addr + i * esize, esize, v->b + i * esize, fault);
+            }
+        }
+        if (status != RWINTERP_OK)
+            return status;
+    } else
+        return RWINTERP_UNSUPPORTED;
+    if (bcst) {
+        for (uint i = 1; i < vl / esize; i++)
+            rwinterp_set_elem(v, i, esize, rwinterp_get_elem(v, 0, esize));
+    }
+    return RWINTERP_OK;
+}
+
+static rwinterp_status_t
+rwinterp_read_scalar(dcontext_t *dcontext, priv_mcontext_t *mc, opnd_t opnd, uint size, uint64 *val,
+                     app_pc *fault)
+{
+    *val = 0;
+    if (opnd_is_reg(opnd) && reg_is_opmask(opnd_get_reg(opnd)))
+        *val = *rwinterp_k(dcontext, opnd_get_reg(opnd));
+    else if (opnd_is_reg(opnd) && reg_is_gpr(opnd_get_reg(opnd)))
+        *val = reg_get_value_priv(reg_to_pointer_sized(opnd_get_reg(opnd)), mc);
+    else if (opnd_is_memory_reference(opnd))
+        return rwinterp_read_mem(opnd_compute_address_priv(opnd, mc), size, val, fault);
+    else
+        return RWINTERP_UNSUPPORTED;
+    return RWINTERP_OK;
+}
+
+static rwinterp_status_t
+rwinterp_write_scalar(dcontext_t *dcontext, priv_mcontext_t *mc, opnd_t opnd, uint size, uint64 val,
+                      app_pc *fault)
+{
+    if (opnd_is_reg(opnd) && reg_is_opmask(opnd_get_reg(opnd)))
+        *rwinterp_k(dcontext, opnd_get_reg(opnd)) = val;
+    else if (opnd_is_reg(opnd) && reg_is_gpr(opnd_get_reg(opnd)))
+        reg_set_value_priv(reg_to_pointer_sized(opnd_get_reg(opnd)), mc, val);
+    else if (opnd_is_memory_reference(opnd)) {
+        app_pc addr = opnd_compute_address_priv(opnd, mc);
+        if (!safe_write_ex(addr, size, &val, NULL)) {
+            *fault = rwinterp_inaccessible(addr, size, true);
+            if (*fault == NULL)
+                *fault = addr;
+            return RWINTERP_FAULT;
+        }
+    } else
+        return RWINTERP_UNSUPPORTED;
+    return RWINTERP_OK;
+}
+
+/* A masked store writes all of its enabled elements or, when one of them is not
+ * writable, none: the probe comes first so that a fault leaves memory as it was.
+ */
+static rwinterp_status_t
+rwinterp_write_vec(app_pc addr, uint esize, uint n, uint64 mask, rwinterp_vec_t *v, app_pc *fault)
+{
+    uint i;
+    for (i = 0; i < n; i++) {
+        if (TEST(1ull << i, mask)) {
+            *fault = rwinterp_inaccessible(addr + i * esize, esize, true);
+            if (*fault != NULL)
+                return RWINTERP_FAULT;
+        }
+    }
+    for (i = 0; i < n; i++) {
+        if (TEST(1ull << i, mask) && !safe_write_ex(addr + i * esize, esize, v->b + i * esize, NULL)) {
+            // the mapping changed under us
+            *fault = addr + i * esize;
+            return RWINTERP_FAULT;
+        }
+    }
+    return RWINTERP_OK;
+}
+
+/* ======================================== *
+ *    element ops
+ * ======================================== */
+
+static int64
+rwinterp_sext(uint64 val, uint esize)
+{
+    uint shift = 64 - esize * 8;
+    return (int64)(val << shift) >> shift;
+}
+
+/* x86 min/max hand back the second operand on unordered or equal inputs */
+static uint64
+rwinterp_fp_op(rwinterp_kind_t kind, uint esize, uint64 x, uint64 y)
+{
+    if (esize == 4) {
+        uint xb = (uint)x, yb = (uint)y, rb;
+        float a, b, r;
+        memcpy(&a, &xb, sizeof(a));
+        memcpy(&b, &yb, sizeof(b));
+        switch (kind) {
+        case RWI_FADD: r = a + b; break;
+        case RWI_FSUB: r = a - b; break;
+        case RWI_FMUL: r = a * b; break;
+        case RWI_FDIV: r = a / b; break;
+        case RWI_FMIN: r = a < b ? a : b; break;
+        default: r = a > b ? a : b; break;
+        }
+        memcpy(&rb, &r, sizeof(rb));
+        return rb;
+    } else {
+        double a, b, r;
+        uint64 rb;
+        memcpy(&a, &x, sizeof(a));
+        memcpy(&b, &y, sizeof(b));
+        switch (kind) {
+        case RWI_FADD: r = a + b; break;
+        case RWI_FSUB: r = a - b; break;
+        case RWI_FMUL: r = a * b; break;
+        case RWI_FDIV: r = a / b; break;
+        case RWI_FMIN: r = a < b ? a : b; break;
+        default: r = a > b ? a : b; break;
+        }
+        memcpy(&rb, &r, sizeof(rb));
+        return rb;
+    }
+}
+
+static uint64
+rwinterp_elem_op(rwinterp_kind_t kind, uint esize, uint64 x, uint64 y)
+{
+    switch (kind) {
+    case RWI_ADD: return x + y;
+    case RWI_SUB: return x - y;
+    case RWI_MULLO: return x * y;
+    case RWI_AND: return x & y;
+    case RWI_ANDN: return ~x & y;
+    case RWI_OR: return x | y;
+    case RWI_XOR: return x ^ y;
+    case RWI_MINS: return rwinterp_sext(x, esize) < rwinterp_sext(y, esize) ? x : y;
+    case RWI_MINU: return x < y ? x : y;
+    case RWI_MAXS: return rwinterp_sext(x, esize) > rwinterp_sext(y, esize) ? x : y;
+    case RWI_MAXU: return x > y ? x : y;
+    case RWI_MOV:
+    case RWI_BCST: return x;
+    default: return rwinterp_fp_op(kind, esize, x, y);
+    }
+}
+
+/* vptestm/vptestnm and the vpcmp predicates: eq, lt, le, false, ne, nlt, nle, true */
+static bool
+rwinterp_cmp_op(rwinterp_kind_t kind, uint esize, uint pred, uint64 x, uint64 y)
+{
+    bool lt, eq = x == y;
+    switch (kind) {
+    case RWI_TESTM: return (x & y) != 0;
+    case RWI_TESTNM: return (x & y) == 0;
+    case RWI_CMPEQ: return eq;
+    case RWI_CMP: lt = rwinterp_sext(x, esize) < rwinterp_sext(y, esize); break;
+    default: lt = x < y; break;
+    }
+    switch (pred & 7) {
+    case 0: return eq;
+    case 1: return lt;
+    case 2: return lt || eq;
+    case 3: return false;
+    case 4: return !eq;
+    case 5: return !lt;
+    case 6: return !lt && !eq;
+    default: return true;
+    }
+}
+
+/* ======================================== *
+ *    instr execution
+ * ======================================== */
+
+static rwinterp_status_t
+rwinterp_exec_vector(dcontext_t *dcontext, priv_mcontext_t *mc, instr_t *instr, const rwinterp_op_t *op,
+                     app_pc *fault)
+{
+    opnd_t dst = instr_get_dst(instr, 0);
+    opnd_t mask_opnd = instr_get_src(instr, 0);
+    bool to_opmask = op->kind >= RWI_TESTM;
+    // vpcmp carries its predicate ahead of the sources
+    bool has_pred = op->kind == RWI_CMP || op->kind == RWI_CMPU;
+    uint src = has_pred ? 2 : 1;
+    bool binary = instr_num_srcs(instr) > src + 1;
+    uint vl = opnd_size_in_bytes(opnd_get_size(to_opmask ? instr_get_src(instr, src) : dst));
+    uint n = vl / op->esize;
+    bool zeroing = TEST(AVX512_PREFIX_EVEX_Z, instr_get_prefixes(instr));
+    uint64 mask = opnd_get_reg(mask_opnd) == DR_REG_K0 ? ~0ull : *rwinterp_k(dcontext, opnd_get_reg(mask_opnd));
+    rwinterp_vec_t a, b, res;
+    rwinterp_status_t status;
+    uint i;
+    if (has_pred && !opnd_is_immed_int(instr_get_src(instr, 1)))
+        return RWINTERP_UNSUPPORTED;
+    memset(&b, 0, sizeof(b));
+    status = rwinterp_read_vec(dcontext, mc, instr_get_src(instr, src), vl, op->esize, op->kind == RWI_BCST, mask,
+                               &a, fault);
+    if (status == RWINTERP_OK && binary) {
+        status = rwinterp_read_vec(dcontext, mc, instr_get_src(instr, src + 1), vl, op->esize, false, mask, &b,
+                                   fault);
+    }
+    if (status != RWINTERP_OK)
+        return status;
+    if (to_opmask) {
+        uint pred = has_pred ? (uint)opnd_get_immed_int(instr_get_src(instr, 1)) : 0;
+        uint64 bits = 0;
+        for (i = 0; i < n; i++) {
+            if (TEST(1ull << i, mask) &&
+                rwinterp_cmp_op(op->kind, op->esize, pred, rwinterp_get_elem(&a, i, op->esize),
+                                rwinterp_get_elem(&b, i, op->esize)))
+                bits |= 1ull << i;
+        }
+        *rwinterp_k(dcontext, opnd_get_reg(dst)) = bits;
+        return RWINTERP_OK;
+    }
+    // masked stores leave the memory of clear elements untouched
+    if (opnd_is_memory_reference(dst))
+        return rwinterp_write_vec(opnd_compute_address_priv(dst, mc), op->esize, n, mask, &a, fault);
+    // evex writes zero the dst past the vector length
+    rwinterp_get_zmm(dcontext, mc, reg_resize_to_opsz(opnd_get_reg(dst), OPSZ_64) - DR_REG_ZMM0, &res);
+    for (i = 0; i < n; i++) {
+        if (TEST(1ull << i, mask)) {
+            rwinterp_set_elem(&res, i, op->esize,
+                              rwinterp_elem_op(op->kind, op->esize, rwinterp_get_elem(&a, i, op->esize),
+                                               rwinterp_get_elem(&b, i, op->esize)));
+        } else if (zeroing)
+            rwinterp_set_elem(&res, i, op->esize, 0);
+    }
+    memset(res.b + vl, 0, sizeof(res) - vl);
+    rwinterp_set_zmm(dcontext, mc, reg_resize_to_opsz(opnd_get_reg(dst), OPSZ_64) - DR_REG_ZMM0, &res);
+    return RWINTERP_OK;
+}
+
+static rwinterp_status_t
+rwinterp_exec_opmask(dcontext_t *dcontext, priv_mcontext_t *mc, instr_t *instr, const rwinterp_op_t *op,
+                     app_pc *fault)
+{
+    uint64 width = op->esize == 8 ? ~0ull : (1ull << (op->esize * 8)) - 1;
+    uint64 x, y = 0, r;
+    rwinterp_status_t status = rwinterp_read_scalar(dcontext, mc, instr_get_src(instr, 0), op->esize, &x, fault);
+    if (status == RWINTERP_OK && instr_num_srcs(instr) > 1)
+        status = rwinterp_read_scalar(dcontext, mc, instr_get_src(instr, 1), op->esize, &y, fault);
+    if (status != RWINTERP_OK)
+        return status;
+    switch (op->kind) {
+    case RWI_KAND: r = x & y; break;
+    case RWI_KANDN: r = ~x & y; break;
+    case RWI_KOR: r = x | y; break;
+    case RWI_KXOR: r = x ^ y; break;
+    case RWI_KXNOR: r = ~(x ^ y); break;
+    case RWI_KNOT: r = ~x; break;
+    default: r = x; break;
+    }
+    // opmask and gpr dsts are zero-extended
+    return rwinterp_write_scalar(dcontext, mc, instr_get_dst(instr, 0), op->esize, r & width, fault);
+}
+
+static rwinterp_status_t
+rwinterp_exec(dcontext_t *dcontext, priv_mcontext_t *mc, instr_t *instr, app_pc *fault)
+{
+    const rwinterp_op_t *op = rwinterp_op(instr);
+    if (!rewrite_interp_supports(instr))
+        return RWINTERP_UNSUPPORTED;
+    if (op->kind >= RWI_KAND)
+        return rwinterp_exec_opmask(dcontext, mc, instr, op, fault);
+    return rwinterp_exec_vector(dcontext, mc, instr, op, fault);
+}
+
+/* Hands the app the signal the instr raises, from the state the clean call saved:
+ * SIGILL, or a SIGSEGV on the byte it could not access.
+ */
+static void
+rwinterp_raise(dcontext_t *dcontext, priv_mcontext_t *mc, app_pc pc, app_pc fault)
+{
+    if (is_building_trace(dcontext))
+        trace_abort(dcontext);
+    *get_mcontext(dcontext) = *mc;
+    get_mcontext(dcontext)->pc = pc;
+    if (fault != NULL)
+        os_forge_memory_fault(pc, fault);
+    else
+        os_forge_exception(pc, ILLEGAL_INSTRUCTION_EXCEPTION);
+    ASSERT_NOT_REACHED();
+}
+
+static void
+rwinterp_clean_call(rwinterp_site_t *site, app_pc pc)
+{
+    dcontext_t *dcontext = get_thread_private_dcontext();
+    priv_mcontext_t *mc = get_priv_mcontext_from_dstack(dcontext);
+    rwinterp_status_t status = RWINTERP_UNSUPPORTED;
+    app_pc fault = NULL;
+    instr_t instr;
+    /* The xsp slot holds the dstack: the app's is in the dcontext, as in
+     * dr_get_mcontext().  The clean call does not restore xsp from the slot.
+     */
+    mc->xsp = get_mcontext(dcontext)->xsp;
+    instr_init(dcontext, &instr);
+    if (decode(dcontext, pc, &instr) != NULL)
+        status = rwinterp_exec(dcontext, mc, &instr, &fault);
+    instr_free(dcontext, &instr);
+    if (status != RWINTERP_OK) {
+#ifdef DEBUG
+        REWRITE_ERROR(STD_ERRF, "AVX-512 instr at %p %s", pc,
+                      status == RWINTERP_FAULT ? "faulted in the interpreter" : "has no lowering nor interpreter op");
+#endif
+        rwinterp_raise(dcontext, mc, pc, status == RWINTERP_FAULT ? fault : NULL);
+    }
+    STATS_INC(avx512_interp_execs);
+    if (site != NULL && !site->hot && ++site->count >= DYNAMO_OPTION(avx512_tier_threshold)) {
+        // the current fragment runs on to its exit, the next entry rebuilds it
+        site->hot = true;
+        RSTATS_INC(avx512_tier_promotions);
+        dr_unlink_flush_region(pc, 1);
+    }
+}
+
+static instr_t *
+rwinterp_call(dcontext_t *dcontext, app_pc pc, rwinterp_site_t *site)
+{
+    instrlist_t ilist;
+    instr_t *first;
+    instrlist_init(&ilist);
+    dr_insert_clean_call_ex(dcontext, &ilist, NULL, (void *)rwinterp_clean_call,
+                            DR_CLEANCALL_READS_APP_CONTEXT | DR_CLEANCALL_WRITES_APP_CONTEXT, 2,
+                            OPND_CREATE_INTPTR((ptr_int_t)site), OPND_CREATE_INTPTR((ptr_int_t)pc));
+    first = instrlist_first(&ilist);
+    instrlist_init(&ilist);
+    return first;
+}
+
+/* NULL once the table is 3/4 full */
+static rwinterp_site_t *
+rwinterp_site_lookup(app_pc pc)
+{
+    rwinterp_site_t *site = NULL;
+    uint i = (uint)(((ptr_uint_t)pc * 0x9e3779b1u) >> 8) & (RWINTERP_TABLE_SIZE - 1);
+    d_r_mutex_lock(&avx512_interp_lock);
+    for (; rwinterp_sites[i].pc != NULL; i = (i + 1) & (RWINTERP_TABLE_SIZE - 1)) {
+        if (rwinterp_sites[i].pc == pc) {
+            site = &rwinterp_sites[i];
+            break;
+        }
+    }
+    if (site == NULL && rwinterp_num_sites < RWINTERP_TABLE_SIZE / 4 * 3) {
+        site = &rwinterp_sites[i];
+        site->pc = pc;
+        rwinterp_num_sites++;
+        RSTATS_INC(avx512_tier0_sites);
+    }
+    d_r_mutex_unlock(&avx512_interp_lock);
+    return site;
+}
+
+instr_t *
+rewrite_interp_tier0(dcontext_t *dcontext, instr_t *instr, app_pc pc, bool has_lowering)
+{
+    rwinterp_site_t *site;
+    if (!has_lowering) {
+        RSTATS_INC(avx512_interp_fallbacks);
+        return rwinterp_call(dcontext, pc, NULL);
+    }
+    if (rwinterp_sites == NULL || !rewrite_interp_supports(instr))
+        return NULL;
+    site = rwinterp_site_lookup(pc);
+    if (site == NULL || site->hot)
+        return NULL;
+    return rwinterp_call(dcontext, pc, site);
+}
+
+instr_t *
+rewrite_interp_fallback(dcontext_t *dcontext, app_pc pc)
+{
+    RSTATS_INC(avx512_interp_fallbacks);
+    return rwinterp_call(dcontext, pc, NULL);
+}
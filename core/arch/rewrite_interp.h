@@ -0,0 +1,53 @@
+/**
+ * @file rewrite_interp.h
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * rewrite_interp.h -- clean-call reference interpreter for cold AVX-512 instrs
+ */
+
+#ifndef _REWRITE_INTERP_H_
+#define _REWRITE_INTERP_H_
+
+#include "../globals.h"
+#include "instr.h"
+
+/**
+ * @brief Build the opcode table and, under -avx512_tier_threshold, the site table.
+ */
+void
+rewrite_interp_init(void);
+
+/**
+ * @brief Free the site table.
+ */
+void
+rewrite_interp_exit(void);
+
+/**
+ * @brief Whether the interpreter implements `instr`.
+ */
+bool
+rewrite_interp_supports(instr_t *instr);
+
+/**
+ * @brief Pick the tier the AVX-512 `instr` at `pc` starts on.
+ *
+ * Returns the clean call that interprets it when the instr has no lowering, or
+ * when -avx512_tier_threshold is set and its site has not run that many times
+ * yet; the caller then drops `instr` and inserts the call in its place.  Returns
+ * NULL when the instr is to be lowered inline.
+ */
+instr_t *
+rewrite_interp_tier0(dcontext_t *dcontext, instr_t *instr, app_pc pc, bool has_lowering);
+
+/**
+ * @brief The clean call that interprets the instr at `pc`, for a lowering that failed.
+ */
+instr_t *
+rewrite_interp_fallback(dcontext_t *dcontext, app_pc pc);
+
+#endif /* _REWRITE_INTERP_H_ */
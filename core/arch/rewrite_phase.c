@@ -0,0 +1,167 @@
+/**
+ * @file rewrite_phase.c
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * rewrite_phase.c -- send the process native once its AVX-512 phase is over
+ *
+ * Many apps only run AVX-512 code in a few phases, e.g. a compute kernel between
+ * long stretches of I/O, yet pay for DR on every instr once it is attached.  Under
+ * -avx512_detach_quiet_ms every block holding a rewritten instr starts with a store
+ * of 1 to the thread's TLS_AVX512_ACTIVE_SLOT; a plain store, so that it needs
+ * neither a scratch reg nor the flags.  d_r_dispatch() polls
+ * rewrite_phase_is_quiet(), which every so often reads and clears the mark of every
+ * thread.  Once no thread has set it for the quiet period, the polling thread
+ * sends every thread native the way dr_app_stop() does, flushes the whole code
+ * cache along with the executable areas backing it, and arms the
+ * -avx512_lazy_takeover SIGILL trap so that the next AVX-512 instr takes over the
+ * process again.  Whatever the app maps, unmaps or patches while native is thus
+ * never run from a stale fragment: the re-attach rescans the maps and the module
+ * list, and re-reads the app's signal actions, as the first takeover does.
+ *
+ * The trap only fires on hardware without AVX-512, and is only armed when the app
+ * has left SIGILL at its default action.  The trap stays held until the detaching
+ * thread itself has left the code cache, so a re-attach never overlaps the detach.
+ */
+
+#include "rewrite_phase.h"
+#include "rewrite_utils.h"
+#include "../synch.h"
+#include "../fragment.h"
+#include "../vmareas.h"
+#include "dr_ir_utils.h"
+#include "instr_create_shared.h"
+#include "instrlist.h"
+
+#include <stddef.h> /* for offsetof */
+
+/* d_r_dispatch() calls between two reads of the clock */
+#define PHASE_DISPATCH_STRIDE 256
+
+/* Last time a thread was seen with its mark set, or 0 to restart the period. */
+static uint64 phase_active_time;
+static uint64 phase_last_check;
+static uint phase_dispatch_count;
+/* Held by the thread reading the marks, and from a detach until it completes. */
+static volatile int phase_busy;
+static dcontext_t *phase_detacher;
+
+void
+rewrite_phase_init(void)
+{
+    if (DYNAMO_OPTION(avx512_detach_quiet_ms) == 0)
+        return;
+    phase_active_time = query_time_millis();
+}
+
+void
+rewrite_phase_mark_bb(dcontext_t *dcontext, instrlist_t *ilist)
+{
+    instrlist_meta_preinsert(
+        ilist, instrlist_first(ilist),
+        INSTR_CREATE_mov_st(
+            dcontext,
+            opnd_create_sized_tls_slot(os_tls_offset(TLS_AVX512_ACTIVE_SLOT), OPSZ_4),
+            OPND_CREATE_INT32(1)));
+}
+
+/* Reads and clears the mark of every thread, returning whether any was set. */
+static bool
+phase_collect_marks(dcontext_t *dcontext)
+{
+    thread_record_t **threads;
+    int num_threads, i;
+    bool active = false;
+    /* the thread list can't be taken while couldbelinking, else a flush deadlocks */
+    bool waslinking = is_couldbelinking(dcontext);
+    if (waslinking)
+        enter_nolinking(dcontext, NULL, false);
+    d_r_mutex_lock(&thread_initexit_lock);
+    get_list_of_threads(&threads, &num_threads);
+    for (i = 0; i < num_threads; i++) {
+        dcontext_t *dc = threads[i]->dcontext;
+        if (dc == NULL || dc->local_state == NULL)
+            continue;
+        if (dc->local_state->spill_space.avx512_active != 0) {
+            dc->local_state->spill_space.avx512_active = 0;
+            active = true;
+        }
+    }
+    d_r_mutex_unlock(&thread_initexit_lock);
+    global_heap_free(threads,
+                     num_threads * sizeof(thread_record_t *) HEAPACCT(ACCT_THREAD_MGT));
+    if (waslinking)
+        enter_couldbelinking(dcontext, NULL, false);
+    return active;
+}
+
+bool
+rewrite_phase_is_quiet(dcontext_t *dcontext)
+{
+    uint quiet_ms = DYNAMO_OPTION(avx512_detach_quiet_ms);
+    uint64 now;
+    bool quiet;
+    if (quiet_ms == 0)
+        return false;
+    /* Racy on purpose: the count only throttles the clock reads. */
+    if (++phase_dispatch_count % PHASE_DISPATCH_STRIDE != 0 || phase_busy != 0)
+        return false;
+    now = query_time_millis();
+    if (now - phase_last_check < MAX(quiet_ms / 8, 1))
+        return false;
+    if (!atomic_compare_exchange_int(&phase_busy, 0, 1))
+        return false;
+    phase_last_check = now;
+    if (phase_collect_marks(dcontext) || phase_active_time == 0)
+        phase_active_time = now;
+    quiet = now - phase_active_time >= quiet_ms && !dynamo_exited &&
+        !IS_CLIENT_THREAD(dcontext) && signal_lazy_takeover_possible(dcontext);
+    if (!quiet)
+        ATOMIC_4BYTE_WRITE(&phase_busy, 0, false);
+    return quiet;
+}
+
+void
+rewrite_phase_detach(dcontext_t *dcontext)
+{
+    bool waslinking;
+    ASSERT(phase_busy != 0);
+#ifdef DEBUG
+    REWRITE_INFO(STD_OUTF, "no AVX-512 code for %ums: sending all threads native\n",
+                 DYNAMO_OPTION(avx512_detach_quiet_ms));
+#endif
+    RSTATS_INC(avx512_phase_detaches);
+    phase_detacher = dcontext;
+    /* Threads created while native are taken over by the SIGILL trap through
+     * dynamo_start(), which expects the dr_app_start() flavor of attach.
+     */
+    dr_api_entry = true;
+    signal_lazy_takeover_rearm();
+    send_all_other_threads_native();
+    /* The other threads are back in d_r_dispatch() or at a syscall, and leave the
+     * cache for good: drop every fragment and executable area, so that the
+     * re-attach starts from what is mapped then.
+     */
+    waslinking = is_couldbelinking(dcontext);
+    if (waslinking)
+        enter_nolinking(dcontext, NULL, false);
+    flush_fragments_and_remove_region(dcontext, UNIVERSAL_REGION_BASE,
+                                      UNIVERSAL_REGION_SIZE, false /*don't own lock*/,
+                                      true /*free futures*/);
+    if (waslinking)
+        enter_couldbelinking(dcontext, NULL, false);
+}
+
+void
+rewrite_phase_detached(dcontext_t *dcontext)
+{
+    if (phase_detacher != dcontext || dcontext == NULL)
+        return;
+    phase_detacher = NULL;
+    phase_active_time = 0;
+    ATOMIC_4BYTE_WRITE(&phase_busy, 0, false);
+    signal_lazy_takeover_release();
+}
@@ -0,0 +1,58 @@
+/**
+ * @file rewrite_phase.h
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * rewrite_phase.h -- send the process native once its AVX-512 phase is over
+ */
+
+#ifndef _REWRITE_PHASE_H_
+#define _REWRITE_PHASE_H_
+
+#include "../globals.h"
+#include "instr.h"
+
+/**
+ * @brief Start the quiet-period clock for -avx512_detach_quiet_ms.
+ */
+void
+rewrite_phase_init(void);
+
+/**
+ * @brief Prepend to a block holding rewritten instrs the store that marks its
+ *        thread as running AVX-512 code.
+ */
+void
+rewrite_phase_mark_bb(dcontext_t *dcontext, instrlist_t *ilist);
+
+/**
+ * @brief Called from d_r_dispatch: returns whether no rewritten block has run in
+ *        any thread for -avx512_detach_quiet_ms.
+ *
+ * Cheap on most calls; only every so often does it read and clear the per-thread
+ * marks. Once it returns true, the caller must call rewrite_phase_detach().
+ */
+bool
+rewrite_phase_is_quiet(dcontext_t *dcontext);
+
+/**
+ * @brief Send every other thread native, flush the code cache and arm the SIGILL
+ *        trap that re-attaches on the next AVX-512 instr. The caller then goes
+ *        native itself.
+ */
+void
+rewrite_phase_detach(dcontext_t *dcontext);
+
+/**
+ * @brief Called once `dcontext` has left the code cache at a stopping point.
+ *
+ * When it is the thread that started the detach, lets threads held in the SIGILL
+ * trap take over the process again.
+ */
+void
+rewrite_phase_detached(dcontext_t *dcontext);
+
+#endif /* _REWRITE_PHASE_H_ */
@@ -0,0 +1,363 @@
+/**
+ * @file rewrite_template.c
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * rewrite_template.c -- per-thread cache of lowered AVX-512 chains keyed by instr shape
+ *
+ * A rewrite function builds its chain from scratch through dozens of instr and
+ * operand constructors, although the same app instr shape, down to the registers
+ * and the mask, turns up again and again within a program.  Under
+ * -avx512_template_cache each thread keeps the encoded chain of every shape it has
+ * lowered, and a block builder that meets the shape again decodes the chain rather
+ * than lowering the instr.
+ *
+ * The shape of an instr is its encoding with the displacement of its memory
+ * operand zeroed, so that, say, every vaddps 0x40(%rdi),%zmm1,%zmm2{%k1} in a loop
+ * nest shares one template whatever the offset.  A chain is only recorded if the
+ * app displacement shows up nowhere but in memory operands on the app base and
+ * index, which are then rebased by the difference between the two displacements
+ * on replay.  A template is thus exactly what the rewrite function would have built,
+ * which keeps the fault translation of a rebuilt block in step with its fragment.
+ *
+ * Chains are encoded as in the rewrite cache, one record per instr, and are only
+ * taken when they hold no labels, ctis or rip-relative and absolute operands.
+ */
+
+#include "rewrite_template.h"
+#include "rewrite_utils.h"
+#include "decode.h"
+#include "instr_api.h"
+#include "opnd_api.h"
+
+#define RWTEMPLATE_BUCKETS 1024 /* power of 2 */
+/* per thread, templates beyond it are not recorded */
+#define RWTEMPLATE_MAX_BYTES (256 * 1024)
+/* a record is [len][flags][len encoded bytes] */
+#define RWTEMPLATE_RECORD_HEADER 2
+#define RWTEMPLATE_INSTR_META 0x1
+
+typedef struct _rwtemplate_entry_t {
+    struct _rwtemplate_entry_t *next;
+    uint hash;
+    uint shape_len;
+    uint size;     /* of the whole allocation */
+    int disp;      /* the app displacement the chain was lowered for */
+    byte *records; /* follow the shape */
+    byte *end;
+    byte shape[];
+} rwtemplate_entry_t;
+
+typedef struct _rwtemplate_table_t {
+    rwtemplate_entry_t *buckets[RWTEMPLATE_BUCKETS];
+    uint bytes;
+} rwtemplate_table_t;
+
+void
+rewrite_template_thread_init(dcontext_t *dcontext)
+{
+    rwtemplate_table_t *table = NULL;
+    if (DYNAMO_OPTION(avx512_template_cache)) {
+        table = HEAP_TYPE_ALLOC(dcontext, rwtemplate_table_t, ACCT_OTHER, PROTECTED);
+        memset(table, 0, sizeof(*table));
+    }
+    dcontext->avx512_template_field = table;
+}
+
+void
+rewrite_template_thread_exit(dcontext_t *dcontext)
+{
+    rwtemplate_table_t *table = (rwtemplate_table_t *)dcontext->avx512_template_field;
+    if (table == NULL)
+        return;
+    for (uint i = 0; i < RWTEMPLATE_BUCKETS; i++) {
+        rwtemplate_entry_t *entry = table->buckets[i];
+        while (entry != NULL) {
+            rwtemplate_entry_t *next = entry->next;
+            HEAP_ARRAY_FREE(dcontext, (byte *)entry, byte, entry->size, ACCT_OTHER, PROTECTED);
+            entry = next;
+        }
+    }
+    HEAP_TYPE_FREE(dcontext, table, rwtemplate_table_t, ACCT_OTHER, PROTECTED);
+    dcontext->avx512_template_field = NULL;
+}
+
+static opnd_t
+rwtemplate_opnd(instr_t *instr, int i)
+{
+    return i < instr_num_srcs(instr) ? instr_get_src(instr, i) : instr_get_dst(instr, i - instr_num_srcs(instr));
+}
+
+static void
+rwtemplate_set_opnd(instr_t *instr, int i, opnd_t opnd)
+{
+    if (i < instr_num_srcs(instr))
+        instr_set_src(instr, i, opnd);
+    else
+        instr_set_dst(instr, i - instr_num_srcs(instr), opnd);
+}
+
+/* whether a chain memory operand is the app one, possibly at another displacement */
+static bool
+rwtemplate_opnd_is_app(rewrite_template_key_t *key, opnd_t opnd)
+{
+    return opnd_is_base_disp(opnd) && opnd_get_segment(opnd) == DR_REG_NULL && opnd_get_base(opnd) == key->base &&
+        opnd_get_index(opnd) == key->index;
+}
+
+/* ======================================== *
+ *    shapes
+ * ======================================== */
+
+static uint
+rwtemplate_hash(byte *code, uint len)
+{
+    uint hash = 2166136261u; /* FNV-1a */
+    for (uint i = 0; i < len; i++)
+        hash = (hash ^ code[i]) * 16777619u;
+    return hash;
+}
+
+/* fills in key, with shape_len 0 if the instr cannot be templated */
+static void
+rwtemplate_shape(dcontext_t *dcontext, instr_t *instr, rewrite_template_key_t *key)
+{
+    instr_t *zeroed;
+    byte *end;
+    int num_opnds = instr_num_srcs(instr) + instr_num_dsts(instr);
+    key->shape_len = 0;
+    key->has_mem = false;
+    key->base = key->index = DR_REG_NULL;
+    key->disp = 0;
+    if (!instr_raw_bits_valid(instr) || !instr_operands_valid(instr) ||
+        instr_length(dcontext, instr) > MAX_INSTR_LENGTH)
+        return;
+    for (int i = 0; i < num_opnds; i++) {
+        opnd_t opnd = rwtemplate_opnd(instr, i);
+        if (opnd_is_pc(opnd) || opnd_is_instr(opnd) || opnd_is_rel_addr(opnd) || opnd_is_abs_addr(opnd))
+            return;
+        if (!opnd_is_base_disp(opnd))
+            continue;
+        // the stack and vsib forms cannot be told apart from the chain's own operands
+        if (opnd_get_segment(opnd) != DR_REG_NULL || opnd_get_base(opnd) == DR_REG_NULL ||
+            reg_to_pointer_sized(opnd_get_base(opnd)) == DR_REG_XSP ||
+            (opnd_get_index(opnd) != DR_REG_NULL && !reg_is_gpr(opnd_get_index(opnd))))
+            return;
+        if (key->has_mem &&
+            (opnd_get_base(opnd) != key->base || opnd_get_index(opnd) != key->index ||
+             opnd_get_disp(opnd) != key->disp))
+            return;
+        key->has_mem = true;
+        key->base = opnd_get_base(opnd);
+        key->index = opnd_get_index(opnd);
+        key->disp = opnd_get_disp(opnd);
+    }
+    if (!key->has_mem || key->disp == 0) {
+        key->shape_len = instr_length(dcontext, instr);
+        memcpy(key->shape, instr_get_raw_bits(instr), key->shape_len);
+    } else {
+        zeroed = instr_clone(dcontext, instr);
+        for (int i = 0; i < num_opnds; i++) {
+            opnd_t opnd = rwtemplate_opnd(zeroed, i);
+            if (opnd_is_base_disp(opnd)) {
+                opnd_set_disp(&opnd, 0);
+                rwtemplate_set_opnd(zeroed, i, opnd);
+            }
+        }
+        end = instr_encode_to_copy(dcontext, zeroed, key->shape, key->shape);
+        instr_destroy(dcontext, zeroed);
+        if (end == NULL)
+            return;
+        key->shape_len = (uint)(end - key->shape);
+    }
+    key->hash = rwtemplate_hash(key->shape, key->shape_len);
+}
+
+/* ======================================== *
+ *    chain encoding
+ * ======================================== */
+
+/* Encodes one instr of a lowered chain as a record into buf, which holds at least
+ * RWTEMPLATE_RECORD_HEADER + MAX_INSTR_LENGTH bytes. Returns the record length, 0 if
+ * the instr cannot be part of a template. Counts the app memory operands into patched.
+ */
+static uint
+rwtemplate_encode_instr(dcontext_t *dcontext, rewrite_template_key_t *key, instr_t *instr, byte *buf,
+                        uint *patched)
+{
+    byte *next_pc;
+    if (instr_is_label(instr) || instr_is_cti(instr) || !instr_operands_valid(instr))
+        return 0;
+    for (int i = 0; i < instr_num_srcs(instr) + instr_num_dsts(instr); i++) {
+        opnd_t opnd = rwtemplate_opnd(instr, i);
+        if (opnd_is_pc(opnd) || opnd_is_instr(opnd) || opnd_is_rel_addr(opnd) || opnd_is_near_abs_addr(opnd))
+            return 0;
+        if (!key->has_mem)
+            continue;
+        // the displacement must not have been folded into an immediate
+        if (opnd_is_immed_int(opnd) && opnd_get_immed_int(opnd) == key->disp)
+            return 0;
+        if (rwtemplate_opnd_is_app(key, opnd)) {
+            (*patched)++;
+            continue;
+        }
+        // nor into an address on the app base or index computed otherwise
+        if (opnd_is_base_disp(opnd) && opnd_get_segment(opnd) == DR_REG_NULL &&
+            (opnd_get_base(opnd) == key->base || (key->index != DR_REG_NULL && opnd_get_index(opnd) == key->index)))
+            return 0;
+    }
+    next_pc = instr_encode_to_copy(dcontext, instr, buf + RWTEMPLATE_RECORD_HEADER, buf + RWTEMPLATE_RECORD_HEADER);
+    if (next_pc == NULL)
+        return 0;
+    buf[0] = (byte)(next_pc - (buf + RWTEMPLATE_RECORD_HEADER));
+    buf[1] = (byte)(instr_is_meta(instr) ? RWTEMPLATE_INSTR_META : 0);
+    return RWTEMPLATE_RECORD_HEADER + buf[0];
+}
+
+static void
+rwtemplate_chain_destroy(dcontext_t *dcontext, instr_t *first)
+{
+    while (first != NULL) {
+        instr_t *next = instr_get_next(first);
+        instr_destroy(dcontext, first);
+        first = next;
+    }
+}
+
+/* rebases the app memory operands of instr by delta, false if a displacement overflows */
+static bool
+rwtemplate_patch_instr(rewrite_template_key_t *key, instr_t *instr, int64 delta)
+{
+    for (int i = 0; i < instr_num_srcs(instr) + instr_num_dsts(instr); i++) {
+        opnd_t opnd = rwtemplate_opnd(instr, i);
+        int64 disp;
+        if (!rwtemplate_opnd_is_app(key, opnd))
+            continue;
+        disp = (int64)opnd_get_disp(opnd) + delta;
+        if (disp != (int)disp)
+            return false;
+        opnd_set_disp(&opnd, (int)disp);
+        rwtemplate_set_opnd(instr, i, opnd);
+    }
+    return true;
+}
+
+/* decodes the records of entry into a fresh chain for key, NULL if any fails */
+static instr_t *
+rwtemplate_decode_chain(dcontext_t *dcontext, rwtemplate_entry_t *entry, rewrite_template_key_t *key)
+{
+    instr_t *first = NULL, *last = NULL;
+    int64 delta = (int64)key->disp - entry->disp;
+    byte *rec = entry->records;
+    while (rec < entry->end) {
+        byte *code = rec + RWTEMPLATE_RECORD_HEADER;
+        instr_t *instr = instr_create(dcontext);
+        if (decode_from_copy(dcontext, code, code, instr) != code + rec[0]) {
+            instr_destroy(dcontext, instr);
+            rwtemplate_chain_destroy(dcontext, first);
+            return NULL;
+        }
+        // the bytes belong to the template, have the chain re-encoded from its operands
+        instr_set_raw_bits_valid(instr, false);
+        if (TEST(RWTEMPLATE_INSTR_META, rec[1]))
+            instr_set_meta(instr);
+        if (first == NULL)
+            first = instr;
+        else
+            instr_concat_next(last, instr);
+        last = instr;
+        if (delta != 0 && !rwtemplate_patch_instr(key, instr, delta)) {
+            rwtemplate_chain_destroy(dcontext, first);
+            return NULL;
+        }
+        rec = code + rec[0];
+    }
+    return first;
+}
+
+/* ======================================== *
+ *    interface
+ * ======================================== */
+
+instr_t *
+rewrite_template_lookup(dcontext_t *dcontext, instr_t *instr, rewrite_template_key_t *key)
+{
+    rwtemplate_table_t *table = (rwtemplate_table_t *)dcontext->avx512_template_field;
+    rwtemplate_entry_t *entry;
+    instr_t *first;
+    key->shape_len = 0;
+    if (table == NULL)
+        return NULL;
+    rwtemplate_shape(dcontext, instr, key);
+    if (key->shape_len == 0)
+        return NULL;
+    for (entry = table->buckets[key->hash & (RWTEMPLATE_BUCKETS - 1)]; entry != NULL; entry = entry->next) {
+        if (entry->hash == key->hash && entry->shape_len == key->shape_len &&
+            memcmp(entry->shape, key->shape, key->shape_len) == 0)
+            break;
+    }
+    first = entry == NULL ? NULL : rwtemplate_decode_chain(dcontext, entry, key);
+    if (first != NULL)
+        STATS_INC(avx512_template_hits);
+    else
+        STATS_INC(avx512_template_misses);
+    return first;
+}
+
+void
+rewrite_template_add(dcontext_t *dcontext, rewrite_template_key_t *key, instr_t *first)
+{
+    byte buf[RWTEMPLATE_RECORD_HEADER + MAX_INSTR_LENGTH];
+    rwtemplate_table_t *table = (rwtemplate_table_t *)dcontext->avx512_template_field;
+    rwtemplate_entry_t *entry, **bucket;
+    uint records_len = 0, patched = 0, size;
+    byte *pos;
+    // a zero displacement cannot be told apart from the chain's own offsets
+    if (table == NULL || key->shape_len == 0 || first == NULL || (key->has_mem && key->disp == 0))
+        return;
+    bucket = &table->buckets[key->hash & (RWTEMPLATE_BUCKETS - 1)];
+    for (entry = *bucket; entry != NULL; entry = entry->next) {
+        if (entry->hash == key->hash && entry->shape_len == key->shape_len &&
+            memcmp(entry->shape, key->shape, key->shape_len) == 0)
+            return;
+    }
+    // size the records first, bailing out on anything that cannot be replayed
+    for (instr_t *instr = first; instr != NULL; instr = instr_get_next(instr)) {
+        uint len = rwtemplate_encode_instr(dcontext, key, instr, buf, &patched);
+        if (len == 0) {
+            STATS_INC(avx512_template_uncacheable);
+            return;
+        }
+        records_len += len;
+    }
+    // the displacement went somewhere it cannot be patched in
+    if (key->has_mem && patched == 0) {
+        STATS_INC(avx512_template_uncacheable);
+        return;
+    }
+    size = (uint)sizeof(*entry) + key->shape_len + records_len;
+    if (table->bytes + size > RWTEMPLATE_MAX_BYTES) {
+        STATS_INC(avx512_template_full);
+        return;
+    }
+    entry = (rwtemplate_entry_t *)HEAP_ARRAY_ALLOC(dcontext, byte, size, ACCT_OTHER, PROTECTED);
+    entry->hash = key->hash;
+    entry->shape_len = key->shape_len;
+    entry->size = size;
+    entry->disp = key->disp;
+    memcpy(entry->shape, key->shape, key->shape_len);
+    entry->records = entry->shape + key->shape_len;
+    pos = entry->records;
+    for (instr_t *instr = first; instr != NULL; instr = instr_get_next(instr)) {
+        uint len = rwtemplate_encode_instr(dcontext, key, instr, pos, &patched);
+        pos += len;
+    }
+    entry->end = pos;
+    entry->next = *bucket;
+    *bucket = entry;
+    table->bytes += size;
+    STATS_INC(avx512_template_entries);
+}
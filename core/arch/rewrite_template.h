@@ -0,0 +1,64 @@
+/**
+ * @file rewrite_template.h
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * rewrite_template.h -- per-thread cache of lowered AVX-512 chains keyed by instr shape
+ */
+
+#ifndef _REWRITE_TEMPLATE_H_
+#define _REWRITE_TEMPLATE_H_
+
+#include "../globals.h"
+#include "instr.h"
+
+/**
+ * @brief The shape of one app AVX-512 instr: its encoding with the displacement
+ * zeroed, and the memory operand the displacement is patched back into.
+ * Filled in by rewrite_template_lookup() before the rewrite function destroys the
+ * app instr, and handed back to rewrite_template_add() with its lowered chain.
+ * shape_len is 0 when the instr cannot be templated.
+ */
+typedef struct _rewrite_template_key_t {
+    uint hash;
+    uint shape_len;
+    bool has_mem;
+    reg_id_t base;
+    reg_id_t index;
+    int disp;
+    byte shape[MAX_INSTR_LENGTH];
+} rewrite_template_key_t;
+
+/**
+ * @brief Allocate the template table of a new thread under -avx512_template_cache.
+ */
+void
+rewrite_template_thread_init(dcontext_t *dcontext);
+
+/**
+ * @brief Free the template table of an exiting thread.
+ */
+void
+rewrite_template_thread_exit(dcontext_t *dcontext);
+
+/**
+ * @brief Look up the lowered chain for the shape of the AVX-512 `instr`.
+ * Fills in `key` either way. On a hit returns a freshly decoded chain, rebased on
+ * the displacement of `instr`, that the caller inserts in its place; returns NULL
+ * on a miss or when the instr cannot be templated.
+ */
+instr_t *
+rewrite_template_lookup(dcontext_t *dcontext, instr_t *instr, rewrite_template_key_t *key);
+
+/**
+ * @brief Record the chain produced by a rewrite function for the shape in `key`.
+ * Chains holding labels, ctis or absolute addresses, or using the app displacement
+ * anywhere but in memory operands on the app base and index, are skipped.
+ */
+void
+rewrite_template_add(dcontext_t *dcontext, rewrite_template_key_t *key, instr_t *first);
+
+#endif /* _REWRITE_TEMPLATE_H_ */
@@ -715,6 +715,20 @@ print_rewrite_variadic_instr(dcontext_t *dcontext, int count, ...)
     va_end(args);
 }
 
+void
+print_rewrite_instr_chain(dcontext_t *dcontext, instr_t *first)
+{
+    REWRITE_DEBUG(STD_OUTF, "==== INSTRUCTION SEQUENCE ====");
+
+    for (instr_t *instr = first; instr != NULL; instr = instr_get_next(instr)) {
+        instr_disassemble(dcontext, instr, STD_OUTF);
+        NEWLINE(STD_OUTF);
+    }
+
+    REWRITE_DEBUG(STD_OUTF, "==============================");
+    NEWLINE(STD_OUTF);
+}
+
 void
 print_zmm_in_dcontext(dcontext_t *dcontext)
 {
@@ -838,3 +852,611 @@ is_avx512_zero_mask(instr_t *instr)
     return TEST(0x000800000, prefixes);
 }
 
+
+/* ======================================== *
+ *    half-wise avx2 lowering helpers
+ * ======================================== */
+
+/* per-lane bit selectors used to expand an opmask into a vector lane mask */
+static const byte lower_k_bit_bytes[32] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+};
+static const ushort lower_k_bit_words[16] = { 0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080,
+                                              0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, 0x8000 };
+static const uint lower_k_bit_dwords[8] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
+static const uint64 lower_k_bit_qwords[8] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
+/* vpshufb is in-lane: lane 0 takes opmask bytes 0,1 and lane 1 takes bytes 2,3 */
+static const byte lower_k_byte_shuf[32] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                                            2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3 };
+
+static inline bool
+lower_reg_is_physical(lower_ctx_t *ctx, uint idx, uint half)
+{
+    return half == LOWER_HALF_LOW && idx < YMM_REG_NUM && !TEST(1 << idx, ctx->ymm_parked);
+}
+
+static inline uint
+lower_simd_reg_index(reg_id_t reg)
+{
+    if (IS_ZMM_REG(reg))
+        return TO_ZMM_REG_INDEX(reg);
+    if (IS_YMM_REG(reg))
+        return TO_YMM_REG_INDEX(reg);
+    return TO_XMM_REG_INDEX(reg);
+}
+
+static inline opnd_size_t
+lower_half_size(lower_ctx_t *ctx)
+{
+    return ctx->is_xmm ? OPSZ_16 : OPSZ_32;
+}
+
+static opnd_t
+lower_mem_opnd_at(opnd_t mem, int offs, opnd_size_t size)
+{
+    if (opnd_is_rel_addr(mem))
+        return opnd_create_rel_addr((byte *)opnd_get_addr(mem) + offs, size);
+    if (opnd_is_base_disp(mem)) {
+        opnd_t res = mem;
+        opnd_set_disp(&res, opnd_get_disp(mem) + offs);
+        opnd_set_size(&res, size);
+        return res;
+    }
+    return opnd_create_abs_addr((byte *)opnd_get_addr(mem) + offs, size);
+}
+
+opnd_t
+lower_half_mem_opnd(opnd_t mem, uint half, opnd_size_t size)
+{
+    return lower_mem_opnd_at(mem, half * SIZE_OF_YMM, size);
+}
+
+void
+lower_ctx_init(lower_ctx_t *ctx, dcontext_t *dcontext, instr_t *instr)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->dcontext = dcontext;
+    ctx->dst_reg = opnd_is_reg(instr_get_dst(instr, 0)) ? opnd_get_reg(instr_get_dst(instr, 0)) : DR_REG_NULL;
+    ctx->mask_reg = DR_REG_NULL;
+    if (instr_num_srcs(instr) > 0 && opnd_is_reg(instr_get_src(instr, 0)) &&
+        IS_MASK_REG(opnd_get_reg(instr_get_src(instr, 0))) && opnd_get_reg(instr_get_src(instr, 0)) != DR_REG_K0)
+        ctx->mask_reg = opnd_get_reg(instr_get_src(instr, 0));
+    ctx->zero_mask = TEST(AVX512_PREFIX_EVEX_Z, instr_get_prefixes(instr));
+    ctx->is_bcst = TEST(AVX512_PREFIX_EVEX_B, instr_get_prefixes(instr)) && instr_reads_memory(instr);
+    ctx->is_xmm = IS_XMM_REG(ctx->dst_reg);
+    ctx->num_halves = IS_ZMM_REG(ctx->dst_reg) ? 2 : 1;
+}
+
+void
+lower_ctx_emit(lower_ctx_t *ctx, instr_t *instr)
+{
+    if (ctx->first == NULL)
+        ctx->first = instr;
+    else
+        instr_concat_next(ctx->last, instr);
+    ctx->last = instr;
+    ctx->num_instr++;
+}
+
+reg_id_t
+lower_ctx_get_scratch(lower_ctx_t *ctx)
+{
+    for (uint i = 0; i < LOWER_MAX_SCRATCH; i++) {
+        if (TEST(1 << i, ctx->scratch_used))
+            continue;
+        reg_id_t ymm = YMM_SPILL_SLOT0 + i;
+        uint idx = TO_YMM_REG_INDEX(ymm);
+        ctx->scratch_used |= 1 << i;
+        // ymm_scratch -> tls(ymm_scratch), the slot now holds the app value
+        lower_ctx_emit(ctx, SAVE_SIMD_TO_SIZED_TLS(ctx->dcontext, ymm, TLS_ZMM_idx_SLOT(idx), OPSZ_32));
+        ctx->ymm_parked |= 1 << idx;
+        return ctx->is_xmm ? YMM_TO_XMM(ymm) : ymm;
+    }
+    REWRITE_ERROR(STD_ERRF, "lower_ctx_get_scratch: all %d scratch registers in use", LOWER_MAX_SCRATCH);
+    return DR_REG_NULL;
+}
+
+static const reg_id_t lower_gprs[LOWER_MAX_GPR] = { DR_REG_RAX, DR_REG_RBX, DR_REG_RCX, DR_REG_RDX };
+static const ushort lower_gpr_slots[LOWER_MAX_GPR] = { TLS_XAX_SLOT, TLS_XBX_SLOT, TLS_XCX_SLOT, TLS_XDX_SLOT };
+
+reg_id_t
+lower_ctx_get_gpr(lower_ctx_t *ctx, opnd_t avoid)
+{
+    for (uint i = 0; i < LOWER_MAX_GPR; i++) {
+        if (TEST(1 << i, ctx->gpr_used) || (!opnd_is_null(avoid) && opnd_uses_reg(avoid, lower_gprs[i])))
+            continue;
+        ctx->gpr_used |= 1 << i;
+        // gpr -> tls(gpr), a mangled app operand spilling the same gpr keeps its own slot
+        lower_ctx_emit(ctx, SAVE_TO_TLS(ctx->dcontext, lower_gprs[i], lower_gpr_slots[i]));
+        return lower_gprs[i];
+    }
+    REWRITE_ERROR(STD_ERRF, "lower_ctx_get_gpr: all %d scratch gprs in use", LOWER_MAX_GPR);
+    return DR_REG_NULL;
+}
+
+void
+lower_ctx_load_half(lower_ctx_t *ctx, reg_id_t scratch, opnd_t src, uint half)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    opnd_size_t size = lower_half_size(ctx);
+    if (opnd_is_memory_reference(src)) {
+        if (ctx->is_bcst) {
+            // the broadcast element is the whole memory operand
+            if (opnd_get_size(src) == OPSZ_8)
+                lower_ctx_emit(ctx, INSTR_CREATE_vpbroadcastq(dcontext, opnd_create_reg(scratch), src));
+            else if (opnd_get_size(src) == OPSZ_2)
+                lower_ctx_emit(ctx, INSTR_CREATE_vpbroadcastw(dcontext, opnd_create_reg(scratch), src));
+            else
+                lower_ctx_emit(ctx, INSTR_CREATE_vpbroadcastd(dcontext, opnd_create_reg(scratch), src));
+        } else {
+            lower_ctx_emit(
+                ctx, INSTR_CREATE_vmovdqu(dcontext, opnd_create_reg(scratch), lower_half_mem_opnd(src, half, size)));
+        }
+        return;
+    }
+    reg_id_t src_reg = opnd_get_reg(src);
+    uint idx = lower_simd_reg_index(src_reg);
+    if (lower_reg_is_physical(ctx, idx, half)) {
+        reg_id_t phys = ctx->is_xmm ? TO_XMM_REG_ID_NUM(idx) : TO_YMM_REG_ID_NUM(idx);
+        if (phys != scratch)
+            lower_ctx_emit(ctx, INSTR_CREATE_vmovdqu(dcontext, opnd_create_reg(scratch), opnd_create_reg(phys)));
+        return;
+    }
+    // tls(src_reg, half) -> scratch
+    lower_ctx_emit(ctx,
+                   RESTORE_SIMD_FROM_SIZED_TLS(dcontext, scratch, TLS_ZMM_idx_SLOT(idx) + half * SIZE_OF_YMM, size));
+}
+
+void
+lower_ctx_load_xmm(lower_ctx_t *ctx, reg_id_t scratch, opnd_t src)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    if (opnd_is_memory_reference(src)) {
+        opnd_t mem = src;
+        opnd_set_size(&mem, OPSZ_16);
+        lower_ctx_emit(ctx, INSTR_CREATE_vmovdqu(dcontext, opnd_create_reg(scratch), mem));
+        return;
+    }
+    uint idx = lower_simd_reg_index(opnd_get_reg(src));
+    if (lower_reg_is_physical(ctx, idx, LOWER_HALF_LOW)) {
+        if (TO_XMM_REG_ID_NUM(idx) != scratch) {
+            lower_ctx_emit(ctx, INSTR_CREATE_vmovdqu(dcontext, opnd_create_reg(scratch),
+                                                     opnd_create_reg(TO_XMM_REG_ID_NUM(idx))));
+        }
+        return;
+    }
+    lower_ctx_emit(ctx, RESTORE_SIMD_FROM_SIZED_TLS(dcontext, scratch, TLS_ZMM_idx_SLOT(idx), OPSZ_16));
+}
+
+reg_id_t
+lower_ctx_src_half(lower_ctx_t *ctx, reg_id_t scratch, opnd_t src, uint half)
+{
+    if (opnd_is_memory_reference(src) && ctx->is_bcst) {
+        // every half of a broadcast is the same, load it once
+        if (ctx->bcst_reg == DR_REG_NULL) {
+            lower_ctx_load_half(ctx, scratch, src, half);
+            ctx->bcst_reg = IS_XMM_REG(scratch) ? XMM_TO_YMM(scratch) : scratch;
+        }
+        return ctx->is_xmm ? YMM_TO_XMM(ctx->bcst_reg) : ctx->bcst_reg;
+    }
+    if (opnd_is_reg(src)) {
+        uint idx = lower_simd_reg_index(opnd_get_reg(src));
+        if (lower_reg_is_physical(ctx, idx, half))
+            return ctx->is_xmm ? TO_XMM_REG_ID_NUM(idx) : TO_YMM_REG_ID_NUM(idx);
+    }
+    lower_ctx_load_half(ctx, scratch, src, half);
+    return scratch;
+}
+
+opnd_t
+lower_ctx_src_half_opnd(lower_ctx_t *ctx, reg_id_t scratch, opnd_t src, uint half)
+{
+    opnd_size_t size = lower_half_size(ctx);
+    if (opnd_is_memory_reference(src)) {
+        if (ctx->is_bcst)
+            return opnd_create_reg(lower_ctx_src_half(ctx, scratch, src, half));
+        return lower_half_mem_opnd(src, half, size);
+    }
+    uint idx = lower_simd_reg_index(opnd_get_reg(src));
+    if (lower_reg_is_physical(ctx, idx, half))
+        return opnd_create_reg(ctx->is_xmm ? TO_XMM_REG_ID_NUM(idx) : TO_YMM_REG_ID_NUM(idx));
+    return opnd_create_sized_tls_slot(os_tls_offset(TLS_ZMM_idx_SLOT(idx) + half * SIZE_OF_YMM), size);
+}
+
+bool
+lower_ctx_reg_is_live(lower_ctx_t *ctx, reg_id_t reg, uint half)
+{
+    return lower_reg_is_physical(ctx, lower_simd_reg_index(reg), half);
+}
+
+void
+lower_ctx_load_lane(lower_ctx_t *ctx, reg_id_t xmm, opnd_t src, uint lane)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    uint half = lane / 2;
+    if (opnd_is_memory_reference(src)) {
+        lower_ctx_emit(ctx, INSTR_CREATE_vmovdqu(dcontext, opnd_create_reg(xmm),
+                                                 lower_mem_opnd_at(src, lane * SIZE_OF_XMM, OPSZ_16)));
+        return;
+    }
+    uint idx = lower_simd_reg_index(opnd_get_reg(src));
+    if (lower_reg_is_physical(ctx, idx, half)) {
+        if (lane % 2 == 1) {
+            lower_ctx_emit(ctx, INSTR_CREATE_vextracti128(dcontext, opnd_create_reg(xmm),
+                                                          opnd_create_reg(TO_YMM_REG_ID_NUM(idx)),
+                                                          OPND_CREATE_INT8(1)));
+        } else if (TO_XMM_REG_ID_NUM(idx) != xmm) {
+            lower_ctx_emit(ctx, INSTR_CREATE_vmovdqu(dcontext, opnd_create_reg(xmm),
+                                                     opnd_create_reg(TO_XMM_REG_ID_NUM(idx))));
+        }
+        return;
+    }
+    // tls(src_reg, lane) -> xmm
+    lower_ctx_emit(ctx, RESTORE_SIMD_FROM_SIZED_TLS(dcontext, xmm, TLS_ZMM_idx_SLOT(idx) + lane * SIZE_OF_XMM,
+                                                    OPSZ_16));
+}
+
+void
+lower_ctx_store_half(lower_ctx_t *ctx, uint half, reg_id_t scratch)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    uint idx = lower_simd_reg_index(ctx->dst_reg);
+    if (lower_reg_is_physical(ctx, idx, half)) {
+        reg_id_t phys = ctx->is_xmm ? TO_XMM_REG_ID_NUM(idx) : TO_YMM_REG_ID_NUM(idx);
+        lower_ctx_emit(ctx, INSTR_CREATE_vmovdqu(dcontext, opnd_create_reg(phys), opnd_create_reg(scratch)));
+        return;
+    }
+    // scratch -> tls(dst_reg, half)
+    lower_ctx_emit(ctx, SAVE_SIMD_TO_SIZED_TLS(dcontext, scratch, TLS_ZMM_idx_SLOT(idx) + half * SIZE_OF_YMM,
+                                               lower_half_size(ctx)));
+}
+
+opnd_t
+lower_ctx_const_opnd(lower_ctx_t *ctx, const void *table)
+{
+    return opnd_create_rel_addr((void *)table, lower_half_size(ctx));
+}
+
+void
+lower_ctx_k_lane_mask(lower_ctx_t *ctx, reg_id_t scratch, reg_id_t k_reg, uint elem_size, uint half)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    ushort k_slot = TLS_K_idx_SLOT(TO_K_REG_INDEX(k_reg));
+    opnd_t op_scratch = opnd_create_reg(scratch);
+    const void *bits = NULL;
+    switch (elem_size) {
+    case 1: {
+        // each half covers 32 opmask bits: broadcast them, then spread byte i/8 over lane i
+        opnd_t k_opnd = opnd_create_sized_tls_slot(os_tls_offset(k_slot + half * 4), OPSZ_4);
+        lower_ctx_emit(ctx, INSTR_CREATE_vpbroadcastd(dcontext, op_scratch, k_opnd));
+        lower_ctx_emit(ctx, INSTR_CREATE_vpshufb(dcontext, op_scratch, op_scratch,
+                                                 lower_ctx_const_opnd(ctx, lower_k_byte_shuf)));
+        bits = lower_k_bit_bytes;
+        lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_scratch, op_scratch, lower_ctx_const_opnd(ctx, bits)));
+        lower_ctx_emit(ctx,
+                       INSTR_CREATE_vpcmpeqb(dcontext, op_scratch, op_scratch, lower_ctx_const_opnd(ctx, bits)));
+    } break;
+    case 2: {
+        opnd_t k_opnd = opnd_create_sized_tls_slot(os_tls_offset(k_slot + half * 2), OPSZ_2);
+        lower_ctx_emit(ctx, INSTR_CREATE_vpbroadcastw(dcontext, op_scratch, k_opnd));
+        bits = lower_k_bit_words;
+        lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_scratch, op_scratch, lower_ctx_const_opnd(ctx, bits)));
+        lower_ctx_emit(ctx,
+                       INSTR_CREATE_vpcmpeqw(dcontext, op_scratch, op_scratch, lower_ctx_const_opnd(ctx, bits)));
+    } break;
+    case 4: {
+        opnd_t k_opnd = opnd_create_sized_tls_slot(os_tls_offset(k_slot + half), OPSZ_1);
+        lower_ctx_emit(ctx, INSTR_CREATE_vpbroadcastb(dcontext, op_scratch, k_opnd));
+        bits = lower_k_bit_dwords;
+        lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_scratch, op_scratch, lower_ctx_const_opnd(ctx, bits)));
+        lower_ctx_emit(ctx,
+                       INSTR_CREATE_vpcmpeqd(dcontext, op_scratch, op_scratch, lower_ctx_const_opnd(ctx, bits)));
+    } break;
+    case 8: {
+        // a zmm has only 8 qword lanes: both halves read opmask byte 0, high half tests bits 4..7
+        opnd_t k_opnd = opnd_create_sized_tls_slot(os_tls_offset(k_slot), OPSZ_1);
+        lower_ctx_emit(ctx, INSTR_CREATE_vpbroadcastb(dcontext, op_scratch, k_opnd));
+        bits = &lower_k_bit_qwords[half * 4];
+        lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_scratch, op_scratch, lower_ctx_const_opnd(ctx, bits)));
+        lower_ctx_emit(ctx,
+                       INSTR_CREATE_vpcmpeqq(dcontext, op_scratch, op_scratch, lower_ctx_const_opnd(ctx, bits)));
+    } break;
+    default: REWRITE_ERROR(STD_ERRF, "lower_ctx_k_lane_mask: invalid element size %u", elem_size); break;
+    }
+}
+
+void
+lower_ctx_store_half_masked(lower_ctx_t *ctx, uint half, reg_id_t result, uint elem_size, reg_id_t tmp_mask,
+                            reg_id_t tmp_old)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    if (ctx->mask_reg != DR_REG_NULL) {
+        opnd_t op_result = opnd_create_reg(result);
+        lower_ctx_k_lane_mask(ctx, tmp_mask, ctx->mask_reg, elem_size, half);
+        if (ctx->zero_mask) {
+            // vpand result, result, lane_mask
+            lower_ctx_emit(ctx, INSTR_CREATE_vpand(dcontext, op_result, op_result, opnd_create_reg(tmp_mask)));
+        } else {
+            // vpblendvb result, old_dst, result, lane_mask
+            lower_ctx_load_half(ctx, tmp_old, opnd_create_reg(ctx->dst_reg), half);
+            lower_ctx_emit(ctx, INSTR_CREATE_vpblendvb(dcontext, op_result, opnd_create_reg(tmp_old), op_result,
+                                                       opnd_create_reg(tmp_mask)));
+        }
+    }
+    lower_ctx_store_half(ctx, half, result);
+}
+
+bool
+lower_binop_opnds_supported(instr_t *instr)
+{
+    return opnd_is_reg(instr_get_dst(instr, 0)) && opnd_is_reg(instr_get_src(instr, 1)) &&
+        (opnd_is_reg(instr_get_src(instr, 2)) || opnd_is_memory_reference(instr_get_src(instr, 2)));
+}
+
+uint
+lower_instr_vector_bytes(instr_t *instr)
+{
+    uint prefixes = instr_get_prefixes(instr);
+    if (TEST(AVX512_PREFIX_EVEX_ER, prefixes) || TEST(AVX512_PREFIX_EVEX_LL, prefixes))
+        return 64;
+    return TEST(AVX512_PREFIX_VEX_L, prefixes) ? 32 : 16;
+}
+
+instr_t *
+lower_binop_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, int avx2_opcode, uint elem_size)
+{
+    lower_ctx_t ctx;
+    lower_ctx_init(&ctx, dcontext, instr);
+    opnd_t a_opnd = instr_get_src(instr, 1);
+    opnd_t b_opnd = instr_get_src(instr, 2);
+    instrlist_remove(ilist, instr);
+    instr_destroy(dcontext, instr);
+
+    reg_id_t r_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t b_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t t_reg = lower_ctx_get_scratch(&ctx);
+    reg_id_t u_reg = lower_ctx_get_scratch(&ctx);
+    for (uint half = 0; half < ctx.num_halves; half++) {
+        // op r, a, b   ; a is loaded into r unless it is live in a physical reg
+        reg_id_t a = lower_ctx_src_half(&ctx, r_reg, a_opnd, half);
+        reg_id_t b = lower_ctx_src_half(&ctx, b_reg, b_opnd, half);
+        lower_ctx_emit(&ctx, instr_create_1dst_2src(dcontext, avx2_opcode, opnd_create_reg(r_reg),
+                                                    opnd_create_reg(a), opnd_create_reg(b)));
+        lower_ctx_store_half_masked(&ctx, half, r_reg, elem_size, t_reg, u_reg);
+    }
+    instr_t *first = lower_ctx_finish(&ctx);
+#ifdef DEBUG
+    print_rewrite_instr_chain(dcontext, first);
+#endif
+    return first;
+}
+
+/* An EVEX write to an xmm or ymm zeroes the dst up to bit 511: clear what the
+ * lowering left of it in TLS, i.e. the upper half and, above an xmm, bits 128-255
+ * (which a physical dst already has clear, and a parked one gets back from TLS).
+ */
+static void
+lower_ctx_zero_upper(lower_ctx_t *ctx)
+{
+    dcontext_t *dcontext = ctx->dcontext;
+    if (ctx->dst_reg == DR_REG_NULL || !reg_is_simd(ctx->dst_reg) || IS_ZMM_REG(ctx->dst_reg))
+        return;
+    uint i;
+    for (i = 0; i < LOWER_MAX_SCRATCH && !TEST(1 << i, ctx->scratch_used); i++)
+        ;
+    if (i == LOWER_MAX_SCRATCH) {
+        lower_ctx_get_scratch(ctx);
+        i = 0;
+    }
+    reg_id_t zero = YMM_SPILL_SLOT0 + i;
+    ushort slot = TLS_ZMM_idx_SLOT(lower_simd_reg_index(ctx->dst_reg));
+    lower_ctx_emit(ctx, INSTR_CREATE_vpxor(dcontext, opnd_create_reg(zero), opnd_create_reg(zero),
+                                           opnd_create_reg(zero)));
+    if (ctx->is_xmm) {
+        lower_ctx_emit(ctx, SAVE_SIMD_TO_SIZED_TLS(dcontext, YMM_TO_XMM(zero), slot + SIZE_OF_XMM, OPSZ_16));
+    }
+    lower_ctx_emit(ctx, SAVE_SIMD_TO_SIZED_TLS(dcontext, zero, slot + SIZE_OF_YMM, OPSZ_32));
+}
+
+instr_t *
+lower_ctx_finish(lower_ctx_t *ctx)
+{
+    lower_ctx_zero_upper(ctx);
+    for (uint i = 0; i < LOWER_MAX_SCRATCH; i++) {
+        if (!TEST(1 << i, ctx->scratch_used))
+            continue;
+        reg_id_t ymm = YMM_SPILL_SLOT0 + i;
+        // tls(ymm_scratch) -> ymm_scratch, also publishes app results parked there
+        lower_ctx_emit(ctx, RESTORE_SIMD_FROM_SIZED_TLS(ctx->dcontext, ymm, TLS_ZMM_idx_SLOT(TO_YMM_REG_INDEX(ymm)),
+                                                        OPSZ_32));
+    }
+    for (uint i = 0; i < LOWER_MAX_GPR; i++) {
+        if (TEST(1 << i, ctx->gpr_used))
+            lower_ctx_emit(ctx, RESTORE_FROM_TLS(ctx->dcontext, lower_gprs[i], lower_gpr_slots[i]));
+    }
+    return ctx->first;
+}
+
+/* ======================================== *
+ *    embedded rounding / sae via MXCSR
+ * ======================================== */
+
+#define LOWER_MXCSR_DAZ 0x0040
+#define LOWER_MXCSR_ALL_MASKS 0x1f80
+#define LOWER_MXCSR_RC_SHIFT 13
+#define LOWER_MXCSR_RC_MASK 0x6000
+#define LOWER_MXCSR_FTZ 0x8000
+
+/* app MXCSR bits an override keeps, and the bits it sets, per LOWER_MXCSR_* mode */
+static const uint lower_mxcsr_keep[LOWER_MXCSR_NUM_MODES][4] = {
+    { LOWER_MXCSR_DAZ | LOWER_MXCSR_FTZ },
+    { LOWER_MXCSR_DAZ | LOWER_MXCSR_FTZ },
+    { LOWER_MXCSR_DAZ | LOWER_MXCSR_FTZ },
+    { LOWER_MXCSR_DAZ | LOWER_MXCSR_FTZ },
+    { LOWER_MXCSR_DAZ | LOWER_MXCSR_FTZ | LOWER_MXCSR_RC_MASK },
+};
+static const uint lower_mxcsr_set[LOWER_MXCSR_NUM_MODES][4] = {
+    { LOWER_MXCSR_ALL_MASKS | (LOWER_MXCSR_RN << LOWER_MXCSR_RC_SHIFT) },
+    { LOWER_MXCSR_ALL_MASKS | (LOWER_MXCSR_RD << LOWER_MXCSR_RC_SHIFT) },
+    { LOWER_MXCSR_ALL_MASKS | (LOWER_MXCSR_RU << LOWER_MXCSR_RC_SHIFT) },
+    { LOWER_MXCSR_ALL_MASKS | (LOWER_MXCSR_RZ << LOWER_MXCSR_RC_SHIFT) },
+    { LOWER_MXCSR_ALL_MASKS },
+};
+
+int
+lower_instr_mxcsr_override(instr_t *instr)
+{
+    uint prefixes = instr_get_prefixes(instr);
+    // evex.b on a memory form is an embedded broadcast
+    if (!TEST(AVX512_PREFIX_EVEX_B, prefixes) || instr_reads_memory(instr) || instr_writes_memory(instr))
+        return LOWER_MXCSR_NONE;
+    if (!TEST(AVX512_PREFIX_EVEX_ER, prefixes))
+        return LOWER_MXCSR_SAE;
+    return (TEST(AVX512_PREFIX_EVEX_LL, prefixes) ? 2 : 0) | (TEST(AVX512_PREFIX_VEX_L, prefixes) ? 1 : 0);
+}
+
+bool
+lower_instr_keeps_mxcsr_run(instr_t *instr)
+{
+    uint category = instr_get_category(instr);
+    if (instr_is_cti(instr) || instr_is_syscall(instr) || instr_is_interrupt(instr))
+        return false;
+    // fp math and the ldmxcsr/fxsave/xsave family are all catFP
+    if (TEST(DR_INSTR_CATEGORY_FP, category))
+        return false;
+    // opmask ops are uncategorized but never touch MXCSR, anything else unknown ends the run
+    return category != DR_INSTR_CATEGORY_UNCATEGORIZED || instr->is_avx512_instr;
+}
+
+static void
+lower_mxcsr_insert(instrlist_t *ilist, instr_t *where, instr_t *instr)
+{
+    if (where == NULL)
+        instrlist_append(ilist, instr);
+    else
+        instrlist_preinsert(ilist, where, instr);
+}
+
+void
+lower_mxcsr_switch(dcontext_t *dcontext, instrlist_t *ilist, instr_t *where, int mode, bool save_app)
+{
+    reg_id_t ymm = YMM_SPILL_SLOT0;
+    ushort ymm_slot = TLS_ZMM_idx_SLOT(TO_YMM_REG_INDEX(ymm));
+    opnd_t op_xmm = opnd_create_reg(YMM_TO_XMM(ymm));
+    opnd_t app_opnd = opnd_create_sized_tls_slot(os_tls_offset(TLS_MXCSR_APP_SLOT), OPSZ_4);
+    opnd_t override_opnd = opnd_create_sized_tls_slot(os_tls_offset(TLS_MXCSR_OVERRIDE_SLOT), OPSZ_4);
+
+    ASSERT(mode >= 0 && mode < LOWER_MXCSR_NUM_MODES);
+    if (save_app)
+        lower_mxcsr_insert(ilist, where, INSTR_CREATE_vstmxcsr(dcontext, app_opnd));
+    // override = (app & keep) | set, done in simd so eflags stay live
+    lower_mxcsr_insert(ilist, where, SAVE_SIMD_TO_SIZED_TLS(dcontext, ymm, ymm_slot, OPSZ_32));
+    lower_mxcsr_insert(ilist, where, INSTR_CREATE_vmovd(dcontext, op_xmm, app_opnd));
+    lower_mxcsr_insert(ilist, where,
+                       INSTR_CREATE_vpand(dcontext, op_xmm, op_xmm,
+                                          opnd_create_rel_addr((void *)lower_mxcsr_keep[mode], OPSZ_16)));
+    lower_mxcsr_insert(ilist, where,
+                       INSTR_CREATE_vpor(dcontext, op_xmm, op_xmm,
+                                         opnd_create_rel_addr((void *)lower_mxcsr_set[mode], OPSZ_16)));
+    lower_mxcsr_insert(ilist, where, INSTR_CREATE_vmovd(dcontext, override_opnd, op_xmm));
+    lower_mxcsr_insert(ilist, where, RESTORE_SIMD_FROM_SIZED_TLS(dcontext, ymm, ymm_slot, OPSZ_32));
+    lower_mxcsr_insert(ilist, where, INSTR_CREATE_vldmxcsr(dcontext, override_opnd));
+}
+
+void
+lower_mxcsr_restore(dcontext_t *dcontext, instrlist_t *ilist, instr_t *where)
+{
+    lower_mxcsr_insert(
+        ilist, where,
+        INSTR_CREATE_vldmxcsr(dcontext, opnd_create_sized_tls_slot(os_tls_offset(TLS_MXCSR_APP_SLOT), OPSZ_4)));
+}
+
+uint
+lower_mxcsr_translate(dcontext_t *dcontext, fragment_t *f, cache_pc pc, uint mxcsr)
+{
+    // the last vldmxcsr before pc tells: a switch loads the override slot, a restore the app slot
+    bool overridden = false;
+    cache_pc cur = f->start_pc;
+    instr_t instr;
+    instr_init(dcontext, &instr);
+    while (cur != NULL && cur < pc) {
+        instr_reset(dcontext, &instr);
+        cur = decode(dcontext, cur, &instr);
+        if (instr_get_opcode(&instr) == OP_vldmxcsr) {
+            opnd_t src = instr_get_src(&instr, 0);
+            overridden = opnd_is_far_base_disp(src) && opnd_get_segment(src) == SEG_TLS &&
+                opnd_get_disp(src) == os_tls_offset(TLS_MXCSR_OVERRIDE_SLOT);
+        }
+    }
+    instr_free(dcontext, &instr);
+    return overridden ? dcontext->local_state->spill_space.mxcsr_app : mxcsr;
+}
+
+uint
+lower_instr_tls_state_regs(instr_t *instr)
+{
+    uint regs = 0;
+    int i, j;
+    int num_srcs = instr_num_srcs(instr);
+    for (i = 0; i < num_srcs + instr_num_dsts(instr); i++) {
+        opnd_t opnd = i < num_srcs ? instr_get_src(instr, i) : instr_get_dst(instr, i - num_srcs);
+        for (j = 0; j < opnd_num_regs_used(opnd); j++) {
+            reg_id_t reg = opnd_get_reg_used(opnd, j);
+            if (reg_is_opmask(reg)) {
+                regs |= LOWER_STATE_K(reg - DR_REG_K0);
+            } else if (reg_is_vector_simd(reg)) {
+                reg = reg_resize_to_opsz(reg, OPSZ_64);
+                if (reg >= DR_REG_ZMM16 && reg <= DR_REG_ZMM31)
+                    regs |= LOWER_STATE_ZMM_HI16(reg - DR_REG_ZMM16);
+            }
+        }
+    }
+    return regs;
+}
+
+// the upper halves of zmm0-15 always go, as lowerings restore their scratch ymm with
+// vex moves that zero them
+static void
+lower_native_state_sync(dcontext_t *dcontext, instrlist_t *ilist, instr_t *where, uint regs, bool to_tls)
+{
+    opnd_t k0 = opnd_create_reg(DR_REG_K0);
+    opnd_t imm_hi = opnd_create_immed_int(1, OPSZ_1);
+    int i;
+    for (i = 0; i < 16; i++) {
+        opnd_t zmm = opnd_create_reg(DR_REG_ZMM0 + i);
+        opnd_t tls = opnd_create_sized_tls_slot(os_tls_offset(TLS_ZMM_idx_SLOT(i) + SIZE_OF_YMM), OPSZ_32);
+        lower_mxcsr_insert(ilist, where,
+                           to_tls ? INSTR_CREATE_vextracti64x4_mask(dcontext, tls, k0, imm_hi, zmm)
+                                  : INSTR_CREATE_vinserti64x4_mask(dcontext, zmm, k0, imm_hi, zmm, tls));
+    }
+    for (i = 16; i < 32; i++) {
+        opnd_t zmm = opnd_create_reg(DR_REG_ZMM0 + i);
+        opnd_t tls = opnd_create_sized_tls_slot(os_tls_offset(TLS_ZMM_idx_SLOT(i)), OPSZ_64);
+        if (!TEST(LOWER_STATE_ZMM_HI16(i - 16), regs))
+            continue;
+        lower_mxcsr_insert(ilist, where,
+                           to_tls ? INSTR_CREATE_vmovdqu64_mask(dcontext, tls, k0, zmm)
+                                  : INSTR_CREATE_vmovdqu64_mask(dcontext, zmm, k0, tls));
+    }
+    for (i = 0; i < 8; i++) {
+        opnd_t k = opnd_create_reg(DR_REG_K0 + i);
+        opnd_t tls = opnd_create_sized_tls_slot(os_tls_offset(TLS_K_idx_SLOT(i)), OPSZ_8);
+        if (!TEST(LOWER_STATE_K(i), regs))
+            continue;
+        lower_mxcsr_insert(ilist, where,
+                           to_tls ? INSTR_CREATE_kmovq(dcontext, tls, k) : INSTR_CREATE_kmovq(dcontext, k, tls));
+    }
+}
+
+void
+lower_native_state_to_tls(dcontext_t *dcontext, instrlist_t *ilist, instr_t *where, uint regs)
+{
+    lower_native_state_sync(dcontext, ilist, where, regs, true);
+}
+
+void
+lower_native_state_from_tls(dcontext_t *dcontext, instrlist_t *ilist, instr_t *where, uint regs)
+{
+    lower_native_state_sync(dcontext, ilist, where, regs, false);
+}
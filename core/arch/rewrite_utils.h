@@ -40,10 +40,11 @@
  * NOTE: we use the enum index defined in `/core/ir/x86/opcode_api.h` to fast lookup
  *       rewrite function in the `rewrite_funcs` pointer array. Since some avx2 instr
  *       also encoded in evex prefix, we treat them as psudo avx512 instr in the array
- *       as well.
+ *       as well. The array runs up to OP_LAST because later ISA extensions (VNNI,
+ *       BF16, VPOPCNTDQ, ...) are appended after OP_vshufi64x2 in the enum.
  */
 #define AVX512_FIRST_OP OP_vmovss
-#define AVX512_LAST_OP OP_vshufi64x2
+#define AVX512_LAST_OP OP_LAST
 
 #define NUM_AVX512_INSTR_OP ((AVX512_LAST_OP - AVX512_FIRST_OP) + 1)
 #define TO_AVX512_RWFUNC_INDEX(opcode) (opcode - AVX512_FIRST_OP)
@@ -702,6 +703,12 @@ print_rewrite_three_instr(dcontext_t *dcontext, instr_t *instr1, instr_t *instr2
 void
 print_rewrite_variadic_instr(dcontext_t *dcontext, int num_instr, ...);
 
+/**
+ * @brief Print a next-linked instruction chain (e.g. a lowered sequence) for debugging.
+ */
+void
+print_rewrite_instr_chain(dcontext_t *dcontext, instr_t *first);
+
 /**
  * @brief Dump the per-thread saved SIMD and opmask slots from mcontext for debugging.
  */
@@ -764,6 +771,275 @@ instrlist_concat_next_instr(instrlist_t *ilist, int num_instr, ...);
 bool
 is_avx512_zero_mask(instr_t *instr);
 
+/* ======================================== *
+ *    half-wise avx2 lowering helpers
+ * ======================================== */
+
+/** EVEX prefix bits the decoder keeps in instr prefixes (see ir/x86/decode_private.h) */
+#define AVX512_PREFIX_VEX_L 0x000040000
+#define AVX512_PREFIX_EVEX_LL 0x000400000
+#define AVX512_PREFIX_EVEX_Z 0x000800000
+#define AVX512_PREFIX_EVEX_B 0x001000000
+#define AVX512_PREFIX_EVEX_ER 0x004000000
+
+#define LOWER_HALF_LOW 0
+#define LOWER_HALF_HIGH 1
+#define LOWER_MAX_SCRATCH 6 /* YMM_SPILL_SLOT0..5 */
+#define LOWER_MAX_GPR 4     /* rax, rbx, rcx, rdx, each spilled to its own TLS slot */
+
+/**
+ * A 512-bit operation is lowered as two 256-bit halves (ymm/xmm forms as one).
+ * Half h of zmmN lives in the physical ymmN when h == 0 and N < 16, otherwise in
+ * TLS at TLS_ZMM_idx_SLOT(N) + h * SIZE_OF_YMM. Scratch ymms are parked in their
+ * own TLS low slots, so an app operand aliasing a scratch reg is transparently
+ * read from and written to TLS until lower_ctx_finish() restores it.
+ */
+typedef struct _lower_ctx_t lower_ctx_t;
+struct _lower_ctx_t {
+    dcontext_t *dcontext;
+    instr_t *first;
+    instr_t *last;
+    uint num_instr;
+    reg_id_t dst_reg;  /* app destination xyzmm */
+    reg_id_t mask_reg; /* app opmask, DR_REG_NULL if unmasked */
+    bool zero_mask;
+    bool is_bcst;      /* memory source is an embedded broadcast {1toN} */
+    bool is_xmm;       /* EVEX.128 form, scratch regs are handed out as xmm */
+    uint num_halves;   /* 2 for zmm, 1 for ymm/xmm */
+    uint scratch_used; /* bitmap over YMM_SPILL_SLOT0..5 */
+    uint ymm_parked;   /* physical ymm0-15 whose app value lives in its TLS low slot */
+    uint gpr_used;     /* bitmap over the LOWER_MAX_GPR scratch gprs */
+    reg_id_t bcst_reg; /* ymm scratch the {1toN} source was loaded into, see lower_ctx_src_half() */
+};
+
+/**
+ * @brief Initialize a lowering context from the (not yet destroyed) EVEX instr.
+ *
+ * Records the destination, opmask, zeroing and broadcast bits of `instr`; the
+ * caller still owns `instr` and removes it from the ilist as usual.
+ */
+void
+lower_ctx_init(lower_ctx_t *ctx, dcontext_t *dcontext, instr_t *instr);
+
+/**
+ * @brief Append one instruction to the lowered sequence.
+ */
+void
+lower_ctx_emit(lower_ctx_t *ctx, instr_t *instr);
+
+/**
+ * @brief Hand out a scratch simd register (xmm for EVEX.128, ymm otherwise).
+ *
+ * The first use of a scratch reg emits its save to TLS. Returns DR_REG_NULL if
+ * all LOWER_MAX_SCRATCH registers are in use.
+ */
+reg_id_t
+lower_ctx_get_scratch(lower_ctx_t *ctx);
+
+/**
+ * @brief Hand out a scratch gpr that `avoid` (e.g. the app memory operand) does not use.
+ *
+ * Only needed for table lookups that cannot be done in simd registers; the caller
+ * must not touch eflags. Returns DR_REG_NULL if no register is left.
+ */
+reg_id_t
+lower_ctx_get_gpr(lower_ctx_t *ctx, opnd_t avoid);
+
+/**
+ * @brief Load half `half` of a register or memory source into `scratch`.
+ */
+void
+lower_ctx_load_half(lower_ctx_t *ctx, reg_id_t scratch, opnd_t src, uint half);
+
+/**
+ * @brief Return a register holding half `half` of a source the caller only reads.
+ *
+ * A live physical app register is returned as is. A {1toN} memory source is
+ * broadcast into `scratch` on first use and that register is returned for every
+ * later half, so it must not be written while the context is live. Anything else
+ * is loaded into `scratch`.
+ */
+reg_id_t
+lower_ctx_src_half(lower_ctx_t *ctx, reg_id_t scratch, opnd_t src, uint half);
+
+/**
+ * @brief Like lower_ctx_src_half(), but for instrs that take an r/m source.
+ *
+ * A half that is not live in a physical register is addressed where it already
+ * is, in app memory or in its TLS home, instead of being loaded into `scratch`.
+ * Only a {1toN} source is still broadcast into `scratch`.
+ */
+opnd_t
+lower_ctx_src_half_opnd(lower_ctx_t *ctx, reg_id_t scratch, opnd_t src, uint half);
+
+/**
+ * @brief Whether half `half` of app simd register `reg` is live in its physical ymm.
+ */
+bool
+lower_ctx_reg_is_live(lower_ctx_t *ctx, reg_id_t reg, uint half);
+
+/**
+ * @brief Load 128-bit lane `lane` (0-3) of a register or memory source into xmm `xmm`.
+ *
+ * Always a single instr: a move, or vextracti128 for the high lane of a live ymm.
+ */
+void
+lower_ctx_load_lane(lower_ctx_t *ctx, reg_id_t xmm, opnd_t src, uint lane);
+
+/**
+ * @brief Load the low 128 bits of a register or m128 source (e.g. a shift count) into xmm `scratch`.
+ */
+void
+lower_ctx_load_xmm(lower_ctx_t *ctx, reg_id_t scratch, opnd_t src);
+
+/**
+ * @brief Memory operand for half `half` of `mem`, resized to `size`.
+ */
+opnd_t
+lower_half_mem_opnd(opnd_t mem, uint half, opnd_size_t size);
+
+/**
+ * @brief Store `scratch` into half `half` of the app destination.
+ */
+void
+lower_ctx_store_half(lower_ctx_t *ctx, uint half, reg_id_t scratch);
+
+/**
+ * @brief Expand opmask `k_reg` into an all-ones/all-zeros lane mask in `scratch`.
+ *
+ * Lanes are `elem_size` bytes wide (1, 2, 4 or 8) and the bits are taken from
+ * the part of the opmask that covers half `half`. No GPR or eflags are touched.
+ */
+void
+lower_ctx_k_lane_mask(lower_ctx_t *ctx, reg_id_t scratch, reg_id_t k_reg, uint elem_size, uint half);
+
+/**
+ * @brief Apply the app opmask to `result` and store it into half `half`.
+ *
+ * Unmasked instrs store directly. Otherwise `tmp_mask` receives the lane mask and,
+ * for merge masking, `tmp_old` the old destination half before blending.
+ */
+void
+lower_ctx_store_half_masked(lower_ctx_t *ctx, uint half, reg_id_t result, uint elem_size, reg_id_t tmp_mask,
+                            reg_id_t tmp_old);
+
+/**
+ * @brief Create an operand for a 16/32-byte constant in DR's image, sized for the context.
+ */
+opnd_t
+lower_ctx_const_opnd(lower_ctx_t *ctx, const void *table);
+
+/**
+ * @brief Check the common `op {k} reg, reg/mem -> reg` operand shape before lowering.
+ */
+bool
+lower_binop_opnds_supported(instr_t *instr);
+
+/**
+ * @brief Vector length in bytes (16, 32 or 64) that an EVEX instr encodes in L'L.
+ *
+ * Needed where the operands do not tell, e.g. a {1toN} source narrowed into an xmm.
+ * Register-form {er} instrs reuse L'L for the rounding mode and are always 512-bit.
+ */
+uint
+lower_instr_vector_bytes(instr_t *instr);
+
+/**
+ * @brief Lower an element-wise `op {k} reg, reg/mem/{1toN} -> reg` into `avx2_opcode`
+ *        per half, merging or zeroing `elem_size`-byte lanes by the opmask.
+ */
+instr_t *
+lower_binop_gen(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr, int avx2_opcode, uint elem_size);
+
+/**
+ * @brief Restore all scratch regs (simd and gpr) and return the head of the lowered sequence.
+ */
+instr_t *
+lower_ctx_finish(lower_ctx_t *ctx);
+
+/* ======================================== *
+ *    embedded rounding / sae via MXCSR
+ * ======================================== */
+
+/* MXCSR overrides, LOWER_MXCSR_RN..RZ match the EVEX.L'L / MXCSR.RC encoding */
+#define LOWER_MXCSR_NONE (-1)
+#define LOWER_MXCSR_RN 0
+#define LOWER_MXCSR_RD 1
+#define LOWER_MXCSR_RU 2
+#define LOWER_MXCSR_RZ 3
+#define LOWER_MXCSR_SAE 4 /* exceptions suppressed, rounding per app MXCSR */
+#define LOWER_MXCSR_NUM_MODES 5
+
+/**
+ * @brief The MXCSR override an EVEX instr asks for: its {er} rounding mode, LOWER_MXCSR_SAE
+ *        for {sae}, or LOWER_MXCSR_NONE for everything else (including memory forms).
+ */
+int
+lower_instr_mxcsr_override(instr_t *instr);
+
+/**
+ * @brief Whether an app instr may stay inside a run of lowered instrs executing under
+ *        an MXCSR override, i.e. it neither reads nor writes MXCSR state.
+ */
+bool
+lower_instr_keeps_mxcsr_run(instr_t *instr);
+
+/**
+ * @brief Insert the switch to MXCSR override `mode` before `where` (NULL appends).
+ *
+ * With `save_app` the app MXCSR is first stored to TLS_MXCSR_APP_SLOT; otherwise
+ * an override is already live and the saved app value is reused. The new value keeps
+ * the app DAZ/FTZ bits (and RC for LOWER_MXCSR_SAE) and masks all exceptions. Only
+ * YMM_SPILL_SLOT0 is used as scratch, eflags are untouched.
+ */
+void
+lower_mxcsr_switch(dcontext_t *dcontext, instrlist_t *ilist, instr_t *where, int mode, bool save_app);
+
+/**
+ * @brief Insert the reload of the app MXCSR before `where` (NULL appends). Flags raised
+ *        under the override are dropped with it, as {er}/{sae} require.
+ */
+void
+lower_mxcsr_restore(dcontext_t *dcontext, instrlist_t *ilist, instr_t *where);
+
+/**
+ * @brief The MXCSR to hand to the app for a thread interrupted at cache pc `pc` of
+ *        fragment `f`, whose MXCSR register held `mxcsr`.
+ *
+ * Inside an {er}/{sae} run, i.e. past a switch and before its restore, the register
+ * holds the override and the app value is the one saved in TLS_MXCSR_APP_SLOT.
+ */
+uint
+lower_mxcsr_translate(dcontext_t *dcontext, fragment_t *f, cache_pc pc, uint mxcsr);
+
+/* -avx512_native_subsets: bits of lower_instr_tls_state_regs() */
+#define LOWER_STATE_ZMM_HI16(idx) (1u << (idx))   /* zmm16 + idx */
+#define LOWER_STATE_K(idx) (1u << (16 + (idx))) /* k0 + idx */
+
+/**
+ * @brief The zmm16-31 and opmask regs an AVX-512 instr refers to, whose lowering keeps
+ *        them entirely in TLS, as LOWER_STATE_* bits.
+ */
+uint
+lower_instr_tls_state_regs(instr_t *instr);
+
+/**
+ * @brief Insert before `where` (NULL appends) the copy of the real AVX-512 state into
+ *        the TLS slots the lowerings use, ahead of a run of lowered instrs among
+ *        instrs the host runs natively.
+ *
+ * Copies the upper halves of zmm0-15 and the zmm16-31 and opmask regs in `regs`.
+ * Needs AVX-512F and BW on the host; no GPR or eflags are touched.
+ */
+void
+lower_native_state_to_tls(dcontext_t *dcontext, instrlist_t *ilist, instr_t *where, uint regs);
+
+/**
+ * @brief Insert before `where` (NULL appends) the reverse copy, at the end of the run.
+ */
+void
+lower_native_state_from_tls(dcontext_t *dcontext, instrlist_t *ilist, instr_t *where, uint regs);
+
 /* marco template for rewrite function */
 
 #define FIXED_ALLOC_BOTH_SRC(_s1, _s2, _dst) \
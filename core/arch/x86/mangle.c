@@ -2580,6 +2580,195 @@ cpuid_give_up:
 }
 #endif /* FOOL_CPUID */
 
+/***************************************************************************
+ * AVX-512 HIDING
+ *
+ * -hide_avx512 clears AVX-512 subsets from what cpuid and xgetbv report, so that
+ * code dispatching on them at runtime (glibc ifuncs, BLAS and DNN kernels) picks
+ * its AVX2 paths and needs no rewriting, while code that uses AVX-512 without
+ * asking is still rewritten as before.
+ */
+
+/* cpuid leaf 7 subleaf 0 */
+#define CPUID_7_EBX_AVX512F 0x00010000
+#define CPUID_7_EBX_AVX512DQ 0x00020000
+#define CPUID_7_EBX_AVX512IFMA 0x00200000
+#define CPUID_7_EBX_AVX512PF 0x04000000
+#define CPUID_7_EBX_AVX512ER 0x08000000
+#define CPUID_7_EBX_AVX512CD 0x10000000
+#define CPUID_7_EBX_AVX512BW 0x40000000
+#define CPUID_7_EBX_AVX512VL 0x80000000
+#define CPUID_7_ECX_AVX512VBMI 0x00000002
+#define CPUID_7_ECX_AVX512VBMI2 0x00000040
+#define CPUID_7_ECX_AVX512VNNI 0x00000800
+#define CPUID_7_ECX_AVX512BITALG 0x00001000
+#define CPUID_7_ECX_AVX512VPOPCNTDQ 0x00004000
+#define CPUID_7_EDX_AVX512_4VNNIW 0x00000004
+#define CPUID_7_EDX_AVX512_4FMAPS 0x00000008
+#define CPUID_7_EDX_AVX512VP2INTERSECT 0x00000100
+#define CPUID_7_EDX_AVX512FP16 0x00800000
+/* cpuid leaf 7 subleaf 1 */
+#define CPUID_7_1_EAX_AVX512BF16 0x00000020
+/* XCR0 opmask, ZMM_Hi256 and Hi16_ZMM state */
+#define XCR0_AVX512_STATE 0x000000e0
+
+typedef struct _hide_avx512_bits_t {
+    uint subsets; /* HIDE_AVX512_* */
+    uint leaf7_ebx, leaf7_ecx, leaf7_edx, leaf7_1_eax;
+} hide_avx512_bits_t;
+
+static const hide_avx512_bits_t hide_avx512_bits[] = {
+    { HIDE_AVX512_CD, CPUID_7_EBX_AVX512CD, 0, 0, 0 },
+    { HIDE_AVX512_BW, CPUID_7_EBX_AVX512BW, 0, 0, 0 },
+    { HIDE_AVX512_DQ, CPUID_7_EBX_AVX512DQ, 0, 0, 0 },
+    { HIDE_AVX512_VL, CPUID_7_EBX_AVX512VL, 0, 0, 0 },
+    { HIDE_AVX512_IFMA, CPUID_7_EBX_AVX512IFMA, 0, 0, 0 },
+    { HIDE_AVX512_VBMI, 0, CPUID_7_ECX_AVX512VBMI | CPUID_7_ECX_AVX512VBMI2, 0, 0 },
+    { HIDE_AVX512_VNNI, 0, CPUID_7_ECX_AVX512VNNI, CPUID_7_EDX_AVX512_4VNNIW, 0 },
+    { HIDE_AVX512_BITALG, 0, CPUID_7_ECX_AVX512BITALG | CPUID_7_ECX_AVX512VPOPCNTDQ,
+      0, 0 },
+    { HIDE_AVX512_BF16, 0, 0, 0, CPUID_7_1_EAX_AVX512BF16 },
+    { HIDE_AVX512_FP16, 0, 0, CPUID_7_EDX_AVX512FP16, 0 },
+    { HIDE_AVX512_VP2INTERSECT, 0, 0, CPUID_7_EDX_AVX512VP2INTERSECT, 0 },
+    { HIDE_AVX512_PHI, CPUID_7_EBX_AVX512PF | CPUID_7_EBX_AVX512ER, 0,
+      CPUID_7_EDX_AVX512_4FMAPS | CPUID_7_EDX_AVX512_4VNNIW, 0 },
+};
+
+/* Returns the union of the cpuid bits of every subset in -hide_avx512. */
+static hide_avx512_bits_t
+hide_avx512_cleared_bits(void)
+{
+    hide_avx512_bits_t clear = { DYNAMO_OPTION(hide_avx512), 0, 0, 0, 0 };
+    uint i;
+    /* Every subset is an extension of F: without F, none of them is usable. */
+    if (TEST(HIDE_AVX512_F, clear.subsets)) {
+        clear.subsets = HIDE_AVX512_ALL;
+        clear.leaf7_ebx |= CPUID_7_EBX_AVX512F;
+    }
+    for (i = 0; i < BUFFER_SIZE_ELEMENTS(hide_avx512_bits); i++) {
+        if (TESTANY(hide_avx512_bits[i].subsets, clear.subsets)) {
+            clear.leaf7_ebx |= hide_avx512_bits[i].leaf7_ebx;
+            clear.leaf7_ecx |= hide_avx512_bits[i].leaf7_ecx;
+            clear.leaf7_edx |= hide_avx512_bits[i].leaf7_edx;
+            clear.leaf7_1_eax |= hide_avx512_bits[i].leaf7_1_eax;
+        }
+    }
+    return clear;
+}
+
+static opnd_t
+hide_avx512_tls(ushort slot)
+{
+    return opnd_create_sized_tls_slot(os_tls_offset(slot), OPSZ_4);
+}
+
+/* Inserts before `where` the clearing of the given bits of ebx, ecx and edx,
+ * skipping the regs with nothing to clear.
+ */
+static void
+hide_avx512_clear_regs(dcontext_t *dcontext, instrlist_t *ilist, instr_t *where,
+                       uint ebx, uint ecx, uint edx)
+{
+    const reg_id_t regs[] = { REG_EBX, REG_ECX, REG_EDX };
+    const uint bits[] = { ebx, ecx, edx };
+    uint i;
+    for (i = 0; i < BUFFER_SIZE_ELEMENTS(regs); i++) {
+        if (bits[i] == 0)
+            continue;
+        PRE(ilist, where,
+            instr_set_translation_mangling_epilogue(
+                dcontext, ilist,
+                INSTR_CREATE_and(dcontext, opnd_create_reg(regs[i]),
+                                 OPND_CREATE_INT32((int)~bits[i]))));
+    }
+}
+
+/* Masks the result of an app cpuid or xgetbv per -hide_avx512.
+ *
+ * The input regs are spilled to their TLS slots before the instr; afterward eax
+ * goes to the xbx slot so that the app flags can be saved in it with lahf and
+ * seto, the same as the ibl does, and the leaf is checked against the spilled
+ * input:
+ *
+ *   cpuid                          xgetbv
+ *   mov  %eax -> xbx slot          mov  %eax -> xbx slot
+ *   lahf; seto %al                 lahf; seto %al
+ *   cmp  xax slot, $7; jne done    cmp  xcx slot, $0; jne done
+ *   cmp  xcx slot, $0; jne sub1    and  $~state, xbx slot
+ *   and  $~bits, %ebx/%ecx/%edx  done:
+ *   jmp  done                      add  $0x7f, %al; sahf
+ *  sub1:                           mov  xbx slot -> %eax
+ *   cmp  xcx slot, $1; jne done
+ *   and  $~bits, xbx slot
+ *  done:
+ *   add  $0x7f, %al; sahf
+ *   mov  xbx slot -> %eax
+ */
+void
+mangle_hide_avx512(dcontext_t *dcontext, instrlist_t *ilist, instr_t *instr,
+                   instr_t *next_instr)
+{
+    hide_avx512_bits_t clear = hide_avx512_cleared_bits();
+    bool is_cpuid = instr_get_opcode(instr) == OP_cpuid;
+    instr_t *done = INSTR_CREATE_label(dcontext);
+    instr_t *end = INSTR_CREATE_label(dcontext);
+
+    ASSERT(is_cpuid || instr_get_opcode(instr) == OP_xgetbv);
+    if (!is_cpuid && !TEST(HIDE_AVX512_F, clear.subsets))
+        return; /* the XCR0 state only goes with F */
+    LOG(THREAD, LOG_INTERP, 3, "hiding AVX-512 subsets 0x%x from %s\n", clear.subsets,
+        is_cpuid ? "cpuid" : "xgetbv");
+
+    if (is_cpuid)
+        PRE(ilist, instr, instr_create_save_to_tls(dcontext, REG_XAX, TLS_XAX_SLOT));
+    PRE(ilist, instr, instr_create_save_to_tls(dcontext, REG_XCX, TLS_XCX_SLOT));
+
+    /* Everything after the instr goes before this label, so that it does not
+     * matter whether the block continues past the instr.
+     */
+    POST(ilist, instr, end);
+#define POST_PRE(i) \
+    PRE(ilist, end, instr_set_translation_mangling_epilogue(dcontext, ilist, i))
+    POST_PRE(INSTR_CREATE_mov_st(dcontext, hide_avx512_tls(TLS_XBX_SLOT),
+                                 opnd_create_reg(REG_EAX)));
+    POST_PRE(INSTR_CREATE_lahf(dcontext));
+    POST_PRE(INSTR_CREATE_setcc(dcontext, OP_seto, opnd_create_reg(REG_AL)));
+    if (is_cpuid) {
+        instr_t *sub1 = INSTR_CREATE_label(dcontext);
+        POST_PRE(INSTR_CREATE_cmp(dcontext, hide_avx512_tls(TLS_XAX_SLOT),
+                                  OPND_CREATE_INT32(7)));
+        POST_PRE(INSTR_CREATE_jcc(dcontext, OP_jne, opnd_create_instr(done)));
+        POST_PRE(INSTR_CREATE_cmp(dcontext, hide_avx512_tls(TLS_XCX_SLOT),
+                                  OPND_CREATE_INT32(0)));
+        POST_PRE(INSTR_CREATE_jcc(dcontext, OP_jne,
+                                  opnd_create_instr(clear.leaf7_1_eax == 0 ? done : sub1)));
+        hide_avx512_clear_regs(dcontext, ilist, end, clear.leaf7_ebx, clear.leaf7_ecx,
+                               clear.leaf7_edx);
+        if (clear.leaf7_1_eax != 0) {
+            POST_PRE(INSTR_CREATE_jmp(dcontext, opnd_create_instr(done)));
+            POST_PRE(sub1);
+            POST_PRE(INSTR_CREATE_cmp(dcontext, hide_avx512_tls(TLS_XCX_SLOT),
+                                      OPND_CREATE_INT32(1)));
+            POST_PRE(INSTR_CREATE_jcc(dcontext, OP_jne, opnd_create_instr(done)));
+            POST_PRE(INSTR_CREATE_and(dcontext, hide_avx512_tls(TLS_XBX_SLOT),
+                                      OPND_CREATE_INT32((int)~clear.leaf7_1_eax)));
+        } else
+            instr_destroy(dcontext, sub1);
+    } else {
+        POST_PRE(INSTR_CREATE_cmp(dcontext, hide_avx512_tls(TLS_XCX_SLOT),
+                                  OPND_CREATE_INT32(0)));
+        POST_PRE(INSTR_CREATE_jcc(dcontext, OP_jne, opnd_create_instr(done)));
+        POST_PRE(INSTR_CREATE_and(dcontext, hide_avx512_tls(TLS_XBX_SLOT),
+                                  OPND_CREATE_INT32(~XCR0_AVX512_STATE)));
+    }
+    POST_PRE(done);
+    POST_PRE(INSTR_CREATE_add(dcontext, opnd_create_reg(REG_AL), OPND_CREATE_INT8(0x7f)));
+    POST_PRE(INSTR_CREATE_sahf(dcontext));
+    POST_PRE(INSTR_CREATE_mov_ld(dcontext, opnd_create_reg(REG_EAX),
+                                 hide_avx512_tls(TLS_XBX_SLOT)));
+#undef POST_PRE
+}
+
 void
 mangle_exit_cti_prefixes(dcontext_t *dcontext, instr_t *instr)
 {
@@ -69,6 +69,79 @@
 
 static bool avx_enabled;
 static bool avx512_enabled;
+/* -avx512_native_subsets: set when AVX-512 instrs run natively, with the opcodes
+ * that need a subset the host lacks still being rewritten.
+ */
+static bool avx512_native;
+static bool avx512_opcode_rewritten[OP_AFTER_LAST];
+
+/* The AVX-512 opcodes beyond the F, CD, BW, DQ and VL base, by the subset they need.
+ * Only EVEX forms are marked for rewriting, so the opcodes shared with VEX forms
+ * (GFNI, VAES, VPCLMULQDQ) are listed under the extension itself.
+ */
+static const struct {
+    int opcode;
+    feature_bit_t feature;
+} avx512_opcode_subsets[] = {
+    { OP_vpmadd52luq, FEATURE_AVX512IFMA },
+    { OP_vpmadd52huq, FEATURE_AVX512IFMA },
+    { OP_vpermb, FEATURE_AVX512VBMI },
+    { OP_vpermi2b, FEATURE_AVX512VBMI },
+    { OP_vpermt2b, FEATURE_AVX512VBMI },
+    { OP_vpdpbusd, FEATURE_AVX512VNNI },
+    { OP_vpdpbusds, FEATURE_AVX512VNNI },
+    { OP_vpdpwssd, FEATURE_AVX512VNNI },
+    { OP_vpdpwssds, FEATURE_AVX512VNNI },
+    { OP_vpopcntd, FEATURE_AVX512VPOPCNTDQ },
+    { OP_vpopcntq, FEATURE_AVX512VPOPCNTDQ },
+    { OP_vcvtne2ps2bf16, FEATURE_AVX512BF16 },
+    { OP_vcvtneps2bf16, FEATURE_AVX512BF16 },
+    { OP_vdpbf16ps, FEATURE_AVX512BF16 },
+    { OP_vsqrtph, FEATURE_AVX512FP16 },
+    { OP_vaddph, FEATURE_AVX512FP16 },
+    { OP_vmulph, FEATURE_AVX512FP16 },
+    { OP_vsubph, FEATURE_AVX512FP16 },
+    { OP_vminph, FEATURE_AVX512FP16 },
+    { OP_vdivph, FEATURE_AVX512FP16 },
+    { OP_vmaxph, FEATURE_AVX512FP16 },
+    { OP_vfmadd132ph, FEATURE_AVX512FP16 },
+    { OP_vfmadd213ph, FEATURE_AVX512FP16 },
+    { OP_vfmadd231ph, FEATURE_AVX512FP16 },
+    { OP_vgf2p8mulb, FEATURE_GFNI },
+    { OP_vgf2p8affineqb, FEATURE_GFNI },
+    { OP_vgf2p8affineinvqb, FEATURE_GFNI },
+    { OP_vaesenc, FEATURE_VAES },
+    { OP_vaesenclast, FEATURE_VAES },
+    { OP_vaesdec, FEATURE_VAES },
+    { OP_vaesdeclast, FEATURE_VAES },
+    { OP_vpclmulqdq, FEATURE_VPCLMULQDQ },
+    { OP_vexp2ps, FEATURE_AVX512ER },
+    { OP_vexp2pd, FEATURE_AVX512ER },
+    { OP_vrcp28ps, FEATURE_AVX512ER },
+    { OP_vrcp28pd, FEATURE_AVX512ER },
+    { OP_vrcp28ss, FEATURE_AVX512ER },
+    { OP_vrcp28sd, FEATURE_AVX512ER },
+    { OP_vrsqrt28ps, FEATURE_AVX512ER },
+    { OP_vrsqrt28pd, FEATURE_AVX512ER },
+    { OP_vrsqrt28ss, FEATURE_AVX512ER },
+    { OP_vrsqrt28sd, FEATURE_AVX512ER },
+    { OP_vgatherpf0dps, FEATURE_AVX512PF },
+    { OP_vgatherpf0dpd, FEATURE_AVX512PF },
+    { OP_vgatherpf0qps, FEATURE_AVX512PF },
+    { OP_vgatherpf0qpd, FEATURE_AVX512PF },
+    { OP_vgatherpf1dps, FEATURE_AVX512PF },
+    { OP_vgatherpf1dpd, FEATURE_AVX512PF },
+    { OP_vgatherpf1qps, FEATURE_AVX512PF },
+    { OP_vgatherpf1qpd, FEATURE_AVX512PF },
+    { OP_vscatterpf0dps, FEATURE_AVX512PF },
+    { OP_vscatterpf0dpd, FEATURE_AVX512PF },
+    { OP_vscatterpf0qps, FEATURE_AVX512PF },
+    { OP_vscatterpf0qpd, FEATURE_AVX512PF },
+    { OP_vscatterpf1dps, FEATURE_AVX512PF },
+    { OP_vscatterpf1dpd, FEATURE_AVX512PF },
+    { OP_vscatterpf1qps, FEATURE_AVX512PF },
+    { OP_vscatterpf1qpd, FEATURE_AVX512PF },
+};
 
 static int num_simd_saved;
 static int num_simd_registers;
@@ -263,7 +336,14 @@ get_processor_specific_info(void)
     if (max_val >= 0x7) {
         our_cpuid(cpuid_res_local, 0x7, 0);
         res_ebx = cpuid_res_local[1];
+        res_ecx = cpuid_res_local[2];
         cpu_info.features.sext_flags_ebx = res_ebx;
+        cpu_info.features.sext_flags_ecx = res_ecx;
+        cpu_info.features.sext_flags_edx = cpuid_res_local[3];
+        if (cpuid_res_local[0] >= 1) {
+            our_cpuid(cpuid_res_local, 0x7, 1);
+            cpu_info.features.sext1_flags_eax = cpuid_res_local[0];
+        }
     }
 
     /* now get processor info */
@@ -350,6 +430,31 @@ get_processor_specific_info(void)
     }
 }
 
+/* Decides, for -avx512_native_subsets, which AVX-512 opcodes the host runs itself. */
+static void
+proc_init_avx512_native(void)
+{
+    size_t i;
+    if (!DYNAMO_OPTION(avx512_native_subsets) || !avx512_enabled)
+        return;
+    /* Every AVX-512 host but the Xeon Phi has the base, and the table above only
+     * covers what came after it.
+     */
+    if (!proc_has_feature(FEATURE_AVX512CD) || !proc_has_feature(FEATURE_AVX512BW) ||
+        !proc_has_feature(FEATURE_AVX512DQ) || !proc_has_feature(FEATURE_AVX512VL)) {
+        LOG(GLOBAL, LOG_TOP, 1, "\tAVX-512 base subsets missing: rewriting all of it\n");
+        return;
+    }
+    avx512_native = true;
+    for (i = 0; i < BUFFER_SIZE_ELEMENTS(avx512_opcode_subsets); i++) {
+        if (!proc_has_feature(avx512_opcode_subsets[i].feature)) {
+            avx512_opcode_rewritten[avx512_opcode_subsets[i].opcode] = true;
+            LOG(GLOBAL, LOG_TOP, 2, "\trewriting %s\n",
+                decode_opcode_name(avx512_opcode_subsets[i].opcode));
+        }
+    }
+}
+
 /* arch specific proc info */
 void
 proc_init_arch(void)
@@ -377,8 +482,11 @@ proc_init_arch(void)
             cpu_info.features.flags_edx, cpu_info.features.flags_ecx);
         LOG(GLOBAL, LOG_TOP, 1, "\text_edx = 0x%08x\n\text_ecx = 0x%08x\n",
             cpu_info.features.ext_flags_edx, cpu_info.features.ext_flags_ecx);
-        LOG(GLOBAL, LOG_TOP, 1, "\tsext_ebx = 0x%08x\n",
-            cpu_info.features.sext_flags_ebx);
+        LOG(GLOBAL, LOG_TOP, 1,
+            "\tsext_ebx = 0x%08x\n\tsext_ecx = 0x%08x\n\tsext_edx = 0x%08x\n"
+            "\tsext1_eax = 0x%08x\n",
+            cpu_info.features.sext_flags_ebx, cpu_info.features.sext_flags_ecx,
+            cpu_info.features.sext_flags_edx, cpu_info.features.sext1_flags_eax);
         if (proc_has_feature(FEATURE_XD_Bit))
             LOG(GLOBAL, LOG_TOP, 1, "\tProcessor has XD Bit\n");
         if (proc_has_feature(FEATURE_MMX))
@@ -475,6 +583,7 @@ proc_init_arch(void)
                                     TEST(XCR0_HI16_ZMM, bv_low));
         }
     }
+    proc_init_avx512_native();
     for (i = 0; i < DEBUG_REGISTERS_NB; i++) {
         d_r_debug_register[i] = NULL;
     }
@@ -497,6 +606,12 @@ proc_has_feature(feature_bit_t f)
         val = cpu_info.features.ext_flags_ecx;
     } else if (f >= 128 && f <= 159) {
         val = cpu_info.features.sext_flags_ebx;
+    } else if (f >= 160 && f <= 191) {
+        val = cpu_info.features.sext_flags_ecx;
+    } else if (f >= 192 && f <= 223) {
+        val = cpu_info.features.sext_flags_edx;
+    } else if (f >= 224 && f <= 255) {
+        val = cpu_info.features.sext1_flags_eax;
     } else {
         CLIENT_ASSERT(false, "proc_has_feature: invalid parameter");
     }
@@ -699,6 +814,14 @@ proc_avx_enabled(void)
 bool
 proc_avx512_enabled(void)
 {
-    // return avx512_enabled; // TODO: not elegent to do so
-    return false;
+    /* Rewritten code keeps the AVX-512 state in TLS, so the real zmm and opmask
+     * registers only need preserving when some AVX-512 instrs run natively.
+     */
+    return avx512_native;
+}
+
+bool
+proc_avx512_runs_natively(instr_t *instr)
+{
+    return avx512_native && !avx512_opcode_rewritten[instr_get_opcode(instr)];
 }
@@ -54,6 +54,7 @@
 #include "arch.h"
 #include "instrument.h"
 #include "rewrite.h"
+#include "rewrite_phase.h"
 #include "utils.h"
 // #include "rewrite_analysis.h"
 
@@ -176,6 +177,12 @@ d_r_dispatch(dcontext_t *dcontext)
      * cache due to flushing before we get there.
      */
     do {
+#ifdef LINUX
+        if (rewrite_phase_is_quiet(dcontext)) {
+            rewrite_phase_detach(dcontext);
+            dcontext->go_native = true;
+        }
+#endif
         if (is_in_dynamo_dll(dcontext->next_tag) ||
             dcontext->next_tag == BACK_TO_NATIVE_AFTER_SYSCALL || dcontext->go_native) {
             handle_special_tag(dcontext);
@@ -658,6 +665,9 @@ dispatch_at_stopping_point(dcontext_t *dcontext)
 #    endif
         dynamo_thread_not_under_dynamo(dcontext);
     dcontext->go_native = false;
+#    ifdef LINUX
+    rewrite_phase_detached(dcontext);
+#    endif
 }
 #endif
 
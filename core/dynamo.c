@@ -80,6 +80,10 @@
 #endif
 
 #include "perscache.h"
+#include "rewrite_cache.h"
+#include "rewrite_template.h"
+#include "rewrite_arena.h"
+#include "rewrite_helper.h"
 
 #ifdef VMX86_SERVER
 #    include "vmkuw.h"
@@ -1022,6 +1026,7 @@ void
 dynamo_process_exit_with_thread_info(void)
 {
     perscache_fast_exit(); /* "fast" b/c called in release as well */
+    rewrite_cache_fast_exit();
 }
 
 /* shared between app_exit and detach */
@@ -2391,6 +2396,9 @@ dynamo_thread_init(byte *dstack_in, priv_mcontext_t *mc, void *os_data,
     fcache_thread_init(dcontext);
     link_thread_init(dcontext);
     fragment_thread_init(dcontext);
+    rewrite_template_thread_init(dcontext);
+    rewrite_arena_thread_init(dcontext);
+    rewrite_helper_thread_init(dcontext);
 
     /* OS thread init after synch_thread_init and other setup can handle signals, etc. */
     os_thread_init_finalize(dcontext, os_data);
@@ -2616,6 +2624,8 @@ dynamo_thread_exit_common(dcontext_t *dcontext, thread_id_t id,
     fcache_thread_exit(dcontext);
     link_thread_exit(dcontext);
     monitor_thread_exit(dcontext);
+    rewrite_template_thread_exit(dcontext);
+    rewrite_arena_thread_exit(dcontext);
     if (!DYNAMO_OPTION(thin_client))
         vm_areas_thread_exit(dcontext);
     synch_thread_exit(dcontext);
@@ -881,6 +881,8 @@ struct _dcontext_t {
     void *signal_field;
     void *pcprofile_field;
 #endif
+    void *avx512_template_field;
+    void *avx512_arena_field;
     void *private_code; /* various thread-private routines */
 
 #ifdef TRACE_HEAD_CACHE_INCR
@@ -69,6 +69,10 @@
 #    include "vmkuw.h" /* VMKUW_SYSCALL_GATEWAY */
 #endif
 
+#ifndef NOT_DYNAMORIO_CORE_PROPER
+#    include "rewrite_arena.h"
+#endif
+
 #if defined(DEBUG) && !defined(STANDALONE_DECODER)
 /* case 10450: give messages to clients */
 /* we can't undef ASSERT b/c of DYNAMO_OPTION */
@@ -80,12 +84,38 @@
 #    define ASSERT_NOT_REACHED DO_NOT_USE_ASSERT_USE_CLIENT_ASSERT_INSTEAD
 #endif
 
+/* instr_t objects and their operand arrays come from the AVX-512 rewrite arena
+ * while one is active for the thread, see rewrite_arena.c
+ */
+static void *
+instr_heap_alloc(dcontext_t *dcontext, size_t size)
+{
+#ifndef NOT_DYNAMORIO_CORE_PROPER
+    if (dcontext != GLOBAL_DCONTEXT && dcontext->avx512_arena_field != NULL) {
+        void *p = rewrite_arena_alloc(dcontext, size);
+        if (p != NULL)
+            return p;
+    }
+#endif
+    return heap_alloc(dcontext, size HEAPACCT(ACCT_IR));
+}
+
+static void
+instr_heap_free(dcontext_t *dcontext, void *p, size_t size)
+{
+#ifndef NOT_DYNAMORIO_CORE_PROPER
+    if (dcontext != GLOBAL_DCONTEXT && dcontext->avx512_arena_field != NULL && rewrite_arena_free(dcontext, p))
+        return;
+#endif
+    heap_free(dcontext, p, size HEAPACCT(ACCT_IR));
+}
+
 /* returns an empty instr_t object */
 instr_t *
 instr_create(void *drcontext)
 {
     dcontext_t *dcontext = (dcontext_t *)drcontext;
-    instr_t *instr = (instr_t *)heap_alloc(dcontext, sizeof(instr_t) HEAPACCT(ACCT_IR));
+    instr_t *instr = (instr_t *)instr_heap_alloc(dcontext, sizeof(instr_t));
     /* everything initializes to 0, even flags, to indicate
      * an uninitialized instruction */
     memset((void *)instr, 0, sizeof(instr_t));
@@ -112,7 +142,7 @@ instr_destroy(void *drcontext, instr_t *instr)
     instr_free(dcontext, instr);
 
     /* CAUTION: assumes that instr is not part of any instrlist */
-    heap_free(dcontext, instr, sizeof(instr_t) HEAPACCT(ACCT_IR));
+    instr_heap_free(dcontext, instr, sizeof(instr_t));
 }
 
 /* returns a clone of orig, but with next and prev fields set to NULL */
@@ -125,7 +155,7 @@ instr_clone(void *drcontext, instr_t *orig)
      */
     CLIENT_ASSERT(!TEST(INSTR_IS_NOALLOC_STRUCT, orig->flags), "Cloning an instr_noalloc_t is not supported.");
 
-    instr_t *instr = (instr_t *)heap_alloc(dcontext, sizeof(instr_t) HEAPACCT(ACCT_IR));
+    instr_t *instr = (instr_t *)instr_heap_alloc(dcontext, sizeof(instr_t));
     memcpy((void *)instr, (void *)orig, sizeof(instr_t));
     instr->next = NULL;
     instr->prev = NULL;
@@ -147,11 +177,11 @@ instr_clone(void *drcontext, instr_t *orig)
         instr_clear_label_callback(instr);
     }
     if (orig->num_dsts > 0) { /* checking num_dsts, not dsts, b/c of label data */
-        instr->dsts = (opnd_t *)heap_alloc(dcontext, instr->num_dsts * sizeof(opnd_t) HEAPACCT(ACCT_IR));
+        instr->dsts = (opnd_t *)instr_heap_alloc(dcontext, instr->num_dsts * sizeof(opnd_t));
         memcpy((void *)instr->dsts, (void *)orig->dsts, instr->num_dsts * sizeof(opnd_t));
     }
     if (orig->num_srcs > 1) { /* checking num_src, not srcs, b/c of label data */
-        instr->srcs = (opnd_t *)heap_alloc(dcontext, (instr->num_srcs - 1) * sizeof(opnd_t) HEAPACCT(ACCT_IR));
+        instr->srcs = (opnd_t *)instr_heap_alloc(dcontext, (instr->num_srcs - 1) * sizeof(opnd_t));
         memcpy((void *)instr->srcs, (void *)orig->srcs, (instr->num_srcs - 1) * sizeof(opnd_t));
     }
     /* copy note (we make no guarantee, and have no way, to do a deep clone) */
@@ -208,13 +238,13 @@ instr_free(void *drcontext, instr_t *instr)
         instr_free_raw_bits(dcontext, instr);
     }
     if (instr->num_dsts > 0) { /* checking num_dsts, not dsts, b/c of label data */
-        heap_free(dcontext, instr->dsts, instr->num_dsts * sizeof(opnd_t) HEAPACCT(ACCT_IR));
+        instr_heap_free(dcontext, instr->dsts, instr->num_dsts * sizeof(opnd_t));
         instr->dsts = NULL;
         instr->num_dsts = 0;
     }
     if (instr->num_srcs > 1) { /* checking num_src, not src, b/c of label data */
         /* remember one src is static, rest are dynamic */
-        heap_free(dcontext, instr->srcs, (instr->num_srcs - 1) * sizeof(opnd_t) HEAPACCT(ACCT_IR));
+        instr_heap_free(dcontext, instr->srcs, (instr->num_srcs - 1) * sizeof(opnd_t));
         instr->srcs = NULL;
         instr->num_srcs = 0;
     }
@@ -586,7 +616,7 @@ instr_set_num_opnds(void *drcontext, instr_t *instr, int instr_num_dsts, int ins
             instr_noalloc_t *noalloc = (instr_noalloc_t *)instr;
             noalloc->instr.dsts = noalloc->dsts;
         } else {
-            instr->dsts = (opnd_t *)heap_alloc(dcontext, instr_num_dsts * sizeof(opnd_t) HEAPACCT(ACCT_IR));
+            instr->dsts = (opnd_t *)instr_heap_alloc(dcontext, instr_num_dsts * sizeof(opnd_t));
         }
     }
     if (instr_num_srcs > 0) {
@@ -597,7 +627,7 @@ instr_set_num_opnds(void *drcontext, instr_t *instr, int instr_num_dsts, int ins
                 instr_noalloc_t *noalloc = (instr_noalloc_t *)instr;
                 noalloc->instr.srcs = noalloc->srcs;
             } else {
-                instr->srcs = (opnd_t *)heap_alloc(dcontext, (instr_num_srcs - 1) * sizeof(opnd_t) HEAPACCT(ACCT_IR));
+                instr->srcs = (opnd_t *)instr_heap_alloc(dcontext, (instr_num_srcs - 1) * sizeof(opnd_t));
             }
         }
         CLIENT_ASSERT_TRUNCATE(instr->num_srcs, byte, instr_num_srcs, "instr_set_num_opnds: too many srcs");
@@ -648,7 +678,7 @@ instr_remove_srcs(void *drcontext, instr_t *instr, uint start, uint end)
     CLIENT_ASSERT(start >= 0 && end <= instr->num_srcs && start < end, "instr_remove_srcs: ordinals invalid");
     if (instr->num_srcs - 1 > (byte)(end - start)) {
         new_srcs =
-            (opnd_t *)heap_alloc(dcontext, (instr->num_srcs - 1 - (end - start)) * sizeof(opnd_t) HEAPACCT(ACCT_IR));
+            (opnd_t *)instr_heap_alloc(dcontext, (instr->num_srcs - 1 - (end - start)) * sizeof(opnd_t));
         if (start > 1)
             memcpy(new_srcs, instr->srcs, (start - 1) * sizeof(opnd_t));
         if ((byte)end < instr->num_srcs - 1) {
@@ -659,7 +689,7 @@ instr_remove_srcs(void *drcontext, instr_t *instr, uint start, uint end)
         new_srcs = NULL;
     if (start == 0 && end < instr->num_srcs)
         instr->src0 = instr->srcs[end - 1];
-    heap_free(dcontext, instr->srcs, (instr->num_srcs - 1) * sizeof(opnd_t) HEAPACCT(ACCT_IR));
+    instr_heap_free(dcontext, instr->srcs, (instr->num_srcs - 1) * sizeof(opnd_t));
     instr->num_srcs -= (byte)(end - start);
     instr->srcs = new_srcs;
     instr_being_modified(instr, false /*raw bits invalid*/);
@@ -677,7 +707,7 @@ instr_remove_dsts(void *drcontext, instr_t *instr, uint start, uint end)
                   "instr_remove_srcs not supported for instr_noalloc_t");
     CLIENT_ASSERT(start >= 0 && end <= instr->num_dsts && start < end, "instr_remove_dsts: ordinals invalid");
     if (instr->num_dsts > (byte)(end - start)) {
-        new_dsts = (opnd_t *)heap_alloc(dcontext, (instr->num_dsts - (end - start)) * sizeof(opnd_t) HEAPACCT(ACCT_IR));
+        new_dsts = (opnd_t *)instr_heap_alloc(dcontext, (instr->num_dsts - (end - start)) * sizeof(opnd_t));
         if (start > 0)
             memcpy(new_dsts, instr->dsts, start * sizeof(opnd_t));
         if (end < instr->num_dsts) {
@@ -685,7 +715,7 @@ instr_remove_dsts(void *drcontext, instr_t *instr, uint start, uint end)
         }
     } else
         new_dsts = NULL;
-    heap_free(dcontext, instr->dsts, instr->num_dsts * sizeof(opnd_t) HEAPACCT(ACCT_IR));
+    instr_heap_free(dcontext, instr->dsts, instr->num_dsts * sizeof(opnd_t));
     instr->num_dsts -= (byte)(end - start);
     instr->dsts = new_dsts;
     instr_being_modified(instr, false /*raw bits invalid*/);
@@ -108,6 +108,15 @@ static const instr_info_t escape_3a_instr = { ESCAPE_3BYTE_3a,
                                               0,
                                               0,
                                               0 };
+/* used for EVEX map 5/6 (AVX512-FP16) decoding */
+static const instr_info_t evex_map5_instr = {
+    ESCAPE_EVEX_MAP5, 0x000000, DR_INSTR_CATEGORY_UNCATEGORIZED, "(bad)", xx, xx, xx, xx, xx, 0,
+    0,                0
+};
+static const instr_info_t evex_map6_instr = {
+    ESCAPE_EVEX_MAP6, 0x000000, DR_INSTR_CATEGORY_UNCATEGORIZED, "(bad)", xx, xx, xx, xx, xx, 0,
+    0,                0
+};
 /* used for XOP decoding */
 static const instr_info_t xop_8_instr = {
     XOP_8_EXT, 0x000000, DR_INSTR_CATEGORY_UNCATEGORIZED, "(bad)", xx, xx, xx, xx, xx, 0,
@@ -797,8 +806,10 @@ read_evex(byte *pc, decode_info_t *di, byte instr_byte,
     CLIENT_ASSERT(info->type == EVEX_PREFIX_EXT, "internal evex decoding error");
     /* If 32-bit mode and mod selects for memory, this is not evex */
     if (X64_MODE(di) || TESTALL(MODRM_BYTE(3, 0, 0), *pc)) {
-        /* P[3:2] must be 0 and P[10] must be 1, otherwise #UD */
-        if (TEST(0xC, *pc) || !TEST(0x04, *(pc + 1))) {
+        /* P[3] must be 0 and P[10] must be 1, otherwise #UD.  P[2] is the top bit
+         * of the map field since AVX512-FP16.
+         */
+        if (TEST(0x8, *pc) || !TEST(0x04, *(pc + 1))) {
             *ret_info = &invalid_instr;
             return pc;
         }
@@ -841,7 +852,8 @@ read_evex(byte *pc, decode_info_t *di, byte instr_byte,
     if (!TEST(0x10, prefix_byte))
         di->prefixes |= PREFIX_EVEX_RR;
 
-    byte evex_mm = instr_byte & 0x3;
+    /* The map field grew to 3 bits (mmm) with AVX512-FP16. */
+    byte evex_mm = instr_byte & 0x7;
 
     if (evex_mm == 1) {
         *ret_info = &escape_instr;
@@ -849,6 +861,10 @@ read_evex(byte *pc, decode_info_t *di, byte instr_byte,
         *ret_info = &escape_38_instr;
     } else if (evex_mm == 3) {
         *ret_info = &escape_3a_instr;
+    } else if (evex_mm == 5) {
+        *ret_info = &evex_map5_instr;
+    } else if (evex_mm == 6) {
+        *ret_info = &evex_map6_instr;
     } else {
         /* #UD: reserved for future use */
         *ret_info = &invalid_instr;
@@ -1076,6 +1092,14 @@ read_instruction(byte *pc, byte *orig_pc, const instr_info_t **ret_info,
             info = &third_byte_38[third_byte_38_index[instr_byte]];
         else
             info = &third_byte_3a[third_byte_3a_index[instr_byte]];
+    } else if (info->type == ESCAPE_EVEX_MAP5 || info->type == ESCAPE_EVEX_MAP6) {
+        /* the opcode byte directly follows the evex prefix */
+        instr_byte = *pc;
+        pc++;
+        if (info->type == ESCAPE_EVEX_MAP5)
+            info = &evex_map5[evex_map5_index[instr_byte]];
+        else
+            info = &evex_map6[evex_map6_index[instr_byte]];
     } else if (info->type == XOP_8_EXT || info->type == XOP_9_EXT ||
                info->type == XOP_A_EXT) {
         /* discard second byte, move to third */
@@ -1272,6 +1296,9 @@ read_instruction(byte *pc, byte *orig_pc, const instr_info_t **ret_info,
             info = NULL; /* invalid encoding */
         else if (TEST(REQUIRES_NOT_K0, info->flags) && di->evex_aaa == 0)
             info = NULL; /* invalid encoding */
+        else if (TEST(EVEX_L_LL_IS_ER, info->flags) && TEST(PREFIX_EVEX_b, di->prefixes) &&
+                 di->mod == 3)
+            di->prefixes |= PREFIX_EVEX_ER;
     } else if (info != NULL && !di->evex_encoded && TEST(REQUIRES_EVEX, info->flags))
         info = NULL; /* invalid encoding */
     /* XXX: not currently marking these cases as invalid instructions:
@@ -2276,13 +2303,14 @@ decode_get_compressed_disp_scale(decode_info_t *di)
         return -1;
     switch (tuple_type) {
     case DR_TUPLE_TYPE_FV:
-        CLIENT_ASSERT(input_size == OPSZ_4 || input_size == OPSZ_8,
+        /* OPSZ_2 is an AVX512-FP16 {1toN} half-precision broadcast */
+        CLIENT_ASSERT(input_size == OPSZ_2 || input_size == OPSZ_4 || input_size == OPSZ_8,
                       "invalid input size.");
         if (broadcast) {
             switch (vl) {
-            case OPSZ_16: return input_size == OPSZ_4 ? 4 : 8;
-            case OPSZ_32: return input_size == OPSZ_4 ? 4 : 8;
-            case OPSZ_64: return input_size == OPSZ_4 ? 4 : 8;
+            case OPSZ_16:
+            case OPSZ_32:
+            case OPSZ_64: return input_size == OPSZ_2 ? 2 : (input_size == OPSZ_4 ? 4 : 8);
             default: CLIENT_ASSERT(false, "invalid vector length.");
             }
         } else {
@@ -2667,6 +2695,9 @@ decode_common(dcontext_t *dcontext, byte *pc, byte *orig_pc, instr_t *instr)
         instr->prefixes |= PREFIX_SEG_FS;
     if (di.seg_override == SEG_GS)
         instr->prefixes |= PREFIX_SEG_GS;
+    /* as decode_cti does, so that a full decode finds the same avx512 instrs */
+    if (di.evex_encoded)
+        instr->prefixes |= PREFIX_EVEX;
 
     /* now copy operands into their real slots */
     instr_set_num_opnds(dcontext, instr, instr_num_dsts, instr_num_srcs);
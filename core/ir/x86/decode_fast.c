@@ -557,7 +557,7 @@ decode_sizeof_ex(void *drcontext, byte *start_pc, int *num_prefixes, uint *rip_r
                         opc = (uint) * (++pc); /* 3rd vex prefix byte */
                         sz += 1;
                     } else if (evex_prefix) {
-                        vex_mm = (byte)(opc & 0x3);
+                        vex_mm = (byte)(opc & 0x7);
                         opc = (uint) * (++pc); /* 3rd evex prefix byte */
                         sz += 1;
                         opc = (uint) * (++pc); /* 4th evex prefix byte */
@@ -580,6 +580,12 @@ decode_sizeof_ex(void *drcontext, byte *start_pc, int *num_prefixes, uint *rip_r
                     } else if (vex_mm == 3) {
                         sz += sizeof_3byte_3a(dcontext, pc - 1, addr16, &rip_rel_pc);
                         goto decode_sizeof_done;
+                    } else if (evex_prefix && (vex_mm == 5 || vex_mm == 6)) {
+                        /* AVX512-FP16 maps: the opcode byte directly follows the
+                         * prefix, all have modrm, none has an immediate
+                         */
+                        sz += 1 + sizeof_modrm(dcontext, pc + 1, addr16, &rip_rel_pc);
+                        goto decode_sizeof_done;
                     }
                 } else
                     found_prefix = false;
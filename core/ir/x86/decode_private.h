@@ -76,6 +76,10 @@
 #define PREFIX_EVEX_z 0x000800000
 #define PREFIX_EVEX_b 0x001000000
 #define PREFIX_EVEX_VV 0x002000000
+/* Register-form EVEX.b on an {er} template: L'L holds the rounding mode, not the
+ * vector length.  Kept in the instr so later passes need not re-read the template.
+ */
+#define PREFIX_EVEX_ER 0x004000000
 
 /* branch hints show up as segment modifiers */
 #define SEG_JCC_NOT_TAKEN SEG_CS
@@ -206,6 +210,10 @@ enum {
     ESCAPE_3BYTE_38,
     /* 3-byte opcodes beginning 0x0f 0x3a (SSE4) */
     ESCAPE_3BYTE_3a,
+    /* evex opcode map 5 (AVX512-FP16) */
+    ESCAPE_EVEX_MAP5,
+    /* evex opcode map 6 (AVX512-FP16) */
+    ESCAPE_EVEX_MAP6,
     /* instructions differing if a rex.b prefix is present */
     REX_B_EXT,
     /* instructions differing if a rex.w prefix is present */
@@ -546,6 +554,10 @@ extern const byte third_byte_38_index[256];
 extern const byte third_byte_3a_index[256];
 extern const instr_info_t third_byte_38[];
 extern const instr_info_t third_byte_3a[];
+extern const byte evex_map5_index[256];
+extern const byte evex_map6_index[256];
+extern const instr_info_t evex_map5[];
+extern const instr_info_t evex_map6[];
 extern const instr_info_t rep_extensions[][4];
 extern const instr_info_t repne_extensions[][6];
 extern const instr_info_t float_low_modrm[];
@@ -1635,6 +1635,26 @@ const instr_info_t * const op_instr[] =
     /* OP_xsaves64 */  &rex_w_extensions[6][1],
     /* OP_xrstors32 */  &rex_w_extensions[7][0],
     /* OP_xrstors64 */  &rex_w_extensions[7][1],
+
+    /* GFNI */
+    /* OP_gf2p8mulb */          &e_vex_extensions[153][0],
+    /* OP_vgf2p8mulb */         &e_vex_extensions[153][1],
+    /* OP_gf2p8affineqb */      &e_vex_extensions[154][0],
+    /* OP_vgf2p8affineqb */     &vex_W_extensions[114][1],
+    /* OP_gf2p8affineinvqb */   &e_vex_extensions[155][0],
+    /* OP_vgf2p8affineinvqb */  &vex_W_extensions[115][1],
+
+    /* AVX512 FP16 */
+    /* OP_vsqrtph */       &evex_Wb_extensions[277][0],
+    /* OP_vaddph */        &evex_Wb_extensions[278][0],
+    /* OP_vmulph */        &evex_Wb_extensions[279][0],
+    /* OP_vsubph */        &evex_Wb_extensions[280][0],
+    /* OP_vminph */        &evex_Wb_extensions[281][0],
+    /* OP_vdivph */        &evex_Wb_extensions[282][0],
+    /* OP_vmaxph */        &evex_Wb_extensions[283][0],
+    /* OP_vfmadd132ph */   &evex_Wb_extensions[284][0],
+    /* OP_vfmadd213ph */   &evex_Wb_extensions[285][0],
+    /* OP_vfmadd231ph */   &evex_Wb_extensions[286][0],
 };
 
 
@@ -5885,6 +5905,156 @@ const instr_info_t prefix_extensions[][12] = {
     {EVEX_Wb_EXT,0xf3387208, catUncategorized, "(evex_Wb ext 272)", xx, xx, xx, xx, xx, mrm|evex|ttnone, x, 272},
     {INVALID,    0x66387218, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
     {EVEX_Wb_EXT,0xf2387218, catUncategorized, "(evex_Wb ext 271)",   xx, xx, xx, xx, xx, mrm|evex|ttnone, x, 271},
+  }, { /* prefix extension 191 */
+    {INVALID,      0x055108, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3055108, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055108, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055108, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* vex */
+    {INVALID,      0x055108, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3055108, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055108, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055108, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* evex */
+    {EVEX_Wb_EXT,  0x055108, catUncategorized, "(evex_Wb ext 277)", xx, xx, xx, xx, xx, mrm|evex, x, 277},
+    {INVALID,    0xf3055108, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055108, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055108, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* prefix extension 192 */
+    {INVALID,      0x055808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3055808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* vex */
+    {INVALID,      0x055808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3055808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* evex */
+    {EVEX_Wb_EXT,  0x055808, catUncategorized, "(evex_Wb ext 278)", xx, xx, xx, xx, xx, mrm|evex, x, 278},
+    {INVALID,    0xf3055808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* prefix extension 193 */
+    {INVALID,      0x055908, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3055908, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055908, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055908, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* vex */
+    {INVALID,      0x055908, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3055908, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055908, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055908, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* evex */
+    {EVEX_Wb_EXT,  0x055908, catUncategorized, "(evex_Wb ext 279)", xx, xx, xx, xx, xx, mrm|evex, x, 279},
+    {INVALID,    0xf3055908, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055908, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055908, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* prefix extension 194 */
+    {INVALID,      0x055c08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3055c08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055c08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055c08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* vex */
+    {INVALID,      0x055c08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3055c08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055c08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055c08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* evex */
+    {EVEX_Wb_EXT,  0x055c08, catUncategorized, "(evex_Wb ext 280)", xx, xx, xx, xx, xx, mrm|evex, x, 280},
+    {INVALID,    0xf3055c08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055c08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055c08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* prefix extension 195 */
+    {INVALID,      0x055d08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3055d08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055d08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055d08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* vex */
+    {INVALID,      0x055d08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3055d08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055d08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055d08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* evex */
+    {EVEX_Wb_EXT,  0x055d08, catUncategorized, "(evex_Wb ext 281)", xx, xx, xx, xx, xx, mrm|evex, x, 281},
+    {INVALID,    0xf3055d08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055d08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055d08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* prefix extension 196 */
+    {INVALID,      0x055e08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3055e08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055e08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055e08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* vex */
+    {INVALID,      0x055e08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3055e08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055e08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055e08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* evex */
+    {EVEX_Wb_EXT,  0x055e08, catUncategorized, "(evex_Wb ext 282)", xx, xx, xx, xx, xx, mrm|evex, x, 282},
+    {INVALID,    0xf3055e08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055e08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055e08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* prefix extension 197 */
+    {INVALID,      0x055f08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3055f08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055f08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055f08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* vex */
+    {INVALID,      0x055f08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3055f08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055f08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055f08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* evex */
+    {EVEX_Wb_EXT,  0x055f08, catUncategorized, "(evex_Wb ext 283)", xx, xx, xx, xx, xx, mrm|evex, x, 283},
+    {INVALID,    0xf3055f08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66055f08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2055f08, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* prefix extension 198 */
+    {INVALID,      0x069808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3069808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66069808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2069808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* vex */
+    {INVALID,      0x069808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3069808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x66069808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf2069808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* evex */
+    {INVALID,      0x069808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf3069808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {EVEX_Wb_EXT,0x66069808, catUncategorized, "(evex_Wb ext 284)", xx, xx, xx, xx, xx, mrm|evex, x, 284},
+    {INVALID,    0xf2069808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* prefix extension 199 */
+    {INVALID,      0x06a808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf306a808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x6606a808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf206a808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* vex */
+    {INVALID,      0x06a808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf306a808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x6606a808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf206a808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* evex */
+    {INVALID,      0x06a808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf306a808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {EVEX_Wb_EXT,0x6606a808, catUncategorized, "(evex_Wb ext 285)", xx, xx, xx, xx, xx, mrm|evex, x, 285},
+    {INVALID,    0xf206a808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* prefix extension 200 */
+    {INVALID,      0x06b808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf306b808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x6606b808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf206b808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* vex */
+    {INVALID,      0x06b808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf306b808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0x6606b808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf206b808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    /* evex */
+    {INVALID,      0x06b808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID,    0xf306b808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
+    {EVEX_Wb_EXT,0x6606b808, catUncategorized, "(evex_Wb ext 286)", xx, xx, xx, xx, xx, mrm|evex, x, 286},
+    {INVALID,    0xf206b808, catUncategorized, "(bad)",   xx, xx, xx, xx, xx, no, x, NA},
   }
 };
 /****************************************************************************
@@ -6029,20 +6199,20 @@ const instr_info_t e_vex_extensions[][3] = {
     {INVALID, 0x6638db18, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
   }, { /* e_vex ext 32 */
     {OP_aesenc,  0x6638dc18, catSIMD, "aesenc",  Vdq, xx, Wdq,Vdq, xx, mrm|reqp, x, END_LIST},
-    {OP_vaesenc, 0x6638dc18, catSIMD, "vaesenc",  Vdq, xx, Hdq,Wdq, xx, mrm|vex|reqp, x, END_LIST},
-    {INVALID, 0x6638dc18, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {OP_vaesenc, 0x6638dc18, catSIMD, "vaesenc", Vx, xx, Hx, Wx, xx, mrm|vex|reqp, x, tvex[32][2]},
+    {OP_vaesenc, 0x6638dc08, catSIMD, "vaesenc", Ve, xx, He, We, xx, mrm|evex|reqp|ttfvm, x, END_LIST},
   }, { /* e_vex ext 33 */
     {OP_aesenclast,  0x6638dd18, catSIMD, "aesenclast",Vdq,xx,Wdq,Vdq,xx, mrm|reqp, x, END_LIST},
-    {OP_vaesenclast, 0x6638dd18, catSIMD, "vaesenclast",Vdq,xx,Hdq,Wdq,xx, mrm|vex|reqp, x, END_LIST},
-    {INVALID, 0x6638dd18, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {OP_vaesenclast, 0x6638dd18, catSIMD, "vaesenclast", Vx, xx, Hx, Wx, xx, mrm|vex|reqp, x, tvex[33][2]},
+    {OP_vaesenclast, 0x6638dd08, catSIMD, "vaesenclast", Ve, xx, He, We, xx, mrm|evex|reqp|ttfvm, x, END_LIST},
   }, { /* e_vex ext 34 */
     {OP_aesdec,  0x6638de18, catSIMD, "aesdec",  Vdq, xx, Wdq,Vdq, xx, mrm|reqp, x, END_LIST},
-    {OP_vaesdec, 0x6638de18, catSIMD, "vaesdec",  Vdq, xx, Hdq,Wdq, xx, mrm|vex|reqp, x, END_LIST},
-    {INVALID, 0x6638de18, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {OP_vaesdec, 0x6638de18, catSIMD, "vaesdec", Vx, xx, Hx, Wx, xx, mrm|vex|reqp, x, tvex[34][2]},
+    {OP_vaesdec, 0x6638de08, catSIMD, "vaesdec", Ve, xx, He, We, xx, mrm|evex|reqp|ttfvm, x, END_LIST},
   }, { /* e_vex ext 35 */
     {OP_aesdeclast,  0x6638df18, catSIMD, "aesdeclast",Vdq,xx,Wdq,Vdq,xx, mrm|reqp, x, END_LIST},
-    {OP_vaesdeclast, 0x6638df18, catSIMD, "vaesdeclast",Vdq,xx,Hdq,Wdq,xx, mrm|vex|reqp, x, END_LIST},
-    {INVALID, 0x6638df18, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {OP_vaesdeclast, 0x6638df18, catSIMD, "vaesdeclast", Vx, xx, Hx, Wx, xx, mrm|vex|reqp, x, tvex[35][2]},
+    {OP_vaesdeclast, 0x6638df08, catSIMD, "vaesdeclast", Ve, xx, He, We, xx, mrm|evex|reqp|ttfvm, x, END_LIST},
   }, { /* e_vex ext 36 */
     {OP_pextrb,   0x663a1418, catSIMD, "pextrb", Rd_Mb, xx, Vb_dq, Ib, xx, mrm|reqp, x, END_LIST},
     {OP_vpextrb,  0x663a1418, catSIMD, "vpextrb", Rd_Mb, xx, Vb_dq, Ib, xx, mrm|vex|reqp, x, tvex[36][2]},
@@ -6130,8 +6300,8 @@ const instr_info_t e_vex_extensions[][3] = {
     {INVALID, 0x663a6318, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
   }, { /* e_vex ext 57 */
     {OP_pclmulqdq, 0x663a4418, catSIMD, "pclmulqdq", Vdq, xx, Wdq, Ib, Vdq, mrm|reqp, x, END_LIST},
-    {OP_vpclmulqdq,0x663a4418, catSIMD, "vpclmulqdq", Vdq, xx, Hdq, Wdq, Ib, mrm|vex|reqp, x, END_LIST},
-    {INVALID, 0x663a4418, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {OP_vpclmulqdq,0x663a4418, catSIMD, "vpclmulqdq", Vx, xx, Hx, Wx, Ib, mrm|vex|reqp, x, tvex[57][2]},
+    {OP_vpclmulqdq,0x663a4408, catSIMD, "vpclmulqdq", Ve, xx, He, We, Ib, mrm|evex|reqp|ttfvm, x, END_LIST},
   }, { /* e_vex ext 58 */
     {OP_aeskeygenassist, 0x663adf18, catSIMD, "aeskeygenassist",Vdq,xx,Wdq,Ib,xx,mrm|reqp,x,END_LIST},
     {OP_vaeskeygenassist,0x663adf18, catSIMD, "vaeskeygenassist",Vdq,xx,Wdq,Ib,xx,mrm|vex|reqp,x,END_LIST},
@@ -6512,6 +6682,18 @@ const instr_info_t e_vex_extensions[][3] = {
     {INVALID, 0x385308, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
     {VEX_W_EXT, 0x385308, catUncategorized, "(vex_W ext 113)", xx, xx, xx, xx, xx, mrm|vex|reqp|ttfvm, x, 113},
     {EVEX_Wb_EXT, 0x385308, catUncategorized, "(evex_Wb ext 270)", xx, xx, xx, xx, xx, mrm|reqp, x, 270},
+  }, { /* e_vex ext 153 */
+    {OP_gf2p8mulb, 0x6638cf18, catSIMD, "gf2p8mulb", Vdq, xx, Wdq, Vdq, xx, mrm|reqp, x, END_LIST},
+    {OP_vgf2p8mulb, 0x6638cf18, catSIMD, "vgf2p8mulb", Vx, xx, Hx, Wx, xx, mrm|vex|reqp, x, tvex[153][2]},
+    {OP_vgf2p8mulb, 0x6638cf08, catSIMD, "vgf2p8mulb", Ve, xx, KEq, He, We, mrm|evex|reqp|ttfvm, x, END_LIST},
+  }, { /* e_vex ext 154 */
+    {OP_gf2p8affineqb, 0x663ace18, catSIMD, "gf2p8affineqb", Vdq, xx, Wdq, Ib, Vdq, mrm|reqp, x, END_LIST},
+    {VEX_W_EXT, 0x663ace18, catUncategorized, "(vex_W ext 114)", xx, xx, xx, xx, xx, mrm|vex|reqp, x, 114},
+    {EVEX_Wb_EXT, 0x663ace18, catUncategorized, "(evex_Wb ext 275)", xx, xx, xx, xx, xx, mrm|evex|reqp, x, 275},
+  }, { /* e_vex ext 155 */
+    {OP_gf2p8affineinvqb, 0x663acf18, catSIMD, "gf2p8affineinvqb", Vdq, xx, Wdq, Ib, Vdq, mrm|reqp, x, END_LIST},
+    {VEX_W_EXT, 0x663acf18, catUncategorized, "(vex_W ext 115)", xx, xx, xx, xx, xx, mrm|vex|reqp, x, 115},
+    {EVEX_Wb_EXT, 0x663acf18, catUncategorized, "(evex_Wb ext 276)", xx, xx, xx, xx, xx, mrm|evex|reqp, x, 276},
   },
 };
 
@@ -7014,6 +7196,36 @@ const instr_info_t mod_extensions[][2] = {
   { /* mod extension 120 */
     {INVALID, 0x0f0135, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, END_LIST},
     {RM_EXT,  0x0f0175, catUncategorized, "(group 7 mod + rm ext 5)", xx, xx, xx, xx, xx, mrm, x, 5},
+  }, { /* mod extension 121 */
+    {OP_vsqrtph, 0x055118, catFP | catMath | catSIMD, "vsqrtph", Ve, xx, KEd, Mw, xx, mrm|evex|ttfv|inopsz2, x, modx[121][1]},
+    {OP_vsqrtph, 0x055118, catFP | catMath | catSIMD, "vsqrtph", Voq, xx, KEd, Uoq, xx, mrm|evex|er|ttfv, x, END_LIST},
+  }, { /* mod extension 122 */
+    {OP_vaddph, 0x055818, catFP | catMath | catSIMD, "vaddph", Ve, xx, KEd, He, Mw, mrm|evex|ttfv|inopsz2, x, modx[122][1]},
+    {OP_vaddph, 0x055818, catFP | catMath | catSIMD, "vaddph", Voq, xx, KEd, Hoq, Uoq, mrm|evex|er|ttfv, x, END_LIST},
+  }, { /* mod extension 123 */
+    {OP_vmulph, 0x055918, catFP | catMath | catSIMD, "vmulph", Ve, xx, KEd, He, Mw, mrm|evex|ttfv|inopsz2, x, modx[123][1]},
+    {OP_vmulph, 0x055918, catFP | catMath | catSIMD, "vmulph", Voq, xx, KEd, Hoq, Uoq, mrm|evex|er|ttfv, x, END_LIST},
+  }, { /* mod extension 124 */
+    {OP_vsubph, 0x055c18, catFP | catMath | catSIMD, "vsubph", Ve, xx, KEd, He, Mw, mrm|evex|ttfv|inopsz2, x, modx[124][1]},
+    {OP_vsubph, 0x055c18, catFP | catMath | catSIMD, "vsubph", Voq, xx, KEd, Hoq, Uoq, mrm|evex|er|ttfv, x, END_LIST},
+  }, { /* mod extension 125 */
+    {OP_vminph, 0x055d18, catFP | catMath | catSIMD, "vminph", Ve, xx, KEd, He, Mw, mrm|evex|ttfv|inopsz2, x, modx[125][1]},
+    {OP_vminph, 0x055d18, catFP | catMath | catSIMD, "vminph", Voq, xx, KEd, Hoq, Uoq, mrm|evex|sae|ttfv, x, END_LIST},
+  }, { /* mod extension 126 */
+    {OP_vdivph, 0x055e18, catFP | catMath | catSIMD, "vdivph", Ve, xx, KEd, He, Mw, mrm|evex|ttfv|inopsz2, x, modx[126][1]},
+    {OP_vdivph, 0x055e18, catFP | catMath | catSIMD, "vdivph", Voq, xx, KEd, Hoq, Uoq, mrm|evex|er|ttfv, x, END_LIST},
+  }, { /* mod extension 127 */
+    {OP_vmaxph, 0x055f18, catFP | catMath | catSIMD, "vmaxph", Ve, xx, KEd, He, Mw, mrm|evex|ttfv|inopsz2, x, modx[127][1]},
+    {OP_vmaxph, 0x055f18, catFP | catMath | catSIMD, "vmaxph", Voq, xx, KEd, Hoq, Uoq, mrm|evex|sae|ttfv, x, END_LIST},
+  }, { /* mod extension 128 */
+    {OP_vfmadd132ph, 0x66069818, catFP | catMath | catSIMD, "vfmadd132ph", Ve, xx, KEd, He, Mw, xop|mrm|evex|ttfv|inopsz2, x, exop[262]},
+    {OP_vfmadd132ph, 0x66069818, catFP | catMath | catSIMD, "vfmadd132ph", Voq, xx, KEd, Hoq, Uoq, xop|mrm|evex|er|ttfv, x, exop[263]},
+  }, { /* mod extension 129 */
+    {OP_vfmadd213ph, 0x6606a818, catFP | catMath | catSIMD, "vfmadd213ph", Ve, xx, KEd, He, Mw, xop|mrm|evex|ttfv|inopsz2, x, exop[265]},
+    {OP_vfmadd213ph, 0x6606a818, catFP | catMath | catSIMD, "vfmadd213ph", Voq, xx, KEd, Hoq, Uoq, xop|mrm|evex|er|ttfv, x, exop[266]},
+  }, { /* mod extension 130 */
+    {OP_vfmadd231ph, 0x6606b818, catFP | catMath | catSIMD, "vfmadd231ph", Ve, xx, KEd, He, Mw, xop|mrm|evex|ttfv|inopsz2, x, exop[268]},
+    {OP_vfmadd231ph, 0x6606b818, catFP | catMath | catSIMD, "vfmadd231ph", Voq, xx, KEd, Hoq, Uoq, xop|mrm|evex|er|ttfv, x, exop[269]},
   },
 };
 
@@ -7290,7 +7502,7 @@ const byte third_byte_38_index[256] = {
    104,105,106,107,   0,  0, 58, 59,  60, 61, 62, 63,  64, 65, 66, 67,  /* 9 */
    159,160,161,162,   0,  0, 68, 69,  70, 71, 72, 73,  74, 75, 76, 77,  /* A */
      0,  0,  0,  0, 157,158, 78, 79,  80, 81, 82, 83,  84, 85, 86, 87,  /* B */
-     0,  0,  0,  0, 155,  0,163,164, 154,165,131,132, 152,153,  0,  0,  /* C */
+     0,  0,  0,  0, 155,  0,163,164, 154,165,131,132, 152,153,  0,172,  /* C */
      0,  0,  0,  0,   0,  0,  0,  0,   0,  0,  0, 51,  52, 53, 54, 55,  /* D */
      0,  0,  0,  0,   0,  0,  0,  0,   0,  0,  0,  0,   0,  0,  0,  0,  /* E */
     47, 48,100, 99,   0,101,102, 98,   0,  0,  0,  0,   0,  0,  0,  0   /* F */
@@ -7488,7 +7700,9 @@ const instr_info_t third_byte_38[] = {
   {E_VEX_EXT, 0x66385308, catUncategorized, "(e_vex ext 152)", xx, xx, xx, xx, xx, mrm|evex|reqp, x, 152},/*169*/
   {PREFIX_EXT, 0x387208, catUncategorized, "(prefix ext 190)", xx, xx, xx, xx, xx, mrm|evex, x, 190},/*170*/
   /* AVX512 VPOPCNTDQ */
-  {EVEX_Wb_EXT, 0x66385518, catUncategorized, "(evex_Wb ext 274)", xx, xx, xx, xx, xx, mrm|evex|reqp, x, 274}/*171*/
+  {EVEX_Wb_EXT, 0x66385518, catUncategorized, "(evex_Wb ext 274)", xx, xx, xx, xx, xx, mrm|evex|reqp, x, 274},/*171*/
+  /* GFNI */
+  {E_VEX_EXT, 0x6638cf18, catUncategorized, "(e_vex ext 153)", xx, xx, xx, xx, xx, mrm, x, 153},/*172*/
 };
 
 /* N.B.: every 0x3a instr so far has an immediate.  If a version w/o an immed
@@ -7508,7 +7722,7 @@ const byte third_byte_3a_index[256] = {
      0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 9 */
      0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* A */
      0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* B */
-     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0, 89, 0, 0, 0,  /* C */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0, 89, 0,90,91,  /* C */
      0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0,24,  /* D */
      0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* E */
     56, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0   /* F */
@@ -7617,6 +7831,9 @@ const instr_info_t third_byte_3a[] = {
   {EVEX_Wb_EXT, 0x663a2518, catUncategorized, "(evex_Wb ext 188)", xx, xx, xx, xx, xx, mrm, x, 188},/*88*/
   /* SHA */
   {OP_sha1rnds4, 0x3acc18, catUncategorized, "sha1rnds4", Vdq, xx, Wdq, Ib, Vdq, mrm|reqp, x, END_LIST},/*89*/
+  /* GFNI */
+  {E_VEX_EXT, 0x663ace18, catUncategorized, "(e_vex ext 154)", xx, xx, xx, xx, xx, mrm, x, 154},/*90*/
+  {E_VEX_EXT, 0x663acf18, catUncategorized, "(e_vex ext 155)", xx, xx, xx, xx, xx, mrm, x, 155},/*91*/
 };
 
 /****************************************************************************
@@ -7970,6 +8187,12 @@ const instr_info_t vex_W_extensions[][2] = {
   }, { /* vex_W_ext 113 */
     {OP_vpdpwssds, 0x66385308, catUncategorized, "vpdpwssds", Ve, xx, He, We, xx, mrm|vex|ttfvm|reqp, x, tevexwb[270][0]},
     {INVALID,    0x663850, catUncategorized,   "(bad)", xx,xx, xx,  xx,xx,     no,x,NA},
+  }, { /* vex_W_ext 114 */
+    {INVALID, 0x663ace18, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {OP_vgf2p8affineqb, 0x663ace58, catSIMD, "vgf2p8affineqb", Vx, xx, Hx, Wx, Ib, mrm|vex|reqp, x, tevexwb[275][2]},
+  }, { /* vex_W_ext 115 */
+    {INVALID, 0x663acf18, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {OP_vgf2p8affineinvqb, 0x663acf58, catSIMD, "vgf2p8affineinvqb", Vx, xx, Hx, Wx, Ib, mrm|vex|reqp, x, tevexwb[276][2]},
   },
 };
 
@@ -8530,9 +8753,9 @@ const instr_info_t evex_Wb_extensions[][4] = {
     {OP_vinsertf64x2, 0x663a1848, catSIMD, "vinsertf64x2", Vf, xx, KEb, Ib, Hdq_f, xop|mrm|evex|reqp|ttt2, x, exop[171]},
     {INVALID, 0x663a1858, catUncategorized, "(bad)", xx,xx,xx,xx,xx,no,x,NA},
   }, { /* evex_W_ext 106 */
-    {OP_vinsertf32x8, 0x663a1a08, catSIMD, "vinsertf32x8", Voq, xx, KEw, Ib, Hdq_f, xop|mrm|evex|reqp|ttt8, x, exop[172]},
+    {OP_vinsertf32x8, 0x663a1a08, catSIMD, "vinsertf32x8", Voq, xx, KEw, Ib, Hoq, xop|mrm|evex|reqp|ttt8, x, exop[172]},
     {INVALID, 0x663a1a18, catUncategorized, "(bad)", xx,xx,xx,xx,xx,no,x,NA},
-    {OP_vinsertf64x4, 0x663a1a48, catSIMD, "vinsertf64x4", Voq, xx, KEb, Ib, Hdq_f, xop|mrm|evex|reqp|ttt4, x, exop[173]},
+    {OP_vinsertf64x4, 0x663a1a48, catSIMD, "vinsertf64x4", Voq, xx, KEb, Ib, Hoq, xop|mrm|evex|reqp|ttt4, x, exop[173]},
     {INVALID, 0x663a1858, catUncategorized, "(bad)", xx,xx,xx,xx,xx,no,x,NA},
   }, { /* evex_W_ext 107 */
     {OP_vinserti32x4, 0x663a3808, catSIMD, "vinserti32x4", Vf, xx, KEw, Ib, Hdq_f, xop|mrm|evex|reqp|ttt4, x, exop[174]},
@@ -8540,9 +8763,9 @@ const instr_info_t evex_Wb_extensions[][4] = {
     {OP_vinserti64x2, 0x663a3848, catSIMD, "vinserti64x2", Vf, xx, KEb, Ib, Hdq_f, xop|mrm|evex|reqp|ttt2, x, exop[175]},
     {INVALID, 0x663a3858, catUncategorized, "(bad)", xx,xx,xx,xx,xx,no,x,NA},
   }, { /* evex_W_ext 108 */
-    {OP_vinserti32x8, 0x663a3a08, catSIMD, "vinserti32x8", Voq, xx, KEw, Ib, Hdq_f, xop|mrm|evex|reqp|ttt8, x, exop[176]},
+    {OP_vinserti32x8, 0x663a3a08, catSIMD, "vinserti32x8", Voq, xx, KEw, Ib, Hoq, xop|mrm|evex|reqp|ttt8, x, exop[176]},
     {INVALID, 0x663a3a18, catUncategorized, "(bad)", xx,xx,xx,xx,xx,no,x,NA},
-    {OP_vinserti64x4, 0x663a3a48, catSIMD, "vinserti64x4", Voq, xx, KEb, Ib, Hdq_f, xop|mrm|evex|reqp|ttt4, x, exop[177]},
+    {OP_vinserti64x4, 0x663a3a48, catSIMD, "vinserti64x4", Voq, xx, KEb, Ib, Hoq, xop|mrm|evex|reqp|ttt4, x, exop[177]},
     {INVALID, 0x663a3a58, catUncategorized, "(bad)", xx,xx,xx,xx,xx,no,x,NA},
   }, { /* evex_W_ext 109 */
     {OP_vpcmpub, 0x663a3e08, catSIMD, "vpcmpub", KPq, xx, KEq, Ib, He, xop|evex|mrm|reqp|ttfvm, x, exop[178]},
@@ -9404,9 +9627,130 @@ const instr_info_t evex_Wb_extensions[][4] = {
     {OP_vpopcntd, 0x66385518, catUncategorized, "vpopcntd", Ve, xx, KEd, Md, xx, mrm|evex|ttfv|reqp, x, END_LIST},
     {OP_vpopcntq, 0x66385548, catUncategorized, "vpopcntq", Ve, xx, KEq, We, xx, mrm|evex|ttfv|reqp, x, tevexwb[274][3]},
     {OP_vpopcntq, 0x66385558, catUncategorized, "vpopcntq", Ve, xx, KEq, Mq, xx, mrm|evex|ttfv|reqp, x, END_LIST},
+  }, { /* evex_W_ext 275 */
+    {INVALID, 0x663ace08, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID, 0x663ace18, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {OP_vgf2p8affineqb, 0x663ace48, catSIMD, "vgf2p8affineqb", Ve, xx, KEq, Ib, He, xop|mrm|evex|reqp|ttfv, x, exop[257]},
+    {OP_vgf2p8affineqb, 0x663ace58, catSIMD, "vgf2p8affineqb", Ve, xx, KEq, Ib, He, xop|mrm|evex|reqp|ttfv, x, exop[258]},
+  }, { /* evex_W_ext 276 */
+    {INVALID, 0x663acf08, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID, 0x663acf18, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {OP_vgf2p8affineinvqb, 0x663acf48, catSIMD, "vgf2p8affineinvqb", Ve, xx, KEq, Ib, He, xop|mrm|evex|reqp|ttfv, x, exop[259]},
+    {OP_vgf2p8affineinvqb, 0x663acf58, catSIMD, "vgf2p8affineinvqb", Ve, xx, KEq, Ib, He, xop|mrm|evex|reqp|ttfv, x, exop[260]},
+  }, { /* evex_W_ext 277 */
+    {OP_vsqrtph, 0x055108, catFP | catMath | catSIMD, "vsqrtph", Ve, xx, KEd, We, xx, mrm|evex|ttfv|inopsz2, x, modx[121][0]},
+    {MOD_EXT, 0x055118, catUncategorized, "(mod ext 121)", xx, xx, xx, xx, xx, mrm|evex, x, 121},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* evex_W_ext 278 */
+    {OP_vaddph, 0x055808, catFP | catMath | catSIMD, "vaddph", Ve, xx, KEd, He, We, mrm|evex|ttfv|inopsz2, x, modx[122][0]},
+    {MOD_EXT, 0x055818, catUncategorized, "(mod ext 122)", xx, xx, xx, xx, xx, mrm|evex, x, 122},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* evex_W_ext 279 */
+    {OP_vmulph, 0x055908, catFP | catMath | catSIMD, "vmulph", Ve, xx, KEd, He, We, mrm|evex|ttfv|inopsz2, x, modx[123][0]},
+    {MOD_EXT, 0x055918, catUncategorized, "(mod ext 123)", xx, xx, xx, xx, xx, mrm|evex, x, 123},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* evex_W_ext 280 */
+    {OP_vsubph, 0x055c08, catFP | catMath | catSIMD, "vsubph", Ve, xx, KEd, He, We, mrm|evex|ttfv|inopsz2, x, modx[124][0]},
+    {MOD_EXT, 0x055c18, catUncategorized, "(mod ext 124)", xx, xx, xx, xx, xx, mrm|evex, x, 124},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* evex_W_ext 281 */
+    {OP_vminph, 0x055d08, catFP | catMath | catSIMD, "vminph", Ve, xx, KEd, He, We, mrm|evex|ttfv|inopsz2, x, modx[125][0]},
+    {MOD_EXT, 0x055d18, catUncategorized, "(mod ext 125)", xx, xx, xx, xx, xx, mrm|evex, x, 125},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* evex_W_ext 282 */
+    {OP_vdivph, 0x055e08, catFP | catMath | catSIMD, "vdivph", Ve, xx, KEd, He, We, mrm|evex|ttfv|inopsz2, x, modx[126][0]},
+    {MOD_EXT, 0x055e18, catUncategorized, "(mod ext 126)", xx, xx, xx, xx, xx, mrm|evex, x, 126},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* evex_W_ext 283 */
+    {OP_vmaxph, 0x055f08, catFP | catMath | catSIMD, "vmaxph", Ve, xx, KEd, He, We, mrm|evex|ttfv|inopsz2, x, modx[127][0]},
+    {MOD_EXT, 0x055f18, catUncategorized, "(mod ext 127)", xx, xx, xx, xx, xx, mrm|evex, x, 127},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* evex_W_ext 284 */
+    {OP_vfmadd132ph, 0x66069808, catFP | catMath | catSIMD, "vfmadd132ph", Ve, xx, KEd, He, We, xop|mrm|evex|ttfv|inopsz2, x, exop[261]},
+    {MOD_EXT, 0x66069818, catUncategorized, "(mod ext 128)", xx, xx, xx, xx, xx, mrm|evex, x, 128},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* evex_W_ext 285 */
+    {OP_vfmadd213ph, 0x6606a808, catFP | catMath | catSIMD, "vfmadd213ph", Ve, xx, KEd, He, We, xop|mrm|evex|ttfv|inopsz2, x, exop[264]},
+    {MOD_EXT, 0x6606a818, catUncategorized, "(mod ext 129)", xx, xx, xx, xx, xx, mrm|evex, x, 129},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+  }, { /* evex_W_ext 286 */
+    {OP_vfmadd231ph, 0x6606b808, catFP | catMath | catSIMD, "vfmadd231ph", Ve, xx, KEd, He, We, xop|mrm|evex|ttfv|inopsz2, x, exop[267]},
+    {MOD_EXT, 0x6606b818, catUncategorized, "(mod ext 130)", xx, xx, xx, xx, xx, mrm|evex, x, 130},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
+    {INVALID, 0, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},
   },
 };
 
+/****************************************************************************
+ * EVEX opcode maps 5 and 6 (AVX512-FP16)
+ * N.B.: every map 5/6 instr has a modrm and none has an immediate, which
+ * decode_fast relies on.
+ */
+const byte evex_map5_index[256] = {
+  /* 0  1  2  3   4  5  6  7   8  9  A  B   C  D  E  F */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 0 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 1 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 2 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 3 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 4 */
+     0, 1, 0, 0,  0, 0, 0, 0,  2, 3, 0, 0,  4, 5, 6, 7,  /* 5 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 6 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 7 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 8 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 9 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* A */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* B */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* C */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* D */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* E */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0   /* F */
+};
+const instr_info_t evex_map5[] = {
+  {INVALID,     0x05ff08, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},              /* 0*/
+  {PREFIX_EXT,  0x055108, catUncategorized, "(prefix ext 191)", xx, xx, xx, xx, xx, mrm, x, 191},/* 1*/
+  {PREFIX_EXT,  0x055808, catUncategorized, "(prefix ext 192)", xx, xx, xx, xx, xx, mrm, x, 192},/* 2*/
+  {PREFIX_EXT,  0x055908, catUncategorized, "(prefix ext 193)", xx, xx, xx, xx, xx, mrm, x, 193},/* 3*/
+  {PREFIX_EXT,  0x055c08, catUncategorized, "(prefix ext 194)", xx, xx, xx, xx, xx, mrm, x, 194},/* 4*/
+  {PREFIX_EXT,  0x055d08, catUncategorized, "(prefix ext 195)", xx, xx, xx, xx, xx, mrm, x, 195},/* 5*/
+  {PREFIX_EXT,  0x055e08, catUncategorized, "(prefix ext 196)", xx, xx, xx, xx, xx, mrm, x, 196},/* 6*/
+  {PREFIX_EXT,  0x055f08, catUncategorized, "(prefix ext 197)", xx, xx, xx, xx, xx, mrm, x, 197},/* 7*/
+};
+
+const byte evex_map6_index[256] = {
+  /* 0  1  2  3   4  5  6  7   8  9  A  B   C  D  E  F */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 0 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 1 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 2 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 3 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 4 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 5 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 6 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 7 */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* 8 */
+     0, 0, 0, 0,  0, 0, 0, 0,  1, 0, 0, 0,  0, 0, 0, 0,  /* 9 */
+     0, 0, 0, 0,  0, 0, 0, 0,  2, 0, 0, 0,  0, 0, 0, 0,  /* A */
+     0, 0, 0, 0,  0, 0, 0, 0,  3, 0, 0, 0,  0, 0, 0, 0,  /* B */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* C */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* D */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  /* E */
+     0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0   /* F */
+};
+const instr_info_t evex_map6[] = {
+  {INVALID,     0x06ff08, catUncategorized, "(bad)", xx, xx, xx, xx, xx, no, x, NA},              /* 0*/
+  {PREFIX_EXT,  0x069808, catUncategorized, "(prefix ext 198)", xx, xx, xx, xx, xx, mrm, x, 198},/* 1*/
+  {PREFIX_EXT,  0x06a808, catUncategorized, "(prefix ext 199)", xx, xx, xx, xx, xx, mrm, x, 199},/* 2*/
+  {PREFIX_EXT,  0x06b808, catUncategorized, "(prefix ext 200)", xx, xx, xx, xx, xx, mrm, x, 200},/* 3*/
+};
+
 /****************************************************************************
  * XOP instructions
  *
@@ -10613,14 +10957,14 @@ const instr_info_t extra_operands[] =
     {OP_CONTD, 0x663a1818, catUncategorized, "vinsertf32x4 cont'd", xx, xx, Wdq, xx, xx, mrm|evex, x, END_LIST},
     {OP_CONTD, 0x663a1858, catUncategorized, "vinsertf64x2 cont'd", xx, xx, Wdq, xx, xx, mrm|evex, x, END_LIST},
     /* 172 */
-    {OP_CONTD, 0x663a1a58, catUncategorized, "vinsertf32x8 cont'd", xx, xx, Wdq, xx, xx, mrm|evex, x, END_LIST},
-    {OP_CONTD, 0x663a1a58, catUncategorized, "vinsertf64x4 cont'd", xx, xx, Wdq, xx, xx, mrm|evex, x, END_LIST},
+    {OP_CONTD, 0x663a1a58, catUncategorized, "vinsertf32x8 cont'd", xx, xx, Wqq, xx, xx, mrm|evex, x, END_LIST},
+    {OP_CONTD, 0x663a1a58, catUncategorized, "vinsertf64x4 cont'd", xx, xx, Wqq, xx, xx, mrm|evex, x, END_LIST},
     /* 174 */
     {OP_CONTD, 0x663a3818, catUncategorized, "vinserti32x4 cont'd", xx, xx, Wdq, xx, xx, mrm|evex, x, END_LIST},
     {OP_CONTD, 0x663a3858, catUncategorized, "vinserti64x2 cont'd", xx, xx, Wdq, xx, xx, mrm|evex, x, END_LIST},
     /* 176 */
-    {OP_CONTD, 0x663a3a18, catUncategorized, "vinserti32x8 cont'd", xx, xx, Wdq, xx, xx, mrm|evex, x, END_LIST},
-    {OP_CONTD, 0x663a3a58, catUncategorized, "vinserti64x4 cont'd", xx, xx, Wdq, xx, xx, mrm|evex, x, END_LIST},
+    {OP_CONTD, 0x663a3a18, catUncategorized, "vinserti32x8 cont'd", xx, xx, Wqq, xx, xx, mrm|evex, x, END_LIST},
+    {OP_CONTD, 0x663a3a58, catUncategorized, "vinserti64x4 cont'd", xx, xx, Wqq, xx, xx, mrm|evex, x, END_LIST},
     /* 178 */
     {OP_CONTD, 0x663a3e18, catUncategorized, "vpcmpub cont'd", xx, xx, We, xx, xx, evex|mrm, x, END_LIST},
     {OP_CONTD, 0x663a3f18, catUncategorized, "vpcmpb cont'd", xx, xx, We, xx, xx, evex|mrm, x, END_LIST},
@@ -10736,6 +11080,24 @@ const instr_info_t extra_operands[] =
     {OP_CONTD, 0xcf0f0171, catUncategorized, "<encls cont'd>", ecx, edx, edx, xx, xx, mrm, x, END_LIST},
     {OP_CONTD, 0xd70f0172, catUncategorized, "<enclu cont'd>", ecx, edx, edx, xx, xx, mrm, x, END_LIST},
     {OP_CONTD, 0xc00f0171, catUncategorized, "<enclv cont'd>", ecx, edx, edx, xx, xx, mrm, x, END_LIST},
+    /* 257 */
+    {OP_CONTD, 0x663ace48, catUncategorized, "vgf2p8affineqb cont'd", xx, xx, We, xx, xx, mrm|evex|reqp, x, tevexwb[275][3]},
+    {OP_CONTD, 0x663ace58, catUncategorized, "vgf2p8affineqb cont'd", xx, xx, Mq, xx, xx, mrm|evex|reqp, x, END_LIST},
+    /* 259 */
+    {OP_CONTD, 0x663acf48, catUncategorized, "vgf2p8affineinvqb cont'd", xx, xx, We, xx, xx, mrm|evex|reqp, x, tevexwb[276][3]},
+    {OP_CONTD, 0x663acf58, catUncategorized, "vgf2p8affineinvqb cont'd", xx, xx, Mq, xx, xx, mrm|evex|reqp, x, END_LIST},
+    /* 261 */
+    {OP_CONTD, 0x66069808, catUncategorized, "vfmadd132ph cont'd", xx, xx, Ve, xx, xx, mrm|evex, x, modx[128][0]},
+    {OP_CONTD, 0x66069818, catUncategorized, "vfmadd132ph cont'd", xx, xx, Ve, xx, xx, mrm|evex, x, modx[128][1]},
+    {OP_CONTD, 0x66069818, catUncategorized, "vfmadd132ph cont'd", xx, xx, Voq, xx, xx, mrm|evex, x, END_LIST},
+    /* 264 */
+    {OP_CONTD, 0x6606a808, catUncategorized, "vfmadd213ph cont'd", xx, xx, Ve, xx, xx, mrm|evex, x, modx[129][0]},
+    {OP_CONTD, 0x6606a818, catUncategorized, "vfmadd213ph cont'd", xx, xx, Ve, xx, xx, mrm|evex, x, modx[129][1]},
+    {OP_CONTD, 0x6606a818, catUncategorized, "vfmadd213ph cont'd", xx, xx, Voq, xx, xx, mrm|evex, x, END_LIST},
+    /* 267 */
+    {OP_CONTD, 0x6606b808, catUncategorized, "vfmadd231ph cont'd", xx, xx, Ve, xx, xx, mrm|evex, x, modx[130][0]},
+    {OP_CONTD, 0x6606b818, catUncategorized, "vfmadd231ph cont'd", xx, xx, Ve, xx, xx, mrm|evex, x, modx[130][1]},
+    {OP_CONTD, 0x6606b818, catUncategorized, "vfmadd231ph cont'd", xx, xx, Voq, xx, xx, mrm|evex, x, END_LIST},
 };
 
 /* clang-format on */
@@ -2431,6 +2431,8 @@ encode_evex_prefixes(byte *field_ptr, decode_info_t *di, const instr_info_t *inf
             val |= 0x02;
         else if (op3 == 0x3a)
             val |= 0x03;
+        else if (op3 == 0x05 || op3 == 0x06) /* AVX512-FP16 maps, stored like XOP map_select */
+            val |= op3;
         else
             CLIENT_ASSERT(false, "unknown 3-byte opcode");
     } else {
@@ -2418,6 +2418,13 @@
     instr_create_1dst_2src((dc), OP_vpdpwssd, (d), (s1), (s2))
 #define INSTR_CREATE_vpdpwssds(dc, d, s1, s2) \
     instr_create_1dst_2src((dc), OP_vpdpwssds, (d), (s1), (s2))
+/* GFNI */
+#define INSTR_CREATE_vgf2p8mulb(dc, d, s1, s2) \
+    instr_create_1dst_2src((dc), OP_vgf2p8mulb, (d), (s1), (s2))
+#define INSTR_CREATE_vgf2p8affineqb(dc, d, s1, s2, i) \
+    instr_create_1dst_3src((dc), OP_vgf2p8affineqb, (d), (s1), (s2), (i))
+#define INSTR_CREATE_vgf2p8affineinvqb(dc, d, s1, s2, i) \
+    instr_create_1dst_3src((dc), OP_vgf2p8affineinvqb, (d), (s1), (s2), (i))
 /** @} */ /* end doxygen group */
 
 /** @name 1 destination, 1 mask, and 1 non-immediate source */
@@ -2685,6 +2692,9 @@
     instr_create_1dst_2src((dc), OP_vpopcntd, (d), (k), (s))
 #define INSTR_CREATE_vpopcntq_mask(dc, d, k, s) \
     instr_create_1dst_2src((dc), OP_vpopcntq, (d), (k), (s))
+/* AVX512 FP16 */
+#define INSTR_CREATE_vsqrtph_mask(dc, d, k, s) \
+    instr_create_1dst_2src((dc), OP_vsqrtph, (d), (k), (s))
 
 /** @} */ /* end doxygen group */
 
@@ -3792,6 +3802,19 @@
     instr_create_1dst_3src((dc), OP_vsqrtss, (d), (k), (s1), (s2))
 #define INSTR_CREATE_vsqrtsd_mask(dc, d, k, s1, s2) \
     instr_create_1dst_3src((dc), OP_vsqrtsd, (d), (k), (s1), (s2))
+/* AVX512 FP16 */
+#define INSTR_CREATE_vaddph_mask(dc, d, k, s1, s2) \
+    instr_create_1dst_3src((dc), OP_vaddph, (d), (k), (s1), (s2))
+#define INSTR_CREATE_vsubph_mask(dc, d, k, s1, s2) \
+    instr_create_1dst_3src((dc), OP_vsubph, (d), (k), (s1), (s2))
+#define INSTR_CREATE_vmulph_mask(dc, d, k, s1, s2) \
+    instr_create_1dst_3src((dc), OP_vmulph, (d), (k), (s1), (s2))
+#define INSTR_CREATE_vdivph_mask(dc, d, k, s1, s2) \
+    instr_create_1dst_3src((dc), OP_vdivph, (d), (k), (s1), (s2))
+#define INSTR_CREATE_vminph_mask(dc, d, k, s1, s2) \
+    instr_create_1dst_3src((dc), OP_vminph, (d), (k), (s1), (s2))
+#define INSTR_CREATE_vmaxph_mask(dc, d, k, s1, s2) \
+    instr_create_1dst_3src((dc), OP_vmaxph, (d), (k), (s1), (s2))
 /** @} */ /* end doxygen group */
 
 /** @name 1 destination, 3 sources including one immediate */
@@ -4200,6 +4223,13 @@
     instr_create_1dst_3src((dc), OP_vcvtne2ps2bf16, (d), (k), (s1), (s2))
 #define INSTR_CREATE_vdpbf16ps_mask(dc, d, k, s1, s2) \
     instr_create_1dst_3src((dc), OP_vdpbf16ps, (d), (k), (s1), (s2))
+/* AVX512 FP16 */
+#define INSTR_CREATE_vfmadd132ph_mask(dc, d, k, s1, s2) \
+    instr_create_1dst_4src((dc), OP_vfmadd132ph, (d), (k), (s1), (s2), (d))
+#define INSTR_CREATE_vfmadd213ph_mask(dc, d, k, s1, s2) \
+    instr_create_1dst_4src((dc), OP_vfmadd213ph, (d), (k), (s1), (s2), (d))
+#define INSTR_CREATE_vfmadd231ph_mask(dc, d, k, s1, s2) \
+    instr_create_1dst_4src((dc), OP_vfmadd231ph, (d), (k), (s1), (s2), (d))
 /** @} */ /* end doxygen group */
 
 /** @name 1 explicit destination, 3 explicit sources */
@@ -1621,6 +1621,26 @@ enum {
     /* 1438 */ OP_xsaves64,
     /* 1439 */ OP_xrstors32,
     /* 1440 */ OP_xrstors64,
+
+    /* GFNI */
+    /* 1441 */ OP_gf2p8mulb,          /**< IA-32/AMD64 gf2p8mulb opcode. */
+    /* 1442 */ OP_vgf2p8mulb,         /**< IA-32/AMD64 vgf2p8mulb opcode. */
+    /* 1443 */ OP_gf2p8affineqb,      /**< IA-32/AMD64 gf2p8affineqb opcode. */
+    /* 1444 */ OP_vgf2p8affineqb,     /**< IA-32/AMD64 vgf2p8affineqb opcode. */
+    /* 1445 */ OP_gf2p8affineinvqb,   /**< IA-32/AMD64 gf2p8affineinvqb opcode. */
+    /* 1446 */ OP_vgf2p8affineinvqb,  /**< IA-32/AMD64 vgf2p8affineinvqb opcode. */
+
+    /* AVX512 FP16 */
+    /* 1447 */ OP_vsqrtph,      /**< IA-32/AMD64 vsqrtph opcode. */
+    /* 1448 */ OP_vaddph,       /**< IA-32/AMD64 vaddph opcode. */
+    /* 1449 */ OP_vmulph,       /**< IA-32/AMD64 vmulph opcode. */
+    /* 1450 */ OP_vsubph,       /**< IA-32/AMD64 vsubph opcode. */
+    /* 1451 */ OP_vminph,       /**< IA-32/AMD64 vminph opcode. */
+    /* 1452 */ OP_vdivph,       /**< IA-32/AMD64 vdivph opcode. */
+    /* 1453 */ OP_vmaxph,       /**< IA-32/AMD64 vmaxph opcode. */
+    /* 1454 */ OP_vfmadd132ph,  /**< IA-32/AMD64 vfmadd132ph opcode. */
+    /* 1455 */ OP_vfmadd213ph,  /**< IA-32/AMD64 vfmadd213ph opcode. */
+    /* 1456 */ OP_vfmadd231ph,  /**< IA-32/AMD64 vfmadd231ph opcode. */
     OP_AFTER_LAST,
     OP_FIRST = OP_add,           /**< First real opcode. */
     OP_LAST = OP_AFTER_LAST - 1, /**< Last real opcode. */
@@ -123,6 +123,8 @@ STATS_DEF("VMKUW system call sites", vmkuw_syscall_sites)
 STATS_DEF("VMKUW non-ignorable system calls", vmkuw_syscalls_intercept)
 #endif
 RSTATS_DEF("Native modules present", num_native_module_loads)
+RSTATS_DEF("Native modules without AVX-512 code", num_native_no_avx512_loads)
+STATS_DEF("Module code bytes scanned for AVX-512", native_avx512_scan_bytes)
 STATS_DEF("Native module entrance checks", num_native_entrance_checks)
 STATS_DEF("Native module entrance TOS checks", num_native_entrance_TOS_checks)
 STATS_DEF("Native module entrance TOS decodes", num_native_entrance_TOS_decodes)
@@ -641,6 +643,35 @@ STATS_DEF("Coarse pclookup cached entries", coarse_pclookup_cached)
 
 STATS_DEF("Hotpatch match requiring persisted cache flush", hotp_persist_flush)
 
+STATS_DEF("AVX-512 rewrite cache modules loaded", avx512_cache_modules_loaded)
+STATS_DEF("AVX-512 rewrite cache entries loaded", avx512_cache_entries_loaded)
+STATS_DEF("AVX-512 rewrite cache hits", avx512_cache_hits)
+STATS_DEF("AVX-512 rewrite cache misses", avx512_cache_misses)
+STATS_DEF("AVX-512 rewrite cache stale entries", avx512_cache_stale)
+STATS_DEF("AVX-512 rewrite cache uncacheable rewrites", avx512_cache_uncacheable)
+STATS_DEF("AVX-512 rewrite cache files written", avx512_cache_files_written)
+STATS_DEF("AVX-512 rewrite cache files evicted", avx512_cache_files_evicted)
+RSTATS_DEF("AVX-512 quiet-period detaches", avx512_phase_detaches)
+RSTATS_DEF("AVX-512 SIGILL re-attaches", avx512_phase_reattaches)
+RSTATS_DEF("AVX-512 helper routines emitted", avx512_helpers_emitted)
+RSTATS_DEF("AVX-512 helper routine bytes", avx512_helper_bytes)
+RSTATS_DEF("AVX-512 lowerings replaced by a helper call", avx512_helper_calls)
+RSTATS_DEF("AVX-512 fcache bytes saved by helper calls", avx512_helper_bytes_saved)
+RSTATS_DEF("AVX-512 lowerings inlined for a full helper pool", avx512_helper_pool_full)
+RSTATS_DEF("AVX-512 sites started on the interpreter", avx512_tier0_sites)
+RSTATS_DEF("AVX-512 sites promoted to their inline lowering", avx512_tier_promotions)
+RSTATS_DEF("AVX-512 instrs left to the interpreter for lack of a lowering", avx512_interp_fallbacks)
+STATS_DEF("AVX-512 instrs interpreted", avx512_interp_execs)
+STATS_DEF("AVX-512 template cache entries", avx512_template_entries)
+STATS_DEF("AVX-512 template cache hits", avx512_template_hits)
+STATS_DEF("AVX-512 template cache misses", avx512_template_misses)
+STATS_DEF("AVX-512 template cache untemplatable chains", avx512_template_uncacheable)
+STATS_DEF("AVX-512 template cache chains dropped when full", avx512_template_full)
+STATS_DEF("AVX-512 IR arena bytes allocated", avx512_arena_bytes)
+STATS_DEF("AVX-512 IR arena peak bytes in use", avx512_arena_peak_bytes)
+STATS_DEF("AVX-512 IR arena allocations falling back to the heap", avx512_arena_full)
+STATS_DEF("AVX-512 IR arena rewinds", avx512_arena_rewinds)
+
 STATS_DEF("Persisted cache exec loads attempted", perscache_load_attempt)
 STATS_DEF("Persisted cache post-rebind re-loads attempted", perscache_rebind_load)
 STATS_DEF("Persisted cache non-exec loads attempted", perscache_load_nox_attempt)
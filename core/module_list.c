@@ -34,6 +34,7 @@
 #include "globals.h"
 #include "instrument.h"
 #include "native_exec.h"
+#include "rewrite_cache.h"
 #ifdef WINDOWS
 #    include "ntdll.h" /* for protect_virtual_memory */
 #endif
@@ -277,6 +278,7 @@ module_list_add(app_pc base, size_t view_size, bool at_map,
          */
 
         native_exec_module_load(ma, at_map);
+        rewrite_cache_module_load(ma);
     } else {
         /* already added! */
         /* only possible for manual NtMapViewOfSection, loader
@@ -329,6 +331,8 @@ module_list_remove(app_pc base, size_t view_size)
     ASSERT_CURIOSITY(ma != NULL); /* loader can't have a race */
 
     native_exec_module_unload(ma);
+    if (ma != NULL)
+        rewrite_cache_module_unload(ma);
 
     /* defensively checking */
     if (ma != NULL) {
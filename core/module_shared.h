@@ -128,6 +128,8 @@ enum {
     MODULE_NULL_INSTRUMENT = 0x00000080,
     /* we use this to send just one module load event on 1st exec (i#884) */
     MODULE_LOAD_EVENT = 0x00000100,
+    /* -native_exec_no_avx512 found no EVEX or opmask instrs in its code */
+    MODULE_NO_AVX512 = 0x00000200,
 };
 
 /**************** init/exit routines *****************/
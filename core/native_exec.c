@@ -141,6 +141,131 @@ on_native_exec_list(const char *modname)
     return onlist;
 }
 
+#ifdef LINUX
+static bool
+is_legacy_prefix(byte b)
+{
+    return b == 0x66 || b == 0x67 || b == 0xf0 || b == 0xf2 || b == 0xf3 || b == 0x2e ||
+        b == 0x36 || b == 0x3e || b == 0x26 || b == 0x64 ||
+        b == 0x65 IF_X64(|| (b >= 0x40 && b <= 0x4f) /* rex */);
+}
+
+/* VEX map 0F opmask instrs: kand, kandn, knot, kor, kxnor, kxor, kadd, kunpck,
+ * kmov, kortest and ktest.
+ */
+static bool
+is_vex_map1_k_opcode(byte opc)
+{
+    return (opc >= 0x41 && opc <= 0x4b && opc != 0x43 && opc != 0x48 && opc != 0x49) ||
+        (opc >= 0x90 && opc <= 0x93) || opc == 0x98 || opc == 0x99;
+}
+
+bool
+is_avx512_encoding(byte *pc)
+{
+    byte *p = pc;
+    while (p < pc + 4 && is_legacy_prefix(*p))
+        p++;
+    /* outside 64-bit mode these are bound/les/lds unless modrm.mod is 3 */
+    if (!IF_X64_ELSE(true, (p[1] & 0xc0) == 0xc0))
+        return false;
+    if (*p == 0x62)
+        return true;
+    if (*p == 0xc5 && is_vex_map1_k_opcode(p[2]))
+        return true;
+    if (*p == 0xc4 &&
+        (((p[1] & 0x1f) == 1 && is_vex_map1_k_opcode(p[3])) ||
+         ((p[1] & 0x1f) == 3 && p[3] >= 0x30 && p[3] <= 0x33) /* kshift */))
+        return true;
+    return false;
+}
+
+/* Linear sweep of [start, end) with decode_sizeof() looking for EVEX-encoded or
+ * opmask instrs.  The last few instrs are decoded from a zero-padded copy so that
+ * no read runs past end.  Bytes that do not decode, or an instr other than the
+ * zero fill at the end of a segment's last page that runs past end, mean the sweep
+ * is lost: the code is then assumed to hold AVX-512.
+ */
+static bool
+code_has_avx512(byte *start, byte *end)
+{
+    byte tail[MAX_INSTR_LENGTH * 2];
+    byte *pc = start;
+    while (pc < end) {
+        byte *cur = pc;
+        int len;
+        if (end - pc < MAX_INSTR_LENGTH) {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, pc, end - pc);
+            cur = tail;
+        }
+        if (is_avx512_encoding(cur))
+            return true;
+        len = decode_sizeof(GLOBAL_DCONTEXT, cur, NULL _IF_X64(NULL));
+        if (len <= 0)
+            return true;
+        if (len > end - pc) {
+            for (; pc < end; pc++) {
+                if (*pc != 0)
+                    return true;
+            }
+            break;
+        }
+        pc += len;
+    }
+    return false;
+}
+
+/* Returns whether an executable segment of ma holds AVX-512 code, and in *scanned
+ * how many code bytes were looked at.  The segments are read from the file so that
+ * those not yet mapped in at map time are covered too.
+ */
+static bool
+module_has_avx512_code(module_area_t *ma, bool at_map, size_t *scanned DR_PARAM_OUT)
+{
+    file_t fd =
+        ma->full_path == NULL ? INVALID_FILE : os_open(ma->full_path, OS_OPEN_READ);
+    byte *map = NULL;
+    size_t map_size = 0;
+    uint64 file_size = 0;
+    bool found = false;
+    uint i;
+    *scanned = 0;
+    if (fd != INVALID_FILE) {
+        if (os_get_file_size_by_handle(fd, &file_size) && file_size > 0) {
+            map_size = (size_t)file_size;
+            map = d_r_map_file(fd, &map_size, 0, NULL, MEMPROT_READ, 0);
+        }
+        os_close(fd);
+    }
+    /* later segments are not in place yet: assume the worst */
+    if (map == NULL && at_map)
+        return true;
+    for (i = 0; i < ma->os_data.num_segments && !found; i++) {
+        module_segment_t *seg = &ma->os_data.segments[i];
+        byte *start = seg->start, *end = seg->end;
+        if (!TEST(MEMPROT_EXEC, seg->prot))
+            continue;
+        if (map != NULL) {
+            /* segment starts are page-aligned back from p_vaddr, which matches
+             * p_offset modulo the page size
+             */
+            uint64 offs = ALIGN_BACKWARD(seg->offset, PAGE_SIZE);
+            if (offs >= file_size)
+                continue;
+            start = map + offs;
+            end = start + MIN((uint64)(seg->end - seg->start), file_size - offs);
+        }
+        found = code_has_avx512(start, end);
+        *scanned += end - start;
+    }
+    if (map != NULL)
+        d_r_unmap_file(map, map_size);
+    STATS_ADD(native_avx512_scan_bytes, *scanned);
+    return found;
+}
+#endif
+
 static bool
 check_and_mark_native_exec(module_area_t *ma, bool add)
 {
@@ -152,6 +277,11 @@ check_and_mark_native_exec(module_area_t *ma, bool add)
             name);
         is_native = true;
     }
+    if (DYNAMO_OPTION(native_exec) && TEST(MODULE_NO_AVX512, ma->flags)) {
+        LOG(GLOBAL, LOG_INTERP | LOG_VMAREAS, 1, "module %s has no AVX-512 code\n",
+            name == NULL ? "<no name>" : name);
+        is_native = true;
+    }
 
     if (add && is_native) {
         RSTATS_INC(num_native_module_loads);
@@ -174,6 +304,22 @@ native_exec_module_load(module_area_t *ma, bool at_map)
     bool is_native;
     if (!DYNAMO_OPTION(native_exec))
         return;
+#ifdef LINUX
+    if (DYNAMO_OPTION(native_exec_no_avx512)) {
+        size_t scanned;
+        if (!module_has_avx512_code(ma, at_map, &scanned)) {
+            const char *name = GET_MODULE_NAME(&ma->names);
+            ma->flags |= MODULE_NO_AVX512;
+            RSTATS_INC(num_native_no_avx512_loads);
+            if (DYNAMO_OPTION(native_exec_no_avx512_report)) {
+                REWRITE_INFO(STDERR,
+                             "running %s natively: no EVEX or opmask instrs in " SZFMT
+                             " code bytes",
+                             name == NULL ? "<no name>" : name, scanned);
+            }
+        }
+    }
+#endif
     is_native = check_and_mark_native_exec(ma, true /*add*/);
     if (is_native && DYNAMO_OPTION(native_exec_retakeover))
         native_module_hook(ma, at_map);
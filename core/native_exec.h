@@ -102,6 +102,14 @@ bool
 native_exec_replace_next_tag(dcontext_t *dcontext);
 #endif
 
+#ifdef LINUX
+/* Returns whether the instr at pc is EVEX-encoded or an opmask instr, by looking
+ * at its prefix and opcode bytes only.
+ */
+bool
+is_avx512_encoding(byte *pc);
+#endif
+
 /* Update next_tag with the real app return address. */
 void
 interpret_back_from_native(dcontext_t *dcontext);
@@ -927,6 +927,47 @@ OPTION_DEFAULT(uint, selfmod_max_writes, 5, "maximum write instrs per selfmod fr
 // OPTION_DEFAULT(uint, max_bb_instrs, 1024, "maximum instrs per basic block")
 OPTION_DEFAULT(uint, max_bb_instrs, 16, "maximum instrs per basic block")
 OPTION_DEFAULT(uint, quick_rw, 0, "quick rewrite")
+OPTION_DEFAULT(pathstring_t, avx512_cache_dir, EMPTY_STRING,
+               "directory for the persistent cache of rewritten AVX-512 instrs, "
+               "empty disables the cache")
+OPTION_DEFAULT(uint_size, avx512_cache_max_size, 64 * 1024 * 1024,
+               "size cap for -avx512_cache_dir, least recently used module files "
+               "are evicted past it")
+#ifdef LINUX
+/* Dr.avx: services that reach AVX-512 code in a few request types only */
+OPTION_DEFAULT(bool, avx512_lazy_takeover, false,
+               "run the app natively after early injection and take over the process "
+               "only when an AVX-512 instr first raises SIGILL")
+OPTION_DEFAULT(uint, avx512_detach_quiet_ms, 0,
+               "send all threads native once no rewritten block has run for this "
+               "many milliseconds, re-attaching on the next AVX-512 SIGILL; 0 disables")
+#endif
+#ifdef X86
+/* Dr.avx: the HIDE_AVX512_* bits in arch/arch.h */
+OPTION_DEFAULT(uint, hide_avx512, 0,
+               "AVX-512 subsets to clear from cpuid leaf 7, so that code dispatching "
+               "on them picks its AVX2 paths: 0x1 F (all of AVX-512 and its XCR0 "
+               "state), 0x2 CD, 0x4 BW, 0x8 DQ, 0x10 VL, 0x20 IFMA, 0x40 VBMI, "
+               "0x80 VNNI, 0x100 BITALG, 0x200 BF16, 0x400 FP16, 0x800 VP2INTERSECT, "
+               "0x1000 Xeon Phi subsets")
+OPTION_DEFAULT(bool, avx512_native_subsets, false,
+               "run AVX-512 instrs natively when the host has the subset they need, "
+               "rewriting only the rest")
+OPTION_DEFAULT(uint, avx512_helper_threshold, 0,
+               "emit lowered AVX-512 chains of at least this many bytes once into a "
+               "shared helper routine and call it instead of inlining them; 0 inlines "
+               "every chain")
+OPTION_DEFAULT(uint, avx512_tier_threshold, 0,
+               "interpret AVX-512 instrs through a clean call until their site has run "
+               "this many times, then rebuild the block with their inline lowering; 0 "
+               "lowers every instr inline")
+OPTION_DEFAULT(bool, avx512_template_cache, true,
+               "keep the lowered chain of every AVX-512 instr shape a thread has "
+               "rewritten, and replay it for later instrs of the same shape")
+OPTION_DEFAULT(bool, avx512_ir_arena, true,
+               "allocate the IR built while rewriting AVX-512 blocks from a per-thread "
+               "bump-pointer arena released with the block's instrlist")
+#endif
 PC_OPTION_DEFAULT(bool, process_SEH_push, IF_RETURN_AFTER_CALL_ELSE(true, false),
                   "break bb's at an SEH push so we can see the frame pushed on in "
                   "interp, required for -borland_SEH_rct")
@@ -2649,6 +2690,13 @@ OPTION_DEFAULT(bool, native_exec_managed_code, true,
 OPTION_DEFAULT(
     bool, native_exec_dot_pexe, true,
     "if module has .pexe section (proxy for strange int 3 behavior), execute it natively")
+/* Dr.avx: modules without a single AVX-512 instr gain nothing from the code cache */
+OPTION_DEFAULT(bool, native_exec_no_avx512, false,
+               "scan the code of each loaded module and execute it natively if it has "
+               "no EVEX or opmask instrs; pair with -native_exec_retakeover to regain "
+               "control when such a module calls out")
+OPTION_DEFAULT(bool, native_exec_no_avx512_report, false,
+               "print each module -native_exec_no_avx512 runs natively to stderr")
 OPTION_DEFAULT(
     bool, native_exec_retakeover, false,
     "attempt to re-takeover when a native module calls out to a non-native module")
@@ -51,6 +51,7 @@
 #include "../fcache.h"
 #include "proc.h"
 #include "instrument.h"
+#include "rewrite_helper.h"
 
 #if defined(DEBUG) || defined(INTERNAL)
 #    include "disassemble.h"
@@ -1669,6 +1670,10 @@ recreate_app_state(dcontext_t *tdcontext, priv_mcontext_t *mcontext, bool restor
     }
 #endif
 
+#if defined(X86) && defined(LINUX)
+    /* a thread stopped at the call into an AVX-512 helper is on the TLS stack */
+    rewrite_helper_restore_xsp(tdcontext, mcontext);
+#endif
     res = recreate_app_state_internal(tdcontext, mcontext, false, f, restore_memory);
 
 #ifdef DEBUG
@@ -2062,6 +2062,7 @@ privload_early_inject(void **sp, byte *old_libdr_base, size_t old_libdr_size)
     bool success;
     memquery_iter_t iter;
     app_pc interp_map;
+    bool go_native = false;
 
     if (*argc == ARGC_PTRACE_SENTINEL) {
         /* XXX: Teach the injector to look up takeover_ptrace() and call it
@@ -2137,6 +2138,11 @@ privload_early_inject(void **sp, byte *old_libdr_base, size_t old_libdr_size)
      * for the -xarch_root option below.
      */
     dynamorio_app_init_part_one_options();
+    if (DYNAMO_OPTION(avx512_lazy_takeover)) {
+        /* Init as dr_app_setup() does, so that the takeover is a dr_app_start(). */
+        dr_api_entry = true;
+        dynamo_control_via_attach = true;
+    }
 
     /* Find range of app */
     exe_map = module_vaddr_from_prog_header((app_pc)exe_ld.phdrs, exe_ld.ehdr->e_phnum,
@@ -2268,7 +2274,16 @@ privload_early_inject(void **sp, byte *old_libdr_base, size_t old_libdr_size)
         LOG(GLOBAL, LOG_TOP, 1, "\n");
     });
 
-    if (RUNNING_WITHOUT_CODE_CACHE()) {
+    if (DYNAMO_OPTION(avx512_lazy_takeover)) {
+        /* Run natively until the first AVX-512 instr faults, from where
+         * signal.c takes over the process.  If the app's SIGILL is not at its
+         * default action we cannot tell its faults from ours, and dynamo_start()
+         * below takes over right away, like dr_app_start().
+         */
+        dynamo_thread_not_under_dynamo(get_thread_private_dcontext());
+        go_native = signal_lazy_takeover_install();
+    }
+    if (RUNNING_WITHOUT_CODE_CACHE() || go_native) {
         /* Reset the stack pointer back to the beginning and jump to the entry
          * point to execute the app natively.  This is also useful for testing
          * if the app has been mapped correctly without involving DR's code
@@ -51,6 +51,11 @@ typedef struct _module_segment_t {
     uint64 offset;
 } module_segment_t;
 
+#ifdef LINUX
+/* SHA-1 build-ids are 20 bytes; longer ones are truncated */
+#    define MODULE_BUILD_ID_MAX_LEN 32
+#endif
+
 typedef struct _os_module_data_t {
     /* To compute the base address, one determines the memory address associated with
      * the lowest p_vaddr value for a PT_LOAD segment. One then obtains the base
@@ -91,6 +96,9 @@ typedef struct _os_module_data_t {
     ptr_uint_t gnu_shift;
     ptr_uint_t gnu_bitidx;
     size_t gnu_symbias; /* .dynsym index of first export */
+    /* NT_GNU_BUILD_ID note contents, build_id_len == 0 if the module has none */
+    byte build_id[MODULE_BUILD_ID_MAX_LEN];
+    uint build_id_len;
 #else                   /* MACOS */
     byte *exports;     /* absolute addr of exports trie */
     size_t exports_sz; /* size of exports trie */
@@ -133,6 +141,14 @@ module_walk_program_headers(app_pc base, size_t view_size, bool at_map, bool dyn
 uint
 module_num_program_headers(app_pc base);
 
+#ifdef LINUX
+/* Copies up to MODULE_BUILD_ID_MAX_LEN bytes of the NT_GNU_BUILD_ID note of the
+ * loaded ELF at base into id and returns its length, or 0 if it has none.
+ */
+uint
+module_get_build_id(app_pc base, size_t view_size, byte *id DR_PARAM_OUT);
+#endif
+
 void
 os_module_update_dynamic_info(app_pc base, size_t size, bool at_map);
 
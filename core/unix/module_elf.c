@@ -335,6 +335,67 @@ module_fill_os_data(ELF_PROGRAM_HEADER_TYPE *prog_hdr, /* PT_DYNAMIC entry */
     return res;
 }
 
+/* Scans the notes in [note, end) for NT_GNU_BUILD_ID and copies it into id.
+ * Returns the copied length, or 0 if there is no build-id note.
+ */
+static uint
+module_find_build_id(app_pc note, app_pc end, size_t align, byte *id DR_PARAM_OUT)
+{
+    while (note + sizeof(ELF_NOTE_HEADER_TYPE) <= end) {
+        ELF_NOTE_HEADER_TYPE *nhdr = (ELF_NOTE_HEADER_TYPE *)note;
+        app_pc name = note + sizeof(*nhdr);
+        app_pc desc = name + ALIGN_FORWARD(nhdr->n_namesz, align);
+        note = desc + ALIGN_FORWARD(nhdr->n_descsz, align);
+        if (note > end || note <= name)
+            break;
+        if (nhdr->n_type == NT_GNU_BUILD_ID && nhdr->n_namesz == sizeof(ELF_NOTE_GNU) &&
+            memcmp(name, ELF_NOTE_GNU, sizeof(ELF_NOTE_GNU)) == 0 && nhdr->n_descsz > 0) {
+            uint len = MIN(nhdr->n_descsz, MODULE_BUILD_ID_MAX_LEN);
+            memcpy(id, desc, len);
+            return len;
+        }
+    }
+    return 0;
+}
+
+/* Returns the build-id of the PT_NOTE segment prog_hdr if it lies within the view. */
+static uint
+module_note_build_id(ELF_PROGRAM_HEADER_TYPE *prog_hdr, app_pc base, size_t view_size,
+                     bool at_map, ptr_int_t load_delta, byte *id DR_PARAM_OUT)
+{
+    /* at map time only the file image is laid out, so use the file offset */
+    app_pc note =
+        at_map ? base + prog_hdr->p_offset : (app_pc)prog_hdr->p_vaddr + load_delta;
+    if (note < base || note + prog_hdr->p_filesz > base + view_size)
+        return 0;
+    return module_find_build_id(note, note + prog_hdr->p_filesz,
+                                prog_hdr->p_align == 8 ? 8 : 4, id);
+}
+
+uint
+module_get_build_id(app_pc base, size_t view_size, byte *id DR_PARAM_OUT)
+{
+    ELF_HEADER_TYPE *elf_hdr = (ELF_HEADER_TYPE *)base;
+    app_pc mod_base;
+    uint i;
+    if (!is_elf_so_header(base, view_size) || elf_hdr->e_phoff == 0 ||
+        elf_hdr->e_phoff + elf_hdr->e_phnum * elf_hdr->e_phentsize > view_size)
+        return 0;
+    mod_base = module_vaddr_from_prog_header(base + elf_hdr->e_phoff, elf_hdr->e_phnum,
+                                             NULL, NULL);
+    for (i = 0; i < elf_hdr->e_phnum; i++) {
+        ELF_PROGRAM_HEADER_TYPE *prog_hdr =
+            (ELF_PROGRAM_HEADER_TYPE *)(base + elf_hdr->e_phoff + i * elf_hdr->e_phentsize);
+        if (prog_hdr->p_type == PT_NOTE) {
+            uint len = module_note_build_id(prog_hdr, base, view_size, false /*!at_map*/,
+                                            base - mod_base, id);
+            if (len != 0)
+                return len;
+        }
+    }
+    return 0;
+}
+
 /* Identifies the bounds of each segment in the ELF at base.
  * Returned addresses out_base and out_end are relative to the actual
  * loaded module base, so the "base" param should be added to produce
@@ -397,6 +458,11 @@ module_walk_program_headers(app_pc base, size_t view_size, bool at_map, bool dyn
                 }
                 found_load = true;
             }
+            if (out_data != NULL && prog_hdr->p_type == PT_NOTE &&
+                out_data->build_id_len == 0) {
+                out_data->build_id_len = module_note_build_id(
+                    prog_hdr, base, view_size, at_map, load_delta, out_data->build_id);
+            }
             if ((out_soname != NULL || out_data != NULL) &&
                 prog_hdr->p_type == PT_DYNAMIC) {
                 module_fill_os_data(prog_hdr, mod_base, max_end, base, view_size, at_map,
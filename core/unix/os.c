@@ -2959,6 +2959,11 @@ os_thread_not_under_dynamo(dcontext_t *dcontext)
     os_swap_context(dcontext, true /*to app*/, DR_STATE_GO_NATIVE);
 }
 
+#ifdef LINUX
+static int
+rescan_executable_vm_areas(void);
+#endif
+
 void
 os_process_under_dynamorio_initiate(dcontext_t *dcontext)
 {
@@ -2976,6 +2981,10 @@ os_process_under_dynamorio_initiate(dcontext_t *dcontext)
      * present to finish up their go-native code.
      */
     hook_vsyscall(dcontext, false);
+#ifdef LINUX
+    if (signal_lazy_takeover_needs_rescan())
+        rescan_executable_vm_areas();
+#endif
 }
 
 void
@@ -10102,6 +10111,103 @@ find_executable_vm_areas(void)
     return count;
 }
 
+#ifdef LINUX
+/* Whether the maps still show the file mapped at a module's base. */
+static bool
+module_still_mapped(app_pc start, uint64 inode)
+{
+    bool mapped = false;
+    memquery_iter_t iter;
+    memquery_iterator_start(&iter, NULL, true /*may alloc*/);
+    while (memquery_iterator_next(&iter)) {
+        if (iter.vm_start >= start) {
+            mapped = iter.vm_start == start && iter.inode == inode;
+            break;
+        }
+    }
+    memquery_iterator_stop(&iter);
+    return mapped;
+}
+
+/* Drops the modules the app unmapped while native.  The maps can't be read under
+ * the module lock, so this walks the list one module at a time.
+ */
+static void
+remove_unmapped_modules(void)
+{
+    app_pc next = NULL;
+    for (;;) {
+        app_pc start = NULL, end = NULL;
+        uint64 inode = 0;
+        module_iterator_t *mi = module_iterator_start();
+        while (module_iterator_hasnext(mi)) {
+            module_area_t *ma = module_iterator_next(mi);
+            if (ma->start >= next) {
+                start = ma->start;
+                end = ma->end;
+                inode = ma->names.inode;
+                break;
+            }
+        }
+        module_iterator_stop(mi);
+        if (end == NULL)
+            break;
+        next = end;
+        if (!module_still_mapped(start, inode)) {
+            LOG(GLOBAL, LOG_VMAREAS, 2, "Module unmapped while native: " PFX "-" PFX "\n",
+                start, end);
+            module_list_remove(start, end - start);
+        }
+    }
+}
+
+/* Picks up what the app mapped while it ran natively under -avx512_lazy_takeover,
+ * i.e. the modules ld.so loaded and any other region not yet an executable area,
+ * and drops the modules it unmapped, which matters after a phase detach.
+ * Called from the thread taking over, before any other thread is under DR.
+ */
+static int
+rescan_executable_vm_areas(void)
+{
+    int count = 0;
+    memquery_iter_t iter;
+    remove_unmapped_modules();
+    /* the memory cache is as stale as the module list */
+    memcache_update_all_from_os();
+    memquery_iterator_start(&iter, NULL, true /*may alloc*/);
+    while (memquery_iterator_next(&iter)) {
+        size_t size = iter.vm_end - iter.vm_start;
+        bool image = false;
+        if (dynamo_vm_area_overlap(iter.vm_start, iter.vm_end) ||
+            executable_vm_area_overlap(iter.vm_start, iter.vm_end, false))
+            continue;
+        if (mmap_check_for_module_overlap(iter.vm_start, size,
+                                          TEST(MEMPROT_READ, iter.prot), iter.inode,
+                                          false)) {
+            image = true;
+        } else if (TEST(MEMPROT_READ, iter.prot) &&
+                   module_is_header(iter.vm_start, size)) {
+            app_pc mod_base, mod_first_end, mod_max_end;
+            image = true;
+            if (module_walk_program_headers(iter.vm_start, size, false, true, &mod_base,
+                                            &mod_first_end, &mod_max_end, NULL, NULL)) {
+                LOG(GLOBAL, LOG_VMAREAS, 2,
+                    "Found module mapped while native: " PFX "-" PFX " %s\n",
+                    mod_base, mod_max_end, iter.comment);
+                module_list_add(iter.vm_start, mod_first_end - mod_base, false,
+                                iter.comment, iter.inode);
+            }
+        }
+        if (app_memory_allocation(NULL, iter.vm_start, size, iter.prot,
+                                  image _IF_DEBUG(image ? "ELF SO" : "Private")))
+            count++;
+    }
+    memquery_iterator_stop(&iter);
+    STATS_ADD(num_app_code_modules, count);
+    return count;
+}
+#endif
+
 /* initializes dynamorio library bounds.
  * does not use any heap.
  * assumed to be called prior to find_executable_vm_areas.
@@ -10902,6 +11008,17 @@ os_thread_re_take_over(void)
             LOG(tr->dcontext->logfile, LOG_THREADS, 1,
                 "\nretakeover for cur-native thread " TIDFMT "\n", get_sys_thread_id());
             os_swap_dr_tls(tr->dcontext, false /*to dr*/);
+            if (os_should_swap_state()) {
+                /* The app's segment is still in place: pick up any TLS it set up
+                 * while native, as -avx512_lazy_takeover runs it from its entry.
+                 */
+                os_local_state_t *os_tls = get_os_tls_from_dc(tr->dcontext);
+                byte *base = get_segment_base(TLS_REG_LIB);
+                if (!is_dynamo_address(base)) {
+                    os_tls->app_lib_tls_reg = read_thread_register(TLS_REG_LIB);
+                    os_tls->app_lib_tls_base = base;
+                }
+            }
             ASSERT(is_thread_initialized());
             return true;
         }
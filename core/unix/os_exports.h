@@ -567,6 +567,39 @@ set_itimer_callback(dcontext_t *dcontext, int which, uint millisec,
 uint
 get_itimer_frequency(dcontext_t *dcontext, int which);
 
+#ifdef LINUX
+/* Installs the -avx512_lazy_takeover SIGILL handler for a process DR has not yet
+ * taken over, along with a seccomp trap on the app installing its own SIGILL or
+ * SIGSYS handler.  Returns false if the app's SIGILL or SIGSYS is not at its
+ * default action or the trap cannot be installed.
+ */
+bool
+signal_lazy_takeover_install(void);
+/* Makes the next signal_remove_handlers() install that handler in place of the
+ * default action, with faulting threads waiting for signal_lazy_takeover_release()
+ * before they take over.
+ */
+void
+signal_lazy_takeover_rearm(void);
+void
+signal_lazy_takeover_release(void);
+/* Returns whether the app has left SIGILL and SIGSYS at their default actions and
+ * the sigaction trap is in place.
+ */
+bool
+signal_lazy_takeover_possible(dcontext_t *dcontext);
+/* Returns, once, whether a lazy takeover has started since the app last ran
+ * natively, so that what it mapped meanwhile must be added.
+ */
+bool
+signal_lazy_takeover_needs_rescan(void);
+/* Like os_forge_exception(), for the SIGSEGV the instr at target_pc raises on
+ * fault_addr, with the si_code the kernel would give it.
+ */
+void
+os_forge_memory_fault(app_pc target_pc, app_pc fault_addr);
+#endif
+
 bool
 sysnum_is_not_restartable(int sysnum);
 
@@ -83,6 +83,9 @@
 #include "ksynch.h"
 #include "tls.h" /* tls_reinstate_selector */
 #include "../translate.h"
+#include "../native_exec.h"
+#include "../arch/rewrite_helper.h"
+#include "../arch/rewrite_utils.h"
 
 #ifdef LINUX
 #    include "include/syscall.h"
@@ -262,12 +265,35 @@ DECLARE_CXTSWPROT_VAR(static read_write_lock_t detached_sigact_lock,
 static kernel_sigaction_t detached_sigact[SIGARRAY_SIZE];
 static bool multiple_handlers_present; /* Accessed using atomics, not the lock. */
 
+#ifdef LINUX
+/* -avx512_lazy_takeover: set by the first thread to fault on an AVX-512 instr,
+ * which goes on to take over the process.  Accessed using atomics.
+ */
+static volatile int lazy_takeover_claimed;
+/* -avx512_detach_quiet_ms: set while all threads are being sent native, so that
+ * signal_remove_handlers() leaves the SIGILL trap in place of the default action.
+ */
+static bool lazy_takeover_rearm;
+/* Set by the thread claiming the takeover, for os_process_under_dynamorio_initiate()
+ * to pick up what the app mapped natively once that thread has its dcontext.
+ */
+static bool lazy_takeover_rescan;
+#endif
+
 /**** function prototypes ***********************************************/
 
 /* in x86.asm */
 void
 main_signal_handler(int sig, kernel_siginfo_t *siginfo, kernel_ucontext_t *ucxt);
 
+#ifdef LINUX
+static void
+lazy_takeover_handler(int sig, kernel_siginfo_t *siginfo, kernel_ucontext_t *ucxt);
+
+static void
+lazy_takeover_sigact(kernel_sigaction_t *act, int sig);
+#endif
+
 static void
 set_handler_and_record_app(dcontext_t *dcontext, thread_sig_info_t *info, int sig,
                            kernel_sigaction_t *act);
@@ -1701,7 +1727,8 @@ set_handler_and_record_app(dcontext_t *dcontext, thread_sig_info_t *info, int si
         return;
 
     if (oldact.handler != (handler_t)SIG_DFL &&
-        oldact.handler != (handler_t)main_signal_handler) {
+        oldact.handler != (handler_t)main_signal_handler
+            IF_LINUX(&&oldact.handler != (handler_t)lazy_takeover_handler)) {
         /* save the app's action for sig */
         if (info->sighand->is_shared) {
             /* sighand structure is shared */
@@ -1830,6 +1857,19 @@ signal_remove_handlers(dcontext_t *dcontext)
     act.handler = (handler_t)SIG_DFL;
     kernel_sigemptyset(&act.mask);
     for (i = 1; i <= MAX_SIGNUM; i++) {
+#ifdef LINUX
+        if ((i == SIGILL || i == SIGSYS) && lazy_takeover_rearm &&
+            info->sighand->action[i] == NULL) {
+            /* Swap straight to the trap: a thread already native must not hit the
+             * default action in between.
+             */
+            kernel_sigaction_t trap;
+            LOG(THREAD, LOG_ASYNCH, 2, "\tarming the AVX-512 trap for %d\n", i);
+            lazy_takeover_sigact(&trap, i);
+            sigaction_syscall(i, &trap, NULL);
+            continue;
+        }
+#endif
         if (info->sighand->action[i] != NULL) {
             LOG(THREAD, LOG_ASYNCH, 2, "\trestoring " PFX " as handler for %d\n",
                 info->sighand->action[i]->handler, i);
@@ -3120,6 +3160,11 @@ translate_sigcontext(dcontext_t *dcontext, kernel_ucontext_t *uc, bool avoid_fai
     bool success = false;
     priv_mcontext_t mcontext;
     sigcontext_t *sc = SIGCXT_FROM_UCXT(uc);
+#if defined(X86) && defined(LINUX)
+    cache_pc cpc = (cache_pc)sc->SC_XIP;
+    if (rewrite_helper_in_pool(cpc))
+        cpc = rewrite_helper_return_pc(dcontext);
+#endif
 
     ucontext_to_mcontext(&mcontext, uc);
     /* FIXME: if cannot find exact match, we're in trouble!
@@ -3141,6 +3186,17 @@ translate_sigcontext(dcontext_t *dcontext, kernel_ucontext_t *uc, bool avoid_fai
     if (translate_mcontext(dcontext->thread_record, &mcontext, true /*restore memory*/,
                            f)) {
         mcontext_to_ucontext(uc, &mcontext);
+#if defined(X86) && defined(LINUX)
+        /* An {er}/{sae} run of AVX-512 lowerings leaves its MXCSR override in the
+         * register: the app must see, and resume with, its own value.
+         */
+        if (sc->fpstate != NULL) {
+            fragment_t wrapper;
+            fragment_t *cf = f != NULL ? f : fragment_pclookup(dcontext, cpc, &wrapper);
+            if (cf != NULL)
+                sc->fpstate->mxcsr = lower_mxcsr_translate(dcontext, cf, cpc, sc->fpstate->mxcsr);
+        }
+#endif
         success = true;
     } else {
         if (avoid_failure) {
@@ -4691,6 +4747,8 @@ find_next_fragment_from_gencode(dcontext_t *dcontext, sigcontext_t *sc)
 #else
 #    error Unsupported arch.
 #endif
+    } else if (rewrite_helper_in_pool(pc)) {
+        f = fragment_pclookup(dcontext, rewrite_helper_return_pc(dcontext), &wrapper);
     } else if (in_indirect_branch_lookup_code(dcontext, pc)) {
         /* Try to find the target if the signal arrived in the IBL.
          * We could try to be a lot more precise by hardcoding the IBL
@@ -5540,6 +5598,239 @@ sig_should_swap_stack(struct clone_and_swap_args *args, kernel_ucontext_t *ucxt)
 }
 #endif
 
+#ifdef LINUX
+/* The seccomp trap on the app installing its own SIGILL or SIGSYS handler while
+ * -avx512_lazy_takeover runs it natively: such a handler would take the faults we
+ * wait for, so the takeover happens at the sigaction instead.  Our own copies of
+ * the classic BPF and seccomp definitions, as for the signal structures.
+ */
+#    define LAZY_BPF_LD_W_ABS 0x20 /* BPF_LD | BPF_W | BPF_ABS */
+#    define LAZY_BPF_JEQ_K 0x15    /* BPF_JMP | BPF_JEQ | BPF_K */
+#    define LAZY_BPF_JGE_K 0x35    /* BPF_JMP | BPF_JGE | BPF_K */
+#    define LAZY_BPF_JGT_K 0x25    /* BPF_JMP | BPF_JGT | BPF_K */
+#    define LAZY_BPF_RET_K 0x06    /* BPF_RET | BPF_K */
+#    define LAZY_SECCOMP_SET_MODE_FILTER 1
+#    define LAZY_SECCOMP_RET_TRAP 0x00030000U
+#    define LAZY_SECCOMP_RET_ALLOW 0x7fff0000U
+#    define LAZY_SYS_SECCOMP 1 /* si_code of a seccomp SIGSYS */
+#    define LAZY_PR_SET_NO_NEW_PRIVS 38
+#    define LAZY_AUDIT_ARCH IF_X64_ELSE(0xc000003eU, 0x40000003U)
+/* struct seccomp_data: nr, arch, instruction_pointer, args[6] */
+#    define LAZY_SECCOMP_NR 0
+#    define LAZY_SECCOMP_ARCH 4
+#    define LAZY_SECCOMP_IP_LO 8
+#    define LAZY_SECCOMP_IP_HI 12
+#    define LAZY_SECCOMP_ARG_LO(i) (16 + 8 * (i))
+#    define LAZY_SECCOMP_ARG_HI(i) (20 + 8 * (i))
+
+typedef struct {
+    ushort code;
+    byte jt;
+    byte jf;
+    uint k;
+} lazy_bpf_insn_t;
+
+typedef struct {
+    ushort len;
+    lazy_bpf_insn_t *filter;
+} lazy_bpf_prog_t;
+
+static bool lazy_takeover_trapped;
+
+/* A filter cannot be removed, so it is installed once and traps only sigactions
+ * made outside DR's own library: under DR the app's are emulated, not executed.
+ */
+static bool
+lazy_takeover_install_trap(void)
+{
+    ptr_uint_t lib_start = (ptr_uint_t)get_dynamorio_dll_start();
+    ptr_uint_t lib_last = (ptr_uint_t)get_dynamorio_dll_end() - 1;
+    lazy_bpf_insn_t insns[] = {
+        /* 0 */ { LAZY_BPF_LD_W_ABS, 0, 0, LAZY_SECCOMP_ARCH },
+        /* 1 */ { LAZY_BPF_JEQ_K, 0, 15, LAZY_AUDIT_ARCH },
+        /* 2 */ { LAZY_BPF_LD_W_ABS, 0, 0, LAZY_SECCOMP_NR },
+        /* 3 */ { LAZY_BPF_JEQ_K, 0, 13, SYS_rt_sigaction },
+        /* 4 */ { LAZY_BPF_LD_W_ABS, 0, 0, LAZY_SECCOMP_ARG_LO(0) },
+        /* 5 */ { LAZY_BPF_JEQ_K, 1, 0, SIGILL },
+        /* 6 */ { LAZY_BPF_JEQ_K, 0, 10, SIGSYS },
+        /* a NULL act only queries */
+        /* 7 */ { LAZY_BPF_LD_W_ABS, 0, 0, LAZY_SECCOMP_ARG_LO(1) },
+        /* 8 */ { LAZY_BPF_JEQ_K, 0, 2, 0 },
+        /* 9 */ { LAZY_BPF_LD_W_ABS, 0, 0, LAZY_SECCOMP_ARG_HI(1) },
+        /* 10 */ { LAZY_BPF_JEQ_K, 6, 0, 0 },
+        /* 11 */ { LAZY_BPF_LD_W_ABS, 0, 0, LAZY_SECCOMP_IP_HI },
+        /* 12 */ { LAZY_BPF_JEQ_K, 0, 3, (uint)((uint64)lib_start >> 32) },
+        /* 13 */ { LAZY_BPF_LD_W_ABS, 0, 0, LAZY_SECCOMP_IP_LO },
+        /* 14 */ { LAZY_BPF_JGE_K, 0, 1, (uint)lib_start },
+        /* 15 */ { LAZY_BPF_JGT_K, 0, 1, (uint)lib_last },
+        /* 16 */ { LAZY_BPF_RET_K, 0, 0, LAZY_SECCOMP_RET_TRAP },
+        /* 17 */ { LAZY_BPF_RET_K, 0, 0, LAZY_SECCOMP_RET_ALLOW },
+    };
+    lazy_bpf_prog_t prog = { BUFFER_SIZE_ELEMENTS(insns), insns };
+    if (lazy_takeover_trapped)
+        return true;
+    /* the filter compares 32 bits at a time */
+    if ((uint64)lib_start >> 32 != (uint64)lib_last >> 32 ||
+        !DYNAMO_OPTION(intercept_all_signals))
+        return false;
+    if (dynamorio_syscall(SYS_prctl, 5, LAZY_PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) != 0 ||
+        dynamorio_syscall(SYS_seccomp, 3, LAZY_SECCOMP_SET_MODE_FILTER, 0, &prog) != 0)
+        return false;
+    lazy_takeover_trapped = true;
+    return true;
+}
+
+/* Whether a SIGSYS comes from our trap.  The kernel leaves the pc after the
+ * syscall and the syscall number in place, so backing up re-executes it.
+ */
+static bool
+lazy_takeover_is_trap(int sig, kernel_siginfo_t *siginfo)
+{
+    return sig == SIGSYS && lazy_takeover_trapped &&
+        siginfo->si_code == LAZY_SYS_SECCOMP && siginfo->si_syscall == SYS_rt_sigaction;
+}
+
+/* Our only handler for SIGILL and SIGSYS while -avx512_lazy_takeover runs the app
+ * natively.  It is replaced by main_signal_handler when the process is taken
+ * over, without being recorded as the app's: the app had the default action when
+ * we installed it.
+ */
+static void
+lazy_takeover_handler(int sig, kernel_siginfo_t *siginfo, kernel_ucontext_t *ucxt)
+{
+    sigcontext_t *sc = SIGCXT_FROM_UCXT(ucxt);
+    priv_mcontext_t mc;
+    bool trap = lazy_takeover_is_trap(sig, siginfo);
+    if (trap)
+        sc->SC_XIP -= syscall_instr_length(DEFAULT_ISA_MODE);
+    if (lazy_takeover_claimed != 0) {
+        /* Another thread is taking over the process.  Re-executing the instr
+         * either ends up in main_signal_handler or, once we return and unblock
+         * it, in the pending SUSPEND_SIGNAL that takes this thread over.
+         */
+        os_thread_yield();
+        return;
+    }
+    if (!trap && (sig != SIGILL || !is_avx512_encoding((byte *)sc->SC_XIP))) {
+        /* Not ours: take the default action, just as without DR. */
+        kernel_sigaction_t act;
+        memset(&act, 0, sizeof(act));
+        act.handler = (handler_t)SIG_DFL;
+        sigaction_syscall(sig, &act, NULL);
+        if (sig != SIGILL) /* a SIGSYS does not recur on return */
+            thread_signal(get_process_id(), get_sys_thread_id(), sig);
+        return;
+    }
+    if (!atomic_compare_exchange_int(&lazy_takeover_claimed, 0, 1)) {
+        os_thread_yield();
+        return;
+    }
+    if (dynamo_started) /* back from an -avx512_detach_quiet_ms detach */
+        RSTATS_INC(avx512_phase_reattaches);
+    /* ld.so has loaded the app's libraries since we last looked */
+    lazy_takeover_rescan = true;
+    /* We never return through the frame, so put back the app's mask it holds:
+     * dr_app_start() records the thread's current mask as the app's.
+     */
+    sigprocmask_syscall(SIG_SETMASK, SIGMASK_FROM_UCXT(ucxt), NULL,
+                        sizeof(kernel_sigset_t));
+    ucontext_to_mcontext(&mc, ucxt);
+    /* Take over this thread at the faulting instr, or at the sigaction that DR
+     * now emulates, and every other thread from the suspend-signal loop, as
+     * dr_app_start() does.
+     */
+    dynamo_start(&mc);
+    ASSERT_NOT_REACHED();
+}
+
+static void
+lazy_takeover_sigact(kernel_sigaction_t *act, int sig)
+{
+    set_handler_sigact(act, sig, (handler_t)lazy_takeover_handler);
+    /* Unlike in main_signal_handler, our own SUSPEND_SIGNAL must not interrupt the
+     * handler: a thread waiting on the takeover in there is at a DR pc.
+     */
+    kernel_sigfillset(&act->mask);
+}
+
+static bool
+lazy_takeover_default_action(int sig)
+{
+    kernel_sigaction_t oldact;
+    return sigaction_syscall(sig, NULL, &oldact) == 0 &&
+        oldact.handler == (handler_t)SIG_DFL;
+}
+
+bool
+signal_lazy_takeover_install(void)
+{
+    kernel_sigaction_t act;
+    if (!lazy_takeover_default_action(SIGILL) || !lazy_takeover_default_action(SIGSYS))
+        return false;
+    lazy_takeover_sigact(&act, SIGSYS);
+    if (sigaction_syscall(SIGSYS, &act, NULL) != 0)
+        return false;
+    if (!lazy_takeover_install_trap()) {
+        memset(&act, 0, sizeof(act));
+        act.handler = (handler_t)SIG_DFL;
+        sigaction_syscall(SIGSYS, &act, NULL);
+        return false;
+    }
+    lazy_takeover_sigact(&act, SIGILL);
+    return sigaction_syscall(SIGILL, &act, NULL) == 0;
+}
+
+void
+signal_lazy_takeover_rearm(void)
+{
+    ATOMIC_4BYTE_WRITE(&lazy_takeover_claimed, 1, false);
+    lazy_takeover_rearm = true;
+}
+
+void
+signal_lazy_takeover_release(void)
+{
+    lazy_takeover_rearm = false;
+    ATOMIC_4BYTE_WRITE(&lazy_takeover_claimed, 0, false);
+}
+
+bool
+signal_lazy_takeover_possible(dcontext_t *dcontext)
+{
+    thread_sig_info_t *info = (thread_sig_info_t *)dcontext->signal_field;
+    return info->sighand->action[SIGILL] == NULL &&
+        info->sighand->action[SIGSYS] == NULL && lazy_takeover_install_trap();
+}
+
+bool
+signal_lazy_takeover_needs_rescan(void)
+{
+    bool rescan = lazy_takeover_rescan;
+    lazy_takeover_rescan = false;
+    return rescan;
+}
+
+/* Whether a native thread faulted on an AVX-512 instr, or hit the sigaction trap,
+ * while another thread takes over the process.  Backs a trapped sigaction up so
+ * that it is re-executed.
+ */
+static bool
+signal_lazy_takeover_pending(int sig, kernel_siginfo_t *siginfo,
+                             kernel_ucontext_t *ucxt)
+{
+    sigcontext_t *sc = SIGCXT_FROM_UCXT(ucxt);
+    if ((!DYNAMO_OPTION(avx512_lazy_takeover) &&
+         DYNAMO_OPTION(avx512_detach_quiet_ms) == 0) ||
+        lazy_takeover_claimed == 0)
+        return false;
+    if (lazy_takeover_is_trap(sig, siginfo)) {
+        sc->SC_XIP -= syscall_instr_length(DEFAULT_ISA_MODE);
+        return true;
+    }
+    return sig == SIGILL && is_avx512_encoding((byte *)sc->SC_XIP);
+}
+#endif
+
 /* Helper that takes over the current thread signaled via SUSPEND_SIGNAL.  Kept
  * separate mostly to keep the priv_mcontext_t allocation out of
  * main_signal_handler_C.
@@ -5758,6 +6049,15 @@ main_signal_handler_C(byte *xsp)
             if (!sig_take_over(ucxt))
                 return;
             ASSERT_NOT_REACHED(); /* else, shouldn't return */
+#ifdef LINUX
+        } else if ((sig == SIGILL || sig == SIGSYS) && dcontext == NULL &&
+                   signal_lazy_takeover_pending(sig, siginfo, ucxt)) {
+            /* A thread not yet taken over by -avx512_lazy_takeover: spin on the
+             * instr until our SUSPEND_SIGNAL reaches it.
+             */
+            os_thread_yield();
+            return;
+#endif
         } else {
             LOG(GLOBAL, LOG_ASYNCH, 1,
                 "signal with no siginfo (tid=%d, sig=%d): attempting to deliver to "
@@ -7479,8 +7779,8 @@ is_signal_restorer_code(byte *pc, size_t *len)
     return false;
 }
 
-void
-os_forge_exception(app_pc target_pc, dr_exception_type_t type)
+static void
+os_forge_signal(app_pc target_pc, int sig, int code, app_pc addr)
 {
     /* PR 205136:
      * We want to deliver now, and the caller expects us not to return.
@@ -7503,20 +7803,9 @@ os_forge_exception(app_pc target_pc, dr_exception_type_t type)
 #endif
     char frame_no_xstate[sizeof(sigframe_rt_t)];
     sigframe_rt_t *frame = (sigframe_rt_t *)frame_no_xstate;
-    int sig;
     dr_where_am_i_t cur_whereami = dcontext->whereami;
     kernel_ucontext_t *uc = get_ucontext_from_rt_frame(frame);
     sigcontext_t *sc = SIGCXT_FROM_UCXT(uc);
-    switch (type) {
-    case ILLEGAL_INSTRUCTION_EXCEPTION: sig = SIGILL; break;
-    case UNREADABLE_MEMORY_EXECUTION_EXCEPTION: sig = SIGSEGV; break;
-    case SINGLE_STEP_EXCEPTION: ASSERT_NOT_IMPLEMENTED(false); /* FIXME: i#2144 */
-    case IN_PAGE_ERROR_EXCEPTION: /* fall-through: Windows only */
-    default:
-        ASSERT_NOT_REACHED();
-        sig = SIGSEGV;
-        break;
-    }
 
     LOG(GLOBAL, LOG_ASYNCH, 1, "os_forge_exception sig=%d\n", sig);
 
@@ -7529,8 +7818,8 @@ os_forge_exception(app_pc target_pc, dr_exception_type_t type)
      * avoid the !is_sys_kill() check in record_pending_signal() to avoid an
      * infinite loop (i#3171).
      */
-    frame->info.si_code = IF_LINUX_ELSE(SI_KERNEL, 0);
-    frame->info.si_addr = target_pc;
+    frame->info.si_code = code;
+    frame->info.si_addr = addr;
 #ifdef X86_32
     frame->sig = sig;
     frame->pinfo = &frame->info;
@@ -7542,6 +7831,10 @@ os_forge_exception(app_pc target_pc, dr_exception_type_t type)
 #endif
     mcontext_to_ucontext(uc, get_mcontext(dcontext));
     sc->SC_XIP = (reg_t)target_pc;
+#if defined(LINUX) && defined(X86)
+    if (sig == SIGSEGV)
+        sc->cr2 = (ptr_uint_t)addr;
+#endif
     /* We'll fill in fpstate at delivery time.
      * We fill in segment registers to their current values and assume they won't
      * change and that these are the right values.
@@ -7583,6 +7876,37 @@ os_forge_exception(app_pc target_pc, dr_exception_type_t type)
     ASSERT_NOT_REACHED();
 }
 
+void
+os_forge_exception(app_pc target_pc, dr_exception_type_t type)
+{
+    int sig;
+    switch (type) {
+    case ILLEGAL_INSTRUCTION_EXCEPTION: sig = SIGILL; break;
+    case UNREADABLE_MEMORY_EXECUTION_EXCEPTION: sig = SIGSEGV; break;
+    case SINGLE_STEP_EXCEPTION: ASSERT_NOT_IMPLEMENTED(false); /* FIXME: i#2144 */
+    case IN_PAGE_ERROR_EXCEPTION: /* fall-through: Windows only */
+    default:
+        ASSERT_NOT_REACHED();
+        sig = SIGSEGV;
+        break;
+    }
+    os_forge_signal(target_pc, sig, IF_LINUX_ELSE(SI_KERNEL, 0), target_pc);
+}
+
+#ifdef LINUX
+void
+os_forge_memory_fault(app_pc target_pc, app_pc fault_addr)
+{
+    /* As the kernel reports it: an access to a mapping its protection does not
+     * allow is SEGV_ACCERR, anything else SEGV_MAPERR.
+     */
+    os_forge_signal(target_pc, SIGSEGV,
+                    get_memory_info_from_os(fault_addr, NULL, NULL, NULL) ? SEGV_ACCERR
+                                                                           : SEGV_MAPERR,
+                    fault_addr);
+}
+#endif
+
 void
 os_request_fatal_coredump(const char *msg)
 {
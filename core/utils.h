@@ -493,6 +493,9 @@ enum {
     LOCK_RANK(aslr_areas),          /* < dynamo_areas < global_alloc_lock */
     LOCK_RANK(aslr_pad_areas),      /* < dynamo_areas < global_alloc_lock */
     LOCK_RANK(native_exec_areas),   /* < dynamo_areas < global_alloc_lock */
+    LOCK_RANK(avx512_cache_lock),   /* > module_data_lock, < dynamo_areas */
+    LOCK_RANK(avx512_helper_lock),  /* < dynamo_areas */
+    LOCK_RANK(avx512_interp_lock),  /* < dynamo_areas */
     LOCK_RANK(thread_vm_areas),     /* currently never used */
 
     LOCK_RANK(app_pc_table_rwlock), /* > after_call_lock, > rct_module_lock,
@@ -1546,6 +1546,41 @@ test_avx512_bf16_encoding(void *dc)
     }
 }
 
+static void
+test_avx512_vinsert_256_encoding(void *dc)
+{
+    /* The 256-bit inserts take a full zmm src1 and a ymm/m256 src2, bytes from gas. */
+    // clang-format off
+    // 62 f3 f5 49 3a c2 01  vinserti64x4 $0x1,%ymm2,%zmm1,%zmm0{%k1}
+    // 62 63 15 c7 1a 71 01 01  vinsertf32x8 $0x1,0x20(%rcx),%zmm29,%zmm30{%k7}{z}
+    // 62 83 f5 40 1a c7 00  vinsertf64x4 $0x0,%ymm31,%zmm17,%zmm16
+    // 62 b3 75 4a 3a 94 f5 00 00 00 10 01  vinserti32x8 $0x1,0x10000000(%rbp,%r14,8),%zmm1,%zmm2{%k2}
+    byte out0[] = { 0x62, 0xf3, 0xf5, 0x49, 0x3a, 0xc2, 0x01,};
+    byte out1[] = { 0x62, 0x63, 0x15, 0xc7, 0x1a, 0x71, 0x01, 0x01,};
+    byte out2[] = { 0x62, 0x83, 0xf5, 0x40, 0x1a, 0xc7, 0x00,};
+    byte out3[] = { 0x62, 0xb3, 0x75, 0x4a, 0x3a, 0x94, 0xf5, 0x00, 0x00, 0x00, 0x10, 0x01,};
+    // clang-format on
+    instr_t *instr;
+
+    instr = INSTR_CREATE_vinserti64x4_mask(dc, REGARG(ZMM0), REGARG(K1),
+                                           OPND_CREATE_INT8(1), REGARG(ZMM1),
+                                           REGARG(YMM2));
+    test_instr_decode(dc, instr, out0, sizeof(out0), true);
+    instr = INSTR_CREATE_vinsertf32x8_mask(
+        dc, REGARG(ZMM30), REGARG(K7), OPND_CREATE_INT8(1), REGARG(ZMM29),
+        opnd_create_base_disp(DR_REG_RCX, DR_REG_NULL, 0, 0x20, OPSZ_32));
+    instr_set_prefix_flag(instr, PREFIX_EVEX_z);
+    test_instr_decode(dc, instr, out1, sizeof(out1), true);
+    instr = INSTR_CREATE_vinsertf64x4_mask(dc, REGARG(ZMM16), REGARG(K0),
+                                           OPND_CREATE_INT8(0), REGARG(ZMM17),
+                                           REGARG(YMM31));
+    test_instr_decode(dc, instr, out2, sizeof(out2), true);
+    instr = INSTR_CREATE_vinserti32x8_mask(
+        dc, REGARG(ZMM2), REGARG(K2), OPND_CREATE_INT8(1), REGARG(ZMM1),
+        opnd_create_base_disp(DR_REG_RBP, DR_REG_R14, 8, 0x10000000, OPSZ_32));
+    test_instr_decode(dc, instr, out3, sizeof(out3), true);
+}
+
 static void
 test_x64_vmovq(void *dc)
 {
@@ -2920,6 +2955,8 @@ main(int argc, char *argv[])
 
     test_avx512_bf16_encoding(dcontext);
 
+    test_avx512_vinsert_256_encoding(dcontext);
+
     test_x64_vmovq(dcontext);
 #endif
 
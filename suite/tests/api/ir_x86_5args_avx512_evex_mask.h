@@ -67,24 +67,22 @@ OPCODE(vinsertf64x2_zhik7zhixhii, vinsertf64x2, vinsertf64x2_mask, X64_ONLY,
        REGARG(XMM31))
 OPCODE(vinsertf64x2_zhik7zhildi, vinsertf64x2, vinsertf64x2_mask, X64_ONLY, REGARG(ZMM16),
        REGARG(K7), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM31, OPSZ_16), MEMARG(OPSZ_16))
-OPCODE(vinsertf32x8_zlok0zloxloi, vinsertf32x8, vinsertf32x8_mask, 0, REGARG(ZMM0),
-       REGARG(K0), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM1, OPSZ_16), REGARG(XMM2))
+OPCODE(vinsertf32x8_zlok0zloyloi, vinsertf32x8, vinsertf32x8_mask, 0, REGARG(ZMM0),
+       REGARG(K0), IMMARG(OPSZ_1), REGARG(ZMM1), REGARG(YMM2))
 OPCODE(vinsertf32x8_zlok0zloldi, vinsertf32x8, vinsertf32x8_mask, 0, REGARG(ZMM0),
-       REGARG(K0), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM1, OPSZ_16), MEMARG(OPSZ_16))
-OPCODE(vinsertf32x8_zhik7zhixhii, vinsertf32x8, vinsertf32x8_mask, X64_ONLY,
-       REGARG(ZMM16), REGARG(K7), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM17, OPSZ_16),
-       REGARG(XMM31))
+       REGARG(K0), IMMARG(OPSZ_1), REGARG(ZMM1), MEMARG(OPSZ_32))
+OPCODE(vinsertf32x8_zhik7zhiyhii, vinsertf32x8, vinsertf32x8_mask, X64_ONLY,
+       REGARG(ZMM16), REGARG(K7), IMMARG(OPSZ_1), REGARG(ZMM17), REGARG(YMM31))
 OPCODE(vinsertf32x8_zhik7zhildi, vinsertf32x8, vinsertf32x8_mask, X64_ONLY, REGARG(ZMM16),
-       REGARG(K7), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM31, OPSZ_16), MEMARG(OPSZ_16))
-OPCODE(vinsertf64x4_zlok0zloxloi, vinsertf64x4, vinsertf64x4_mask, 0, REGARG(ZMM0),
-       REGARG(K0), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM1, OPSZ_16), REGARG(XMM2))
+       REGARG(K7), IMMARG(OPSZ_1), REGARG(ZMM31), MEMARG(OPSZ_32))
+OPCODE(vinsertf64x4_zlok0zloyloi, vinsertf64x4, vinsertf64x4_mask, 0, REGARG(ZMM0),
+       REGARG(K0), IMMARG(OPSZ_1), REGARG(ZMM1), REGARG(YMM2))
 OPCODE(vinsertf64x4_zlok0zloldi, vinsertf64x4, vinsertf64x4_mask, 0, REGARG(ZMM0),
-       REGARG(K0), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM1, OPSZ_16), MEMARG(OPSZ_16))
-OPCODE(vinsertf64x4_zhik7zhixhii, vinsertf64x4, vinsertf64x4_mask, X64_ONLY,
-       REGARG(ZMM16), REGARG(K7), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM17, OPSZ_16),
-       REGARG(XMM31))
+       REGARG(K0), IMMARG(OPSZ_1), REGARG(ZMM1), MEMARG(OPSZ_32))
+OPCODE(vinsertf64x4_zhik7zhiyhii, vinsertf64x4, vinsertf64x4_mask, X64_ONLY,
+       REGARG(ZMM16), REGARG(K7), IMMARG(OPSZ_1), REGARG(ZMM17), REGARG(YMM31))
 OPCODE(vinsertf64x4_zhik7zhildi, vinsertf64x4, vinsertf64x4_mask, X64_ONLY, REGARG(ZMM16),
-       REGARG(K7), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM31, OPSZ_16), MEMARG(OPSZ_16))
+       REGARG(K7), IMMARG(OPSZ_1), REGARG(ZMM31), MEMARG(OPSZ_32))
 OPCODE(vinserti32x4_ylok0yloxloi, vinserti32x4, vinserti32x4_mask, 0, REGARG(YMM0),
        REGARG(K0), IMMARG(OPSZ_1), REGARG_PARTIAL(YMM1, OPSZ_16), REGARG(XMM2))
 OPCODE(vinserti32x4_ylok0yloldi, vinserti32x4, vinserti32x4_mask, 0, REGARG(YMM0),
@@ -121,24 +119,22 @@ OPCODE(vinserti64x2_zhik7zhixhii, vinserti64x2, vinserti64x2_mask, X64_ONLY,
        REGARG(XMM31))
 OPCODE(vinserti64x2_zhik7zhildi, vinserti64x2, vinserti64x2_mask, X64_ONLY, REGARG(ZMM16),
        REGARG(K7), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM31, OPSZ_16), MEMARG(OPSZ_16))
-OPCODE(vinserti32x8_zlok0zloxloi, vinserti32x8, vinserti32x8_mask, 0, REGARG(ZMM0),
-       REGARG(K0), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM1, OPSZ_16), REGARG(XMM2))
+OPCODE(vinserti32x8_zlok0zloyloi, vinserti32x8, vinserti32x8_mask, 0, REGARG(ZMM0),
+       REGARG(K0), IMMARG(OPSZ_1), REGARG(ZMM1), REGARG(YMM2))
 OPCODE(vinserti32x8_zlok0zloldi, vinserti32x8, vinserti32x8_mask, 0, REGARG(ZMM0),
-       REGARG(K0), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM1, OPSZ_16), MEMARG(OPSZ_16))
-OPCODE(vinserti32x8_zhik7zhixhii, vinserti32x8, vinserti32x8_mask, X64_ONLY,
-       REGARG(ZMM16), REGARG(K7), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM17, OPSZ_16),
-       REGARG(XMM31))
+       REGARG(K0), IMMARG(OPSZ_1), REGARG(ZMM1), MEMARG(OPSZ_32))
+OPCODE(vinserti32x8_zhik7zhiyhii, vinserti32x8, vinserti32x8_mask, X64_ONLY,
+       REGARG(ZMM16), REGARG(K7), IMMARG(OPSZ_1), REGARG(ZMM17), REGARG(YMM31))
 OPCODE(vinserti32x8_zhik7zhildi, vinserti32x8, vinserti32x8_mask, X64_ONLY, REGARG(ZMM16),
-       REGARG(K7), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM31, OPSZ_16), MEMARG(OPSZ_16))
-OPCODE(vinserti64x4_zlok0zloxloi, vinserti64x4, vinserti64x4_mask, 0, REGARG(ZMM0),
-       REGARG(K0), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM1, OPSZ_16), REGARG(XMM2))
+       REGARG(K7), IMMARG(OPSZ_1), REGARG(ZMM31), MEMARG(OPSZ_32))
+OPCODE(vinserti64x4_zlok0zloyloi, vinserti64x4, vinserti64x4_mask, 0, REGARG(ZMM0),
+       REGARG(K0), IMMARG(OPSZ_1), REGARG(ZMM1), REGARG(YMM2))
 OPCODE(vinserti64x4_zlok0zloldi, vinserti64x4, vinserti64x4_mask, 0, REGARG(ZMM0),
-       REGARG(K0), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM1, OPSZ_16), MEMARG(OPSZ_16))
-OPCODE(vinserti64x4_zhik7zhixhii, vinserti64x4, vinserti64x4_mask, X64_ONLY,
-       REGARG(ZMM16), REGARG(K7), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM17, OPSZ_16),
-       REGARG(XMM31))
+       REGARG(K0), IMMARG(OPSZ_1), REGARG(ZMM1), MEMARG(OPSZ_32))
+OPCODE(vinserti64x4_zhik7zhiyhii, vinserti64x4, vinserti64x4_mask, X64_ONLY,
+       REGARG(ZMM16), REGARG(K7), IMMARG(OPSZ_1), REGARG(ZMM17), REGARG(YMM31))
 OPCODE(vinserti64x4_zhik7zhildi, vinserti64x4, vinserti64x4_mask, X64_ONLY, REGARG(ZMM16),
-       REGARG(K7), IMMARG(OPSZ_1), REGARG_PARTIAL(ZMM31, OPSZ_16), MEMARG(OPSZ_16))
+       REGARG(K7), IMMARG(OPSZ_1), REGARG(ZMM31), MEMARG(OPSZ_32))
 OPCODE(vpcmpb_k0k0xloxlo, vpcmpb, vpcmpb_mask, 0, REGARG(K0), REGARG(K0), IMMARG(OPSZ_1),
        REGARG(XMM0), REGARG(XMM1))
 OPCODE(vpcmpb_k0k0xlold, vpcmpb, vpcmpb_mask, 0, REGARG(K0), REGARG(K0), IMMARG(OPSZ_1),
@@ -0,0 +1,144 @@
+/**
+ * @file avx512_test.h
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * avx512_test.h -- shared helpers of the tests of the AVX-512 lowerings
+ *
+ * Each test runs the instrs it covers through inline asm on 64-byte buffers and
+ * compares the result with a scalar model of the instr, printing one line per
+ * case.  The tests are built without AVX-512 code generation, so that only the
+ * asm below reaches the rewriter and the models stay plain C, and every case
+ * runs twice: once on zmm0-3, whose low halves live in the physical ymm
+ * registers, and once on zmm16-19, which live in TLS.
+ */
+
+#ifndef AVX512_TEST_H
+#define AVX512_TEST_H
+
+#include "tools.h"
+#include <stdint.h>
+#include <string.h>
+
+typedef union {
+    uint8_t b[64];
+    uint16_t w[32];
+    uint32_t d[16];
+    uint64_t q[8];
+    int8_t sb[64];
+    int16_t sw[32];
+    int32_t sd[16];
+    int64_t sq[8];
+    float f[16];
+    double df[8];
+} __attribute__((aligned(64))) vec512_t;
+
+static uint64_t avx512_test_state = 0x9e3779b97f4a7c15ULL;
+
+/* xorshift64, so that every run sees the same inputs */
+static inline uint64_t
+test_rand(void)
+{
+    avx512_test_state ^= avx512_test_state << 13;
+    avx512_test_state ^= avx512_test_state >> 7;
+    avx512_test_state ^= avx512_test_state << 17;
+    return avx512_test_state;
+}
+
+static inline void
+vec_fill(vec512_t *v)
+{
+    for (int i = 0; i < 8; i++)
+        v->q[i] = test_rand();
+}
+
+/* Compares the first `bytes` bytes of got and want and prints the verdict. */
+static inline bool
+vec_check(const char *name, const vec512_t *got, const vec512_t *want, int bytes)
+{
+    for (int i = 0; i < bytes / 4; i++) {
+        if (got->d[i] != want->d[i]) {
+            print("%s: dword %d is 0x%08x, expected 0x%08x\n", name, i, got->d[i], want->d[i]);
+            return false;
+        }
+    }
+    print("%s ok\n", name);
+    return true;
+}
+
+/* Applies the opmask k to elements of `esize` bytes of a full result, as the
+ * EVEX encoding does for a vector of `bytes` bytes: merging into old or zeroing,
+ * and zeroing everything past the vector length.
+ */
+static inline void
+vec_mask(vec512_t *res, const vec512_t *old, uint64_t k, int esize, int bytes, bool zero)
+{
+    for (int i = 0; i < 64 / esize; i++) {
+        bool keep = i < bytes / esize && (k >> i & 1) != 0;
+        bool in_vl = i < bytes / esize;
+        if (keep)
+            continue;
+        if (in_vl && !zero)
+            memcpy(&res->b[i * esize], &old->b[i * esize], esize);
+        else
+            memset(&res->b[i * esize], 0, esize);
+    }
+}
+
+/* The register sets a case runs on, by number: D is the destination, A and B
+ * the sources and C a spare one.  ZMM(), YMM() and XMM() name them in asm.
+ */
+#define LO_D 0
+#define LO_A 1
+#define LO_B 2
+#define LO_C 3
+#define HI_D 16
+#define HI_A 17
+#define HI_B 18
+#define HI_C 19
+
+#define AVX512_STR(x) #x
+#define AVX512_XSTR(x) AVX512_STR(x)
+#define ZMM(n) "%%zmm" AVX512_XSTR(n)
+#define YMM(n) "%%ymm" AVX512_XSTR(n)
+#define XMM(n) "%%xmm" AVX512_XSTR(n)
+
+/* The masking suffixes of an instr in the templates below. */
+#define MERGE "%{%%k1%}"
+#define ZERO "%{%%k1%}%{z%}"
+
+/*
+ * Loads zmm A from a, zmm B from b, zmm D from *r and k1 from k, runs insn and
+ * stores zmm D back into *r.  insn may name b as the memory operand %2.  The
+ * opmask and zmm16-31 are not clobbers the compiler knows of without AVX-512,
+ * but nothing else in a test uses them.
+ */
+#define AVX512_RUN(insn, D, A, B, r, a, b, k)                                                   \
+    __asm__ __volatile__("vmovdqu64 %1, " ZMM(A) "\n\t"                                          \
+                         "vmovdqu64 %2, " ZMM(B) "\n\t"                                          \
+                         "vmovdqu64 %0, " ZMM(D) "\n\t"                                          \
+                         "kmovq %3, %%k1\n\t" insn "\n\t"                                       \
+                         "vmovdqu64 " ZMM(D) ", %0"                                              \
+                         : "+m"(*(r))                                                           \
+                         : "m"(*(a)), "m"(*(b)), "r"((uint64_t)(k))                             \
+                         : "xmm0", "xmm1", "xmm2", "xmm3", "memory")
+
+/*
+ * Runs case `name` (a string literal) on both register sets, with OP(D, A, B)
+ * building the instr text, and checks the first `bytes` bytes of the result
+ * against want.  The destination starts out as *init.
+ */
+#define AVX512_CASE(name, OP, init, a, b, k, want, bytes)                       \
+    do {                                                                         \
+        vec512_t res_ = *(init);                                                 \
+        AVX512_RUN(OP(LO_D, LO_A, LO_B), LO_D, LO_A, LO_B, &res_, a, b, k);       \
+        vec_check(name " zmm0-3", &res_, want, bytes);                           \
+        res_ = *(init);                                                          \
+        AVX512_RUN(OP(HI_D, HI_A, HI_B), HI_D, HI_A, HI_B, &res_, a, b, k);       \
+        vec_check(name " zmm16-19", &res_, want, bytes);                         \
+    } while (0)
+
+#endif /* AVX512_TEST_H */
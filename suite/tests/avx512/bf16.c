@@ -0,0 +1,128 @@
+/**
+ * @file bf16.c
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * bf16.c -- vcvtne2ps2bf16, vcvtneps2bf16 and vdpbf16ps (user-034)
+ */
+
+#include "tools.h"
+#include "avx512_test.h"
+
+static uint32_t
+bf16_flush(uint32_t x)
+{
+    return (x & 0x7f800000) == 0 ? x & 0x80000000 : x;
+}
+
+/* round to nearest even, denormals flushed and NaNs quieted */
+static uint16_t
+bf16_round(uint32_t x)
+{
+    x = bf16_flush(x);
+    if ((x & 0x7fffffff) > 0x7f800000)
+        return (uint16_t)((x | 0x00400000) >> 16);
+    return (uint16_t)((x + 0x7fff + (x >> 16 & 1)) >> 16);
+}
+
+static float
+bf16_to_float(uint16_t h)
+{
+    uint32_t x = bf16_flush((uint32_t)h << 16);
+    float f;
+    memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+/* The products of two bf16 are exact in fp32, so each step rounds once as an FMA does. */
+static uint32_t
+bf16_dot(uint32_t acc, uint32_t a, uint32_t b)
+{
+    float r;
+    uint32_t x = bf16_flush(acc);
+    memcpy(&r, &x, sizeof(r));
+    r += bf16_to_float((uint16_t)(a >> 16)) * bf16_to_float((uint16_t)(b >> 16));
+    memcpy(&x, &r, sizeof(x));
+    x = bf16_flush(x);
+    memcpy(&r, &x, sizeof(r));
+    r += bf16_to_float((uint16_t)a) * bf16_to_float((uint16_t)b);
+    memcpy(&x, &r, sizeof(x));
+    return bf16_flush(x);
+}
+
+/* floats in [-4, 4) with a few rounding ties, denormals and NaNs mixed in */
+static void
+vec_fill_float(vec512_t *v)
+{
+    for (int i = 0; i < 16; i++) {
+        uint32_t r = (uint32_t)test_rand();
+        v->d[i] = (r & 0x80000000) | (0x3e000000 + (r & 0x01ffffff));
+    }
+    v->d[1] = 0x3f818000;  /* tie, rounds down to even */
+    v->d[2] = 0x3f838000;  /* tie, rounds up to even */
+    v->d[5] = 0x00012345;  /* denormal */
+    v->d[9] = 0xff812345;  /* sNaN */
+    v->d[14] = 0x7f7fffff; /* rounds to inf */
+}
+
+#define CVT2(D, A, B) "vcvtne2ps2bf16 " ZMM(B) ", " ZMM(A) ", " ZMM(D) MERGE
+#define CVT2_Y(D, A, B) "vcvtne2ps2bf16 %2, " YMM(A) ", " YMM(D) ZERO
+#define CVT_Z(D, A, B) "vcvtneps2bf16 " ZMM(A) ", " YMM(D) MERGE
+#define CVT_Y(D, A, B) "vcvtneps2bf16 " YMM(A) ", " XMM(D) ZERO
+#define CVT_X(D, A, B) "vcvtneps2bf16 " XMM(A) ", " XMM(D) MERGE
+#define CVT_BCST(D, A, B) "vcvtneps2bf16 %2%{1to16%}, " YMM(D)
+#define DP(D, A, B) "vdpbf16ps " ZMM(B) ", " ZMM(A) ", " ZMM(D) MERGE
+#define DP_Y(D, A, B) "vdpbf16ps %2, " YMM(A) ", " YMM(D) ZERO
+
+int
+main(void)
+{
+    vec512_t a, b, init, want;
+    uint64_t k = test_rand();
+    vec_fill_float(&a);
+    vec_fill_float(&b);
+    vec_fill(&init);
+
+    for (int i = 0; i < 32; i++)
+        want.w[i] = bf16_round(i < 16 ? b.d[i] : a.d[i - 16]);
+    vec_mask(&want, &init, k, 2, 64, false);
+    AVX512_CASE("vcvtne2ps2bf16", CVT2, &init, &a, &b, k, &want, 64);
+    /* of the ymm forms, only the narrowing vcvtneps2bf16 is checked above its result */
+    for (int i = 0; i < 16; i++)
+        want.w[i] = bf16_round(i < 8 ? b.d[i] : a.d[i - 8]);
+    vec_mask(&want, &init, k, 2, 32, true);
+    AVX512_CASE("vcvtne2ps2bf16 ymm mem zero", CVT2_Y, &init, &a, &b, k, &want, 32);
+
+    for (int i = 0; i < 16; i++)
+        want.w[i] = bf16_round(a.d[i]);
+    vec_mask(&want, &init, k, 2, 32, false);
+    AVX512_CASE("vcvtneps2bf16 zmm", CVT_Z, &init, &a, &b, k, &want, 64);
+    for (int i = 0; i < 8; i++)
+        want.w[i] = bf16_round(a.d[i]);
+    vec_mask(&want, &init, k, 2, 16, true);
+    AVX512_CASE("vcvtneps2bf16 ymm zero", CVT_Y, &init, &a, &b, k, &want, 64);
+    for (int i = 0; i < 4; i++)
+        want.w[i] = bf16_round(a.d[i]);
+    vec_mask(&want, &init, k, 2, 8, false);
+    AVX512_CASE("vcvtneps2bf16 xmm", CVT_X, &init, &a, &b, k, &want, 64);
+    for (int i = 0; i < 16; i++)
+        want.w[i] = bf16_round(b.d[0]);
+    vec_mask(&want, &init, ~0ull, 2, 32, false);
+    AVX512_CASE("vcvtneps2bf16 bcst", CVT_BCST, &init, &a, &b, k, &want, 64);
+
+    /* the dot products accumulate into floats and get NaN-free sources */
+    vec_fill_float(&init);
+    init.d[9] = a.d[9] = b.d[9] = 0x40490fdb;
+    for (int i = 0; i < 16; i++)
+        want.d[i] = bf16_dot(init.d[i], a.d[i], b.d[i]);
+    vec_mask(&want, &init, k, 4, 64, false);
+    AVX512_CASE("vdpbf16ps", DP, &init, &a, &b, k, &want, 64);
+    for (int i = 0; i < 8; i++)
+        want.d[i] = bf16_dot(init.d[i], a.d[i], b.d[i]);
+    vec_mask(&want, &init, k, 4, 32, true);
+    AVX512_CASE("vdpbf16ps ymm mem zero", DP_Y, &init, &a, &b, k, &want, 32);
+    return 0;
+}
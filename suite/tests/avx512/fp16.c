@@ -0,0 +1,169 @@
+/**
+ * @file fp16.c
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * fp16.c -- FP16 arithmetic, min/max on NaNs and the FMA under each rounding (user-033)
+ */
+
+#include "tools.h"
+#include "avx512_test.h"
+#include <math.h>
+#include <xmmintrin.h>
+
+#define RC_RN 0
+#define RC_RZ 3
+
+static double
+half_to_double(uint16_t h)
+{
+    int exp = h >> 10 & 0x1f;
+    if (exp == 0x1f)
+        return (h & 0x3ff) != 0 ? NAN : (h & 0x8000) != 0 ? -INFINITY : INFINITY;
+    double m = exp == 0 ? ldexp(h & 0x3ff, -24) : ldexp((h & 0x3ff) | 0x400, exp - 25);
+    return (h & 0x8000) != 0 ? -m : m;
+}
+
+/* Rounds x, which is exact in a double, to a half.  Only finite values come in. */
+static uint16_t
+half_round(double x, int rc)
+{
+    uint16_t sign = signbit(x) ? 0x8000 : 0;
+    double m = fabs(x);
+    int exp;
+    frexp(m, &exp);
+    int q = (m == 0 || exp - 1 < -14 ? -14 : exp - 1) - 10;
+    double n = ldexp(m, -q);
+    double units = floor(n);
+    if (rc == RC_RN && (n - units > 0.5 || (n - units == 0.5 && fmod(units, 2) == 1)))
+        units += 1;
+    double r = ldexp(units, q);
+    if (r >= 65536.0)
+        return sign | (rc == RC_RN ? 0x7c00 : 0x7bff);
+    if (r < ldexp(1, -14))
+        return sign | (uint16_t)ldexp(r, 24);
+    frexp(r, &exp);
+    return sign | (uint16_t)((exp + 14) << 10 | ((uint32_t)ldexp(r, 11 - exp) & 0x3ff));
+}
+
+/* halves of magnitude in [2^-6, 2^6), so that each sum and product is exact in a double */
+static void
+vec_fill_half(vec512_t *v)
+{
+    for (int i = 0; i < 32; i++) {
+        uint32_t r = (uint32_t)test_rand();
+        v->w[i] = (uint16_t)((r & 0x8000) | (9 + r % 12) << 10 | (r >> 16 & 0x3ff));
+    }
+}
+
+static void
+set_rc(int rc)
+{
+    _mm_setcsr((_mm_getcsr() & ~0x6000) | rc << 13);
+}
+
+#define ADD(D, A, B) "vaddph " ZMM(B) ", " ZMM(A) ", " ZMM(D) MERGE
+#define SUB_Y(D, A, B) "vsubph %2, " YMM(A) ", " YMM(D) ZERO
+#define MUL_BCST(D, A, B) "vmulph %2%{1to32%}, " ZMM(A) ", " ZMM(D) MERGE
+#define DIV_X(D, A, B) "vdivph " XMM(B) ", " XMM(A) ", " XMM(D) MERGE
+#define SQRT(D, A, B) "vsqrtph " ZMM(A) ", " ZMM(D) ZERO
+#define VMIN(D, A, B) "vminph " ZMM(B) ", " ZMM(A) ", " ZMM(D) MERGE
+#define VMAX_Y(D, A, B) "vmaxph %2, " YMM(A) ", " YMM(D) ZERO
+#define FMA231(D, A, B) "vfmadd231ph " ZMM(B) ", " ZMM(A) ", " ZMM(D) MERGE
+#define FMA132_Y(D, A, B) "vfmadd132ph %2, " YMM(A) ", " YMM(D) ZERO
+#define FMA213_RZ(D, A, B) "vfmadd213ph %{rz-sae%}, " ZMM(B) ", " ZMM(A) ", " ZMM(D) MERGE
+
+int
+main(void)
+{
+    vec512_t a, b, c, want;
+    uint64_t k = test_rand();
+    vec_fill_half(&a);
+    vec_fill_half(&b);
+    vec_fill_half(&c);
+    a.w[3] = 0x0123; /* subnormal */
+    b.w[7] = 0x8001; /* subnormal */
+
+    for (int i = 0; i < 32; i++)
+        want.w[i] = half_round(half_to_double(a.w[i]) + half_to_double(b.w[i]), RC_RN);
+    vec_mask(&want, &c, k, 2, 64, false);
+    AVX512_CASE("vaddph", ADD, &c, &a, &b, k, &want, 64);
+    for (int i = 0; i < 16; i++)
+        want.w[i] = half_round(half_to_double(a.w[i]) - half_to_double(b.w[i]), RC_RN);
+    vec_mask(&want, &c, k, 2, 32, true);
+    AVX512_CASE("vsubph ymm mem zero", SUB_Y, &c, &a, &b, k, &want, 32);
+    for (int i = 0; i < 32; i++)
+        want.w[i] = half_round(half_to_double(a.w[i]) * half_to_double(b.w[0]), RC_RN);
+    vec_mask(&want, &c, k, 2, 64, false);
+    AVX512_CASE("vmulph bcst", MUL_BCST, &c, &a, &b, k, &want, 64);
+    /* a double quotient or root rounds innocuously to a half, as 53 >= 2 * 11 + 2 */
+    for (int i = 0; i < 8; i++)
+        want.w[i] = half_round(half_to_double(a.w[i]) / half_to_double(b.w[i]), RC_RN);
+    vec_mask(&want, &c, k, 2, 16, false);
+    AVX512_CASE("vdivph xmm", DIV_X, &c, &a, &b, k, &want, 16);
+    vec512_t abs_a = a;
+    for (int i = 0; i < 32; i++) {
+        abs_a.w[i] &= 0x7fff;
+        want.w[i] = half_round(sqrt(half_to_double(abs_a.w[i])), RC_RN);
+    }
+    vec_mask(&want, &c, k, 2, 64, true);
+    AVX512_CASE("vsqrtph zero", SQRT, &c, &abs_a, &b, k, &want, 64);
+
+    /* either NaN or two zeros give the second source back untouched */
+    vec512_t na = a, nb = b;
+    na.w[1] = 0x7c01;  /* sNaN */
+    nb.w[2] = 0xfd55;  /* sNaN */
+    na.w[4] = 0x7e00;  /* qNaN */
+    nb.w[4] = 0xfc02;  /* sNaN */
+    na.w[5] = 0x0000;
+    nb.w[5] = 0x8000;
+    na.w[6] = 0x8000;
+    nb.w[6] = 0x0000;
+    na.w[20] = nb.w[20] = 0x7c11;
+    for (int i = 0; i < 32; i++)
+        want.w[i] = half_to_double(na.w[i]) < half_to_double(nb.w[i]) ? na.w[i] : nb.w[i];
+    vec_mask(&want, &c, k, 2, 64, false);
+    AVX512_CASE("vminph nan", VMIN, &c, &na, &nb, k, &want, 64);
+    for (int i = 0; i < 16; i++)
+        want.w[i] = half_to_double(na.w[i]) > half_to_double(nb.w[i]) ? na.w[i] : nb.w[i];
+    vec_mask(&want, &c, k, 2, 32, true);
+    AVX512_CASE("vmaxph ymm mem zero nan", VMAX_Y, &c, &na, &nb, k, &want, 32);
+
+    /* a * b lands on a tie of halves that only the addend breaks */
+    a.w[0] = 0x3e00;   /* 1.5 */
+    b.w[0] = 0x3956;   /* 683 * 2^-10 */
+    c.w[0] = 0x0001;   /* 2^-24 */
+    a.w[1] = 0x3e00;
+    b.w[1] = 0x3956;
+    c.w[1] = 0x8001;
+    c.w[2] = 0x0042;   /* subnormal */
+    for (int rc = RC_RN; rc <= RC_RZ; rc += RC_RZ) {
+        for (int i = 0; i < 32; i++) {
+            double exact = half_to_double(a.w[i]) * half_to_double(b.w[i]) + half_to_double(c.w[i]);
+            want.w[i] = half_round(exact, rc);
+        }
+        vec_mask(&want, &c, k, 2, 64, false);
+        set_rc(rc);
+        if (rc == RC_RN)
+            AVX512_CASE("vfmadd231ph rn", FMA231, &c, &a, &b, k, &want, 64);
+        else
+            AVX512_CASE("vfmadd231ph mxcsr rz", FMA231, &c, &a, &b, k, &want, 64);
+        set_rc(RC_RN);
+    }
+    for (int i = 0; i < 16; i++) {
+        double exact = half_to_double(c.w[i]) * half_to_double(b.w[i]) + half_to_double(a.w[i]);
+        want.w[i] = half_round(exact, RC_RN);
+    }
+    vec_mask(&want, &c, k, 2, 32, true);
+    AVX512_CASE("vfmadd132ph ymm mem zero", FMA132_Y, &c, &a, &b, k, &want, 32);
+    for (int i = 0; i < 32; i++) {
+        double exact = half_to_double(a.w[i]) * half_to_double(c.w[i]) + half_to_double(b.w[i]);
+        want.w[i] = half_round(exact, RC_RZ);
+    }
+    vec_mask(&want, &c, k, 2, 64, false);
+    AVX512_CASE("vfmadd213ph rz-sae", FMA213_RZ, &c, &a, &b, k, &want, 64);
+    return 0;
+}
@@ -0,0 +1,65 @@
+/**
+ * @file helper_stack.c
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * helper_stack.c -- a lowering moved out of line leaves the app stack alone (user-047)
+ *
+ * Run with -avx512_helper_threshold 1, so that every chain that pays for its call
+ * goes into a helper.  The 256 bytes below the stack pointer, the red zone and
+ * past it, are filled with a pattern before a vpaddd on TLS-held zmms and
+ * read back after it.  The loop runs long enough for the block to be copied into
+ * a trace.
+ */
+
+#include "tools.h"
+#include "avx512_test.h"
+
+#define BELOW_QWORDS 32
+#define PATTERN 0x5a5a5a5a5a5a5a5aULL
+
+static vec512_t a, b, res, want;
+static uint64_t below[BELOW_QWORDS];
+
+int
+main(void)
+{
+    bool intact = true;
+    vec_fill(&a);
+    vec_fill(&b);
+    for (int i = 0; i < 16; i++)
+        want.d[i] = a.d[i] + b.d[i];
+
+    for (int iter = 0; iter < 100; iter++) {
+        __asm__ __volatile__("lea -256(%%rsp), %%rdi\n\t"
+                             "mov $32, %%ecx\n\t"
+                             "movabs $0x5a5a5a5a5a5a5a5a, %%rax\n\t"
+                             "rep stosq\n\t"
+                             "vmovdqu64 (%[a]), %%zmm17\n\t"
+                             "vmovdqu64 (%[b]), %%zmm18\n\t"
+                             "vpaddd %%zmm18, %%zmm17, %%zmm16\n\t"
+                             "vmovdqu64 %%zmm16, (%[res])\n\t"
+                             "lea -256(%%rsp), %%rsi\n\t"
+                             "mov %[below], %%rdi\n\t"
+                             "mov $32, %%ecx\n\t"
+                             "rep movsq"
+                             :
+                             : [a] "r"(&a), [b] "r"(&b), [res] "r"(&res), [below] "r"(below)
+                             : "rax", "rcx", "rsi", "rdi", "memory");
+        for (int i = 0; i < BELOW_QWORDS; i++) {
+            if (below[i] != PATTERN) {
+                print("iter %d: app stack written at -%d\n", iter, 256 - 8 * i);
+                intact = false;
+                break;
+            }
+        }
+        if (!intact || memcmp(&res, &want, sizeof(res)) != 0)
+            break;
+    }
+    vec_check("vpaddd via a helper", &res, &want, 64);
+    print("app stack below xsp %s\n", intact ? "intact" : "written");
+    return 0;
+}
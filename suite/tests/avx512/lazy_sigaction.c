@@ -0,0 +1,75 @@
+/**
+ * @file lazy_sigaction.c
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * lazy_sigaction.c -- a SIGILL handler installed while native takes the process over (user-043)
+ *
+ * Run with -avx512_lazy_takeover -hide_avx512 1.  The app starts native, so that
+ * cpuid shows what the host has.  Installing a SIGILL handler must not shadow the
+ * AVX-512 trap: DR takes over at the sigaction, after which cpuid hides AVX-512F,
+ * the handler is the app's for its own faults and AVX-512 code runs rewritten.
+ */
+
+#include "tools.h"
+#include "avx512_test.h"
+#include <cpuid.h>
+#include <signal.h>
+#include <ucontext.h>
+
+static int sigills;
+
+static void
+handler(int sig, siginfo_t *info, void *ucxt)
+{
+    ucontext_t *uc = (ucontext_t *)ucxt;
+    uc->uc_mcontext.gregs[REG_RIP] += 2; /* skip the ud2 */
+    sigills++;
+}
+
+static bool
+cpuid_avx512f(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+        return false;
+    return (ebx & bit_AVX512F) != 0;
+}
+
+int
+main(void)
+{
+    vec512_t a, b, res, want;
+    struct sigaction act, old;
+    bool native_avx512f = cpuid_avx512f();
+
+    memset(&act, 0, sizeof(act));
+    act.sa_sigaction = handler;
+    act.sa_flags = SA_SIGINFO;
+    sigaction(SIGILL, &act, NULL);
+    /* without AVX-512 on the host there is nothing for cpuid to hide */
+    print("taken over at the sigaction: %s\n",
+          !native_avx512f || !cpuid_avx512f() ? "yes" : "no");
+
+    sigaction(SIGILL, NULL, &old);
+    print("handler recorded: %s\n", old.sa_sigaction == handler ? "yes" : "no");
+    __asm__ __volatile__("ud2");
+    print("app SIGILLs handled: %d\n", sigills);
+
+    vec_fill(&a);
+    vec_fill(&b);
+    for (int i = 0; i < 16; i++)
+        want.d[i] = a.d[i] + b.d[i];
+    __asm__ __volatile__("vmovdqu64 %1, %%zmm17\n\t"
+                         "vmovdqu64 %2, %%zmm18\n\t"
+                         "vpaddd %%zmm18, %%zmm17, %%zmm16\n\t"
+                         "vmovdqu64 %%zmm16, %0"
+                         : "=m"(res)
+                         : "m"(a), "m"(b)
+                         : "memory");
+    vec_check("vpaddd after takeover", &res, &want, 64);
+    return 0;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file mxcsr_fault.c
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * mxcsr_fault.c -- a fault inside an {er} run sees and resumes with the app MXCSR (user-035)
+ *
+ * The load between the two {rz-sae} adds keeps them in one run under a single MXCSR
+ * override.  It faults once; the handler checks the MXCSR in its context and points
+ * the load at valid memory, so that the run is rebuilt from the load on.
+ */
+
+#include "tools.h"
+#include "avx512_test.h"
+#include <signal.h>
+#include <ucontext.h>
+#include <xmmintrin.h>
+
+#define MXCSR_RU 0x5f80
+
+static int value = 42;
+static uint32_t handler_mxcsr;
+static int faults;
+
+static void
+handler(int sig, siginfo_t *info, void *ucxt)
+{
+    ucontext_t *uc = (ucontext_t *)ucxt;
+    handler_mxcsr = uc->uc_mcontext.fpregs->mxcsr;
+    uc->uc_mcontext.gregs[REG_RAX] = (greg_t)&value;
+    faults++;
+}
+
+int
+main(void)
+{
+    vec512_t a, b, res;
+    int loaded;
+    struct sigaction act;
+    memset(&act, 0, sizeof(act));
+    act.sa_sigaction = handler;
+    act.sa_flags = SA_SIGINFO;
+    sigaction(SIGSEGV, &act, NULL);
+
+    /* 1 + 2^-20 rounds up under the app RU and down under {rz-sae} */
+    for (int i = 0; i < 32; i++) {
+        a.w[i] = 0x3c00;
+        b.w[i] = 0x0010;
+    }
+    _mm_setcsr(MXCSR_RU);
+    __asm__ __volatile__("vmovdqu64 %2, %%zmm1\n\t"
+                         "vmovdqu64 %3, %%zmm2\n\t"
+                         "vaddph %{rz-sae%}, %%zmm2, %%zmm1, %%zmm0\n\t"
+                         "movl (%%rax), %1\n\t"
+                         "vaddph %{rz-sae%}, %%zmm2, %%zmm0, %%zmm0\n\t"
+                         "vmovdqu64 %%zmm0, %0"
+                         : "=m"(res), "=r"(loaded)
+                         : "m"(a), "m"(b), "a"(NULL)
+                         : "xmm0", "xmm1", "xmm2", "memory");
+    uint32_t after = _mm_getcsr();
+    _mm_setcsr(0x1f80);
+
+    print("faults %d, loaded %d\n", faults, loaded);
+    print("handler mxcsr %s\n", handler_mxcsr == MXCSR_RU ? "ok" : "overridden");
+    print("resumed mxcsr %s\n", after == MXCSR_RU ? "ok" : "overridden");
+    print("{rz-sae} result %s\n", res.w[0] == 0x3c00 && res.w[31] == 0x3c00 ? "ok" : "wrong");
+    return 0;
+}
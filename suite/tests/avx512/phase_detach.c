@@ -0,0 +1,126 @@
+/**
+ * @file phase_detach.c
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * phase_detach.c -- a phase detach drops the code cache and a re-attach sees what
+ * the app changed while native (user-044)
+ *
+ * Run with -avx512_detach_quiet_ms 50 -hide_avx512 1 on a host with AVX-512, so
+ * that cpuid tells whether the process is under DR.  A generated function runs
+ * once under DR; once the AVX-512 phase is over and the process is native, it is
+ * unmapped and another one mapped in its place, and a SIGUSR1 handler is
+ * installed.  The SIGILL sigaction then takes the process over again: the new
+ * function must run rather than a stale fragment of the old one, and the handler
+ * must be the app's.
+ */
+
+#include "tools.h"
+#include "avx512_test.h"
+#include <cpuid.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <time.h>
+
+typedef int (*ret_func_t)(void);
+
+static int sigusr1s;
+
+static void
+handler(int sig, siginfo_t *info, void *ucxt)
+{
+    if (sig == SIGUSR1)
+        sigusr1s++;
+}
+
+/* Volatile, unlike __get_cpuid_count(), which the polling loop would hoist. */
+static bool
+cpuid_avx512f(void)
+{
+    unsigned int eax = 7, ebx, ecx = 0, edx;
+    __asm__ __volatile__("cpuid" : "+a"(eax), "=b"(ebx), "+c"(ecx), "=d"(edx));
+    return (ebx & bit_AVX512F) != 0;
+}
+
+/* Maps "mov $val, %eax; ret" at `where`, or anywhere if NULL. */
+static ret_func_t
+map_ret_func(void *where, int val)
+{
+    unsigned char code[] = { 0xb8, 0, 0, 0, 0, 0xc3 };
+    unsigned char *page =
+        mmap(where, 4096, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS |
+             (where == NULL ? 0 : MAP_FIXED), -1, 0);
+    if (page == MAP_FAILED)
+        return NULL;
+    memcpy(&code[1], &val, sizeof(val));
+    memcpy(page, code, sizeof(code));
+    mprotect(page, 4096, PROT_READ | PROT_EXEC);
+    return (ret_func_t)page;
+}
+
+static bool
+vpaddd_ok(void)
+{
+    vec512_t a, b, res, want;
+    vec_fill(&a);
+    vec_fill(&b);
+    for (int i = 0; i < 16; i++)
+        want.d[i] = a.d[i] + b.d[i];
+    __asm__ __volatile__("vmovdqu64 %1, %%zmm17\n\t"
+                         "vmovdqu64 %2, %%zmm18\n\t"
+                         "vpaddd %%zmm18, %%zmm17, %%zmm16\n\t"
+                         "vmovdqu64 %%zmm16, %0"
+                         : "=m"(res)
+                         : "m"(a), "m"(b)
+                         : "memory");
+    return memcmp(&res, &want, sizeof(res)) == 0;
+}
+
+/* The quiet period is polled in d_r_dispatch(), which the syscalls DR does not
+ * ignore, such as this query of the signal mask, go through.
+ */
+static bool
+wait_for_detach(void)
+{
+    struct timespec start, now;
+    sigset_t mask;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do {
+        for (int i = 0; i < 1024; i++)
+            sigprocmask(SIG_BLOCK, NULL, &mask);
+        if (cpuid_avx512f())
+            return true;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+    } while (now.tv_sec - start.tv_sec < 20);
+    return false;
+}
+
+int
+main(void)
+{
+    struct sigaction act;
+    ret_func_t func;
+
+    func = map_ret_func(NULL, 1);
+    print("under DR: func %d, vpaddd %s\n", func(), vpaddd_ok() ? "ok" : "wrong");
+
+    print("detached: %s\n", wait_for_detach() ? "yes" : "no");
+    munmap((void *)func, 4096);
+    if (map_ret_func((void *)func, 2) != func)
+        print("failed to remap\n");
+    memset(&act, 0, sizeof(act));
+    act.sa_sigaction = handler;
+    act.sa_flags = SA_SIGINFO;
+    sigaction(SIGUSR1, &act, NULL);
+
+    sigaction(SIGILL, &act, NULL);
+    print("re-attached at the sigaction: %s\n", cpuid_avx512f() ? "no" : "yes");
+    print("remapped func %d\n", func());
+    raise(SIGUSR1);
+    print("SIGUSR1s handled: %d\n", sigusr1s);
+    print("vpaddd after re-attach %s\n", vpaddd_ok() ? "ok" : "wrong");
+    return 0;
+}
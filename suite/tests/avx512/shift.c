@@ -0,0 +1,124 @@
+/**
+ * @file shift.c
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * shift.c -- variable word/qword shifts, vpsraq and variable rotates (user-026)
+ */
+
+#include "tools.h"
+#include "avx512_test.h"
+
+static int64_t
+sra64(int64_t a, uint64_t n)
+{
+    return n > 63 ? (a < 0 ? -1 : 0) : a >> n;
+}
+
+static uint16_t
+shift16(uint16_t a, uint16_t n, int kind)
+{
+    if (kind == 0)
+        return n > 15 ? 0 : (uint16_t)(a << n);
+    if (kind == 1)
+        return n > 15 ? 0 : (uint16_t)(a >> n);
+    return (uint16_t)(n > 15 ? ((int16_t)a < 0 ? -1 : 0) : (int16_t)a >> n);
+}
+
+static uint32_t
+rol32(uint32_t a, uint32_t n)
+{
+    n &= 31;
+    return n == 0 ? a : (a << n | a >> (32 - n));
+}
+
+static uint64_t
+ror64(uint64_t a, uint64_t n)
+{
+    n &= 63;
+    return n == 0 ? a : (a >> n | a << (64 - n));
+}
+
+#define VPSRAVQ(D, A, B) "vpsravq " ZMM(B) ", " ZMM(A) ", " ZMM(D) MERGE
+#define VPSRAVQ_Z(D, A, B) "vpsravq " ZMM(B) ", " ZMM(A) ", " ZMM(D) ZERO
+#define VPSRAVQ_BCST(D, A, B) "vpsravq %2%{1to8%}, " ZMM(A) ", " ZMM(D) MERGE
+#define VPSRAQ_IMM(D, A, B) "vpsraq $13, " ZMM(A) ", " ZMM(D) MERGE
+#define VPSRAQ_CNT(D, A, B) "vpsraq " XMM(B) ", " ZMM(A) ", " ZMM(D) MERGE
+#define VPSRAQ_CNT_X(D, A, B) "vpsraq " XMM(B) ", " XMM(A) ", " XMM(D) MERGE
+#define VPSRAQ_MEM_Y(D, A, B) "vpsraq %2, " YMM(A) ", " YMM(D) ZERO
+#define VPSLLVW(D, A, B) "vpsllvw " ZMM(B) ", " ZMM(A) ", " ZMM(D) MERGE
+#define VPSRLVW(D, A, B) "vpsrlvw %2, " ZMM(A) ", " ZMM(D) ZERO
+#define VPSRAVW_Y(D, A, B) "vpsravw " YMM(B) ", " YMM(A) ", " YMM(D) MERGE
+#define VPROLVD(D, A, B) "vprolvd " ZMM(B) ", " ZMM(A) ", " ZMM(D) MERGE
+#define VPRORVQ_X(D, A, B) "vprorvq " XMM(B) ", " XMM(A) ", " XMM(D) ZERO
+
+int
+main(void)
+{
+    vec512_t a, b, init, want;
+    uint64_t k = test_rand();
+    vec_fill(&a);
+    vec_fill(&b);
+    vec_fill(&init);
+
+    /* counts below and above the element width */
+    for (int i = 0; i < 8; i++)
+        b.q[i] = i < 4 ? b.q[i] % 64 : 60 + i;
+    for (int i = 0; i < 8; i++)
+        want.q[i] = (uint64_t)sra64(a.sq[i], b.q[i]);
+    vec_mask(&want, &init, k, 8, 64, false);
+    AVX512_CASE("vpsravq merge", VPSRAVQ, &init, &a, &b, k, &want, 64);
+    for (int i = 0; i < 8; i++)
+        want.q[i] = (uint64_t)sra64(a.sq[i], b.q[i]);
+    vec_mask(&want, &init, k, 8, 64, true);
+    AVX512_CASE("vpsravq zero", VPSRAVQ_Z, &init, &a, &b, k, &want, 64);
+    for (int i = 0; i < 8; i++)
+        want.q[i] = (uint64_t)sra64(a.sq[i], b.q[0]);
+    vec_mask(&want, &init, k, 8, 64, false);
+    AVX512_CASE("vpsravq bcst", VPSRAVQ_BCST, &init, &a, &b, k, &want, 64);
+
+    for (int i = 0; i < 8; i++)
+        want.q[i] = (uint64_t)sra64(a.sq[i], 13);
+    vec_mask(&want, &init, k, 8, 64, false);
+    AVX512_CASE("vpsraq imm", VPSRAQ_IMM, &init, &a, &b, k, &want, 64);
+    for (int i = 0; i < 8; i++)
+        want.q[i] = (uint64_t)sra64(a.sq[i], b.q[0]);
+    vec_mask(&want, &init, k, 8, 64, false);
+    AVX512_CASE("vpsraq xmm count", VPSRAQ_CNT, &init, &a, &b, k, &want, 64);
+    for (int i = 0; i < 2; i++)
+        want.q[i] = (uint64_t)sra64(a.sq[i], b.q[0]);
+    vec_mask(&want, &init, k, 8, 16, false);
+    AVX512_CASE("vpsraq xmm count xmm", VPSRAQ_CNT_X, &init, &a, &b, k, &want, 16);
+    for (int i = 0; i < 4; i++)
+        want.q[i] = (uint64_t)sra64(a.sq[i], b.q[0]);
+    vec_mask(&want, &init, k, 8, 32, true);
+    AVX512_CASE("vpsraq m128 count ymm", VPSRAQ_MEM_Y, &init, &a, &b, k, &want, 32);
+
+    for (int i = 0; i < 32; i++)
+        b.w[i] = i % 3 == 0 ? b.w[i] : b.w[i] % 18;
+    for (int i = 0; i < 32; i++)
+        want.w[i] = shift16(a.w[i], b.w[i], 0);
+    vec_mask(&want, &init, k, 2, 64, false);
+    AVX512_CASE("vpsllvw merge", VPSLLVW, &init, &a, &b, k, &want, 64);
+    for (int i = 0; i < 32; i++)
+        want.w[i] = shift16(a.w[i], b.w[i], 1);
+    vec_mask(&want, &init, k, 2, 64, true);
+    AVX512_CASE("vpsrlvw mem zero", VPSRLVW, &init, &a, &b, k, &want, 64);
+    for (int i = 0; i < 16; i++)
+        want.w[i] = shift16(a.w[i], b.w[i], 2);
+    vec_mask(&want, &init, k, 2, 32, false);
+    AVX512_CASE("vpsravw ymm", VPSRAVW_Y, &init, &a, &b, k, &want, 32);
+
+    for (int i = 0; i < 16; i++)
+        want.d[i] = rol32(a.d[i], b.d[i]);
+    vec_mask(&want, &init, k, 4, 64, false);
+    AVX512_CASE("vprolvd", VPROLVD, &init, &a, &b, k, &want, 64);
+    for (int i = 0; i < 2; i++)
+        want.q[i] = ror64(a.q[i], b.q[i]);
+    vec_mask(&want, &init, k, 8, 16, true);
+    AVX512_CASE("vprorvq xmm", VPRORVQ_X, &init, &a, &b, k, &want, 16);
+    return 0;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file tier0.c
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * tier0.c -- AVX-512 instrs carried out by the tier-0 interpreter (user-048)
+ *
+ * Run with a -avx512_tier_threshold no site reaches, so that every instr the
+ * interpreter implements runs in it.  Operands on the stack must be found where
+ * the app has them; masked-off elements and the rest of a {1toN} source are not
+ * read, so that they do not fault next to a PROT_NONE page; a masked store with
+ * an element on that page faults before writing any, and the SIGSEGV carries the
+ * address and si_code the hardware would give.
+ */
+
+#include "tools.h"
+#include "avx512_test.h"
+#include <setjmp.h>
+#include <signal.h>
+#include <sys/mman.h>
+
+static sigjmp_buf mark;
+static siginfo_t fault_info;
+
+static void
+handler(int sig, siginfo_t *info, void *ucxt)
+{
+    fault_info = *info;
+    siglongjmp(mark, 1);
+}
+
+int
+main(void)
+{
+    vec512_t a, b, res, want;
+    struct sigaction act;
+    uint8_t *pages;
+    uint32_t *edge;
+
+    memset(&act, 0, sizeof(act));
+    act.sa_sigaction = handler;
+    act.sa_flags = SA_SIGINFO;
+    sigaction(SIGSEGV, &act, NULL);
+    pages = (uint8_t *)mmap(NULL, 3 * PAGE_SIZE, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    mprotect(pages + PAGE_SIZE, PAGE_SIZE, PROT_NONE);
+    munmap(pages + 2 * PAGE_SIZE, PAGE_SIZE);
+    /* the last 8 dwords before the PROT_NONE page */
+    edge = (uint32_t *)(pages + PAGE_SIZE - 32);
+    for (int i = 0; i < 8; i++)
+        edge[i] = 0x1000 + i;
+
+    /* stack operands */
+    vec_fill(&a);
+    vec_fill(&b);
+    for (int i = 0; i < 16; i++)
+        want.d[i] = a.d[i] + b.d[i];
+    __asm__ __volatile__("vmovdqu64 %1, %%zmm17\n\t"
+                         "vmovdqu64 %2, %%zmm18\n\t"
+                         "vpaddd %%zmm18, %%zmm17, %%zmm16\n\t"
+                         "vmovdqu64 %%zmm16, %0"
+                         : "=m"(res)
+                         : "m"(a), "m"(b)
+                         : "memory");
+    vec_check("vpaddd on stack operands", &res, &want, 64);
+
+    /* a masked load whose clear elements lie on the PROT_NONE page */
+    for (int i = 0; i < 16; i++)
+        want.d[i] = i < 8 ? 0x1000 + i : 0;
+    __asm__ __volatile__("mov $0xff, %%eax\n\t"
+                         "kmovw %%eax, %%k1\n\t"
+                         "vmovdqu32 (%1), %%zmm16%{%%k1%}%{z%}\n\t"
+                         "vmovdqu64 %%zmm16, %0"
+                         : "=m"(res)
+                         : "r"(edge)
+                         : "rax", "memory");
+    vec_check("masked load next to PROT_NONE", &res, &want, 64);
+
+    /* {1to16} from the last dword before the PROT_NONE page */
+    for (int i = 0; i < 16; i++)
+        want.d[i] = a.d[i] + 0x1007;
+    __asm__ __volatile__("vmovdqu64 %1, %%zmm17\n\t"
+                         "vpaddd (%2)%{1to16%}, %%zmm17, %%zmm16\n\t"
+                         "vmovdqu64 %%zmm16, %0"
+                         : "=m"(res)
+                         : "m"(a), "r"(edge + 7)
+                         : "memory");
+    vec_check("{1to16} next to PROT_NONE", &res, &want, 64);
+
+    /* a masked store whose last element is on the PROT_NONE page */
+    memset(&fault_info, 0, sizeof(fault_info));
+    if (sigsetjmp(mark, 1) == 0) {
+        __asm__ __volatile__("mov $0x1ff, %%eax\n\t"
+                             "kmovw %%eax, %%k1\n\t"
+                             "vmovdqu32 %%zmm17, (%0)%{%%k1%}"
+                             :
+                             : "r"(edge)
+                             : "rax", "memory");
+    }
+    print("masked store: SIGSEGV at the page %s, %s, memory %s\n",
+          fault_info.si_addr == pages + PAGE_SIZE ? "yes" : "no",
+          fault_info.si_code == SEGV_ACCERR ? "SEGV_ACCERR" : "wrong si_code",
+          edge[0] == 0x1000 && edge[7] == 0x1007 ? "untouched" : "written");
+
+    /* a load from the unmapped page */
+    memset(&fault_info, 0, sizeof(fault_info));
+    if (sigsetjmp(mark, 1) == 0) {
+        __asm__ __volatile__("vmovdqu64 (%0), %%zmm16" : : "r"(pages + 2 * PAGE_SIZE) : "memory");
+    }
+    print("unmapped load: SIGSEGV at the page %s, %s\n",
+          fault_info.si_addr == pages + 2 * PAGE_SIZE ? "yes" : "no",
+          fault_info.si_code == SEGV_MAPERR ? "SEGV_MAPERR" : "wrong si_code");
+    return 0;
+}